@@ -0,0 +1,939 @@
+//
+// Benchmarks for the evaluation strategies of nxx::poly::Polynomial.
+//
+// The strategies differ in the length of their dependency chains: Horner is one serial chain of
+// multiply-adds, Horner2 runs two chains in x^2, and Estrin evaluates blocks of eight coefficients
+// as a tree. Each benchmark evaluates a polynomial of the order given by the benchmark argument,
+// at a sequence of points, and reports the time per evaluation.
+//
+
+#include <benchmark/benchmark.h>
+#include <Poly.hpp>
+#include <blaze/Blaze.h>
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+using namespace nxx::poly;
+
+static auto makePolynomial(int64_t order)
+{
+    std::vector< double > coeffs(static_cast< size_t >(order + 1));
+    for (size_t i = 0; i < coeffs.size(); ++i) coeffs[i] = 1.0 / static_cast< double >(i + 1);
+    return Polynomial(coeffs);
+}
+
+template< typename STRATEGY >
+static void BM_PolyEvaluate(benchmark::State& state)
+{
+    const auto poly = makePolynomial(state.range(0));
+    double     x    = 0.5;
+    for (auto _ : state) {
+        auto result = *poly.evaluate< STRATEGY >(x);
+        benchmark::DoNotOptimize(result);
+        x += 1.0E-9;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyEvaluate< Horner >)->DenseRange(4, 16, 4)->Arg(24)->Arg(32)->Arg(48)->Arg(64);
+BENCHMARK(BM_PolyEvaluate< Horner2 >)->DenseRange(4, 16, 4)->Arg(24)->Arg(32)->Arg(48)->Arg(64);
+BENCHMARK(BM_PolyEvaluate< Estrin >)->DenseRange(4, 16, 4)->Arg(24)->Arg(32)->Arg(48)->Arg(64);
+BENCHMARK(BM_PolyEvaluate< AutoEvaluation >)->DenseRange(4, 16, 4)->Arg(24)->Arg(32)->Arg(48)->Arg(64);
+BENCHMARK(BM_PolyEvaluate< CompensatedHorner >)->DenseRange(4, 16, 4)->Arg(24)->Arg(32)->Arg(48)->Arg(64);
+
+static void BM_PolyEvaluateBatch(benchmark::State& state)
+{
+    const auto            poly = makePolynomial(state.range(0));
+    std::vector< double > x(4096);
+    std::vector< double > y(x.size());
+    for (size_t i = 0; i < x.size(); ++i) x[i] = -1.0 + 2.0 * static_cast< double >(i) / static_cast< double >(x.size());
+
+    for (auto _ : state) {
+        auto result = poly.evaluate(x, y);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(x.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyEvaluateBatch)->Arg(4)->Arg(16)->Arg(64);
+
+//
+// Equispaced grids: evaluateGrid(), the forward difference table of detail::gridDifferences() with interleaved
+// lanes and as a single scalar table (for real and complex coefficients), the batched Horner's method on the
+// explicit points, and one evaluate() call per point.
+//
+
+static void BM_PolyEvaluateGrid(benchmark::State& state)
+{
+    const auto            poly = makePolynomial(state.range(0));
+    std::vector< double > y(4096);
+    const double          h = 2.0 / static_cast< double >(y.size());
+
+    for (auto _ : state) {
+        evaluateGrid(poly, -1.0, h, std::span< double >(y));
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(y.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyEvaluateGrid)->Arg(4)->Arg(8)->Arg(16);
+
+template< std::size_t LANES >
+static void BM_PolyEvaluateGridDifferences(benchmark::State& state)
+{
+    const auto            poly = makePolynomial(state.range(0));
+    std::vector< double > y(4096);
+    const double          h = 2.0 / static_cast< double >(y.size());
+
+    for (auto _ : state) {
+        detail::gridDifferences< LANES >(std::span< const double >(poly.coefficients()), -1.0, h, std::span< double >(y));
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(y.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyEvaluateGridDifferences< detail::POLY_BATCH_LANES >)->Arg(4)->Arg(8)->Arg(16);
+BENCHMARK(BM_PolyEvaluateGridDifferences< 1 >)->Arg(4)->Arg(8)->Arg(16);
+
+static void BM_PolyEvaluateGridComplex(benchmark::State& state)
+{
+    std::vector< std::complex< double > > coeffs(static_cast< size_t >(state.range(0)) + 1);
+    for (size_t i = 0; i < coeffs.size(); ++i)
+        coeffs[i] = { 1.0 / static_cast< double >(i + 1), 0.5 / static_cast< double >(i + 2) };
+    const auto poly = Polynomial< std::complex< double > >(coeffs);
+
+    std::vector< std::complex< double > > y(4096);
+    const std::complex< double >          h = 2.0 / static_cast< double >(y.size());
+
+    for (auto _ : state) {
+        if (state.range(1) == 0)
+            detail::gridHorner(std::span< const std::complex< double > >(poly.coefficients()), { -1.0, 0.5 }, h, std::span(y));
+        else
+            detail::gridDifferences< detail::POLY_BATCH_LANES >(
+                std::span< const std::complex< double > >(poly.coefficients()), { -1.0, 0.5 }, h, std::span(y));
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(y.size()));
+}
+// Register the function as a benchmark; the second argument selects Horner (0) or the difference table (1)
+BENCHMARK(BM_PolyEvaluateGridComplex)->ArgsProduct({ { 4, 8, 16, 24 }, { 0, 1 } });
+
+static void BM_PolyEvaluateGridHorner(benchmark::State& state)
+{
+    const auto            poly = makePolynomial(state.range(0));
+    std::vector< double > x(4096);
+    std::vector< double > y(x.size());
+    const double          h = 2.0 / static_cast< double >(y.size());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < x.size(); ++i) x[i] = -1.0 + h * static_cast< double >(i);
+        auto result = poly.evaluate(x, y);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(y.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyEvaluateGridHorner)->Arg(4)->Arg(8)->Arg(16);
+
+static void BM_PolyEvaluateGridScalar(benchmark::State& state)
+{
+    const auto            poly = makePolynomial(state.range(0));
+    std::vector< double > y(4096);
+    const double          h = 2.0 / static_cast< double >(y.size());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < y.size(); ++i) y[i] = *poly.evaluate(-1.0 + h * static_cast< double >(i));
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(y.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyEvaluateGridScalar)->Arg(4)->Arg(8)->Arg(16);
+
+static void BM_ChebyshevEvaluateBatch(benchmark::State& state)
+{
+    const auto            series = ChebyshevSeries< double >(makePolynomial(state.range(0)).coefficients());
+    std::vector< double > x(4096);
+    std::vector< double > y(x.size());
+    for (size_t i = 0; i < x.size(); ++i) x[i] = -1.0 + 2.0 * static_cast< double >(i) / static_cast< double >(x.size());
+
+    for (auto _ : state) {
+        auto result = series.evaluate(x, y);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(x.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_ChebyshevEvaluateBatch)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_ChebyshevToPolynomial(benchmark::State& state)
+{
+    const auto series = ChebyshevSeries< double >(makePolynomial(state.range(0)).coefficients());
+    for (auto _ : state) {
+        auto result = series.toPolynomial();
+        benchmark::DoNotOptimize(result);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_ChebyshevToPolynomial)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_PolynomialToChebyshev(benchmark::State& state)
+{
+    const auto poly = makePolynomial(state.range(0));
+    for (auto _ : state) {
+        auto result = toChebyshev(poly);
+        benchmark::DoNotOptimize(result);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolynomialToChebyshev)->RangeMultiplier(4)->Range(16, 4096);
+
+//
+// Multiplication kernels. The crossover points between the kernels determine the values of
+// detail::KARATSUBA_THRESHOLD and detail::FFT_THRESHOLD, which operator* uses for dispatching.
+//
+
+static std::vector< double > makeCoefficients(int64_t size)
+{
+    std::vector< double > coeffs(static_cast< size_t >(size));
+    for (size_t i = 0; i < coeffs.size(); ++i) coeffs[i] = std::sin(static_cast< double >(i) + 1.0);
+    return coeffs;
+}
+
+static void BM_PolyMultiplySchoolbook(benchmark::State& state)
+{
+    const auto            a = makeCoefficients(state.range(0));
+    std::vector< double > out(2 * a.size() - 1);
+    for (auto _ : state) {
+        std::fill(out.begin(), out.end(), 0.0);
+        detail::multiplySchoolbook(std::span< const double >(a), std::span< const double >(a), std::span< double >(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyMultiplySchoolbook)->RangeMultiplier(2)->Range(16, 1024);
+
+static void BM_PolyMultiplyKaratsuba(benchmark::State& state)
+{
+    const auto            a = makeCoefficients(state.range(0));
+    std::vector< double > out(2 * a.size() - 1);
+    std::vector< double > scratch(detail::karatsubaScratchSize(a.size()));
+    for (auto _ : state) {
+        detail::multiplyKaratsuba(a.data(), a.data(), a.size(), out.data(), scratch.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyMultiplyKaratsuba)->RangeMultiplier(2)->Range(16, 1024);
+
+static void BM_PolyMultiplyFFT(benchmark::State& state)
+{
+    const auto            a = makeCoefficients(state.range(0));
+    std::vector< double > out(2 * a.size() - 1);
+    for (auto _ : state) {
+        std::fill(out.begin(), out.end(), 0.0);
+        detail::multiplyFFT(std::span< const double >(a), std::span< const double >(a), std::span< double >(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyMultiplyFFT)->RangeMultiplier(2)->Range(16, 1024);
+
+static void BM_PolyMultiply(benchmark::State& state)
+{
+    const auto p = Polynomial(makeCoefficients(state.range(0)));
+    for (auto _ : state) {
+        auto result = p * p;
+        benchmark::DoNotOptimize(result);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyMultiply)->RangeMultiplier(2)->Range(16, 1024);
+
+//
+// Division kernels, for a divisor and a quotient of equal length. The crossover point determines the value
+// of detail::NEWTON_DIVISION_THRESHOLD.
+//
+
+static void BM_PolyDivideSchoolbook(benchmark::State& state)
+{
+    const auto            a = makeCoefficients(2 * state.range(0) - 1);
+    auto                  b = makeCoefficients(state.range(0));
+    std::vector< double > quotient(a.size() - b.size() + 1);
+    std::vector< double > remainder(a.size());
+    b.back() = 4.0;
+    for (auto _ : state) {
+        std::copy(a.begin(), a.end(), remainder.begin());
+        detail::divideSchoolbook(std::span< double >(remainder), std::span< const double >(b), std::span< double >(quotient));
+        benchmark::DoNotOptimize(quotient.data());
+        benchmark::ClobberMemory();
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyDivideSchoolbook)->RangeMultiplier(2)->Range(64, 4096);
+
+static void BM_PolyDivideNewton(benchmark::State& state)
+{
+    const auto            a = makeCoefficients(2 * state.range(0) - 1);
+    auto                  b = makeCoefficients(state.range(0));
+    std::vector< double > quotient(a.size() - b.size() + 1);
+    std::vector< double > remainder(b.size() - 1);
+    b.back() = 4.0;
+    for (auto _ : state) {
+        detail::divideNewton(std::span< const double >(a), std::span< const double >(b), std::span< double >(quotient), std::span< double >(remainder));
+        benchmark::DoNotOptimize(quotient.data());
+        benchmark::ClobberMemory();
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyDivideNewton)->RangeMultiplier(2)->Range(64, 4096);
+
+static void BM_PolyDeflate(benchmark::State& state)
+{
+    const auto p = Polynomial(makeCoefficients(state.range(0)));
+    auto       q = p;
+    for (auto _ : state) {
+        q = p;
+        benchmark::DoNotOptimize(q.deflate(0.5));
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyDeflate)->RangeMultiplier(2)->Range(16, 1024);
+
+//
+// Subproduct trees. The points are spread over the unit circle, where the products of the linear factors
+// are well conditioned. The crossover points between the tree and the direct methods determine the values
+// of detail::ROOT_PRODUCT_THRESHOLD, detail::MULTIPOINT_EVALUATION_THRESHOLD and detail::INTERPOLATION_THRESHOLD.
+//
+
+static std::vector< std::complex< double > > makePoints(int64_t size)
+{
+    std::vector< std::complex< double > > points(static_cast< size_t >(size));
+    for (size_t i = 0; i < points.size(); ++i) points[i] = std::polar(1.0, 2.0 * static_cast< double >(i) + 0.5);
+    return points;
+}
+
+static void BM_PolyFromRoots(benchmark::State& state)
+{
+    const auto roots = makePoints(state.range(0));
+    for (auto _ : state) {
+        auto result = createPolynomialFromRoots(roots);
+        benchmark::DoNotOptimize(result);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyFromRoots)->RangeMultiplier(4)->Range(16, 4096);
+
+static void BM_MultipointEvaluateHorner(benchmark::State& state)
+{
+    const auto                            points = makePoints(state.range(0));
+    const auto                            coeffs = makePoints(state.range(0) + 1);
+    std::vector< std::complex< double > > out(points.size());
+    for (auto _ : state) {
+        detail::hornerBatch(std::span< const std::complex< double > >(coeffs), std::span< const std::complex< double > >(points), std::span(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_MultipointEvaluateHorner)->RangeMultiplier(4)->Range(64, 16384);
+
+static void BM_MultipointEvaluateTree(benchmark::State& state)
+{
+    const auto                            points = makePoints(state.range(0));
+    const auto                            coeffs = makePoints(state.range(0) + 1);
+    std::vector< std::complex< double > > out(points.size());
+    for (auto _ : state) {
+        SubproductTree(points).evaluate(std::span< const std::complex< double > >(coeffs), std::span(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_MultipointEvaluateTree)->RangeMultiplier(4)->Range(64, 16384);
+
+static void BM_InterpolateNewton(benchmark::State& state)
+{
+    const auto                            points = makePoints(state.range(0));
+    const auto                            values = makePoints(state.range(0) + 1);
+    std::vector< std::complex< double > > out(points.size());
+    for (auto _ : state) {
+        detail::interpolateNewton(std::span< const std::complex< double > >(points),
+                                  std::span< const std::complex< double > >(values).first(points.size()),
+                                  std::span(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_InterpolateNewton)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_InterpolateTree(benchmark::State& state)
+{
+    const auto points = makePoints(state.range(0));
+    const auto values = makePoints(state.range(0) + 1);
+    for (auto _ : state) {
+        auto result = SubproductTree(points).interpolate(std::span< const std::complex< double > >(values).first(points.size()));
+        benchmark::DoNotOptimize(result);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_InterpolateTree)->RangeMultiplier(4)->Range(64, 4096);
+
+//
+// Chained arithmetic. The sums and differences are computed in the storage of the product, so the
+// expression allocates once.
+//
+
+static void BM_PolyChainedArithmetic(benchmark::State& state)
+{
+    const auto p1 = Polynomial(makeCoefficients(state.range(0)));
+    const auto p2 = Polynomial(makeCoefficients(state.range(0) / 2));
+    const auto p3 = Polynomial(makeCoefficients(state.range(0) + 1));
+    for (auto _ : state) {
+        auto result = p1 * p2 + p3 - p1 + p2;
+        benchmark::DoNotOptimize(result);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolyChainedArithmetic)->RangeMultiplier(4)->Range(16, 1024);
+
+//
+// Root finding strategies for polysolve. The coefficients are of similar size, so the roots cluster
+// around the unit circle, and are reasonably well conditioned.
+//
+
+template< typename SOLVER >
+static void BM_Polysolve(benchmark::State& state)
+{
+    const auto poly = Polynomial(makeCoefficients(state.range(0) + 1));
+    for (auto _ : state) {
+        auto roots = polysolve< std::complex< double >, SOLVER >(poly);
+        benchmark::DoNotOptimize(roots);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_Polysolve< LaguerreSolver >)->RangeMultiplier(2)->Range(8, 128);
+BENCHMARK(BM_Polysolve< AberthSolver >)->RangeMultiplier(2)->Range(8, 128);
+BENCHMARK(BM_Polysolve< CompanionSolver >)->RangeMultiplier(2)->Range(8, 128);
+BENCHMARK(BM_Polysolve< AutoSolver<> >)->RangeMultiplier(2)->Range(8, 128);
+BENCHMARK(BM_Polysolve< AdaptiveSolver<> >)->RangeMultiplier(2)->Range(8, 128);
+
+//
+// Ill-conditioned roots: a cluster of range(0) roots spaced 1/1024 apart, solved in double precision,
+// and with the adaptive solver, which refines the cluster in higher precision to a tolerance of 1e-14.
+//
+
+template< typename SOLVER >
+static void BM_PolysolveCluster(benchmark::State& state)
+{
+    auto poly = Polynomial({ 1.0 });
+    for (int64_t i = 0; i < state.range(0); ++i) poly *= Polynomial({ -1.0 - static_cast< double >(i) / 1024.0, 1.0 });
+    for (auto _ : state) {
+        auto roots = polysolve< std::complex< double >, SOLVER >(poly, 1.0E-14);
+        benchmark::DoNotOptimize(roots);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolysolveCluster< AutoSolver<> >)->DenseRange(4, 6);
+BENCHMARK(BM_PolysolveCluster< AdaptiveSolver<> >)->DenseRange(4, 6);
+
+//
+// Real roots only: real-root isolation, compared with filtering the complex roots.
+//
+
+template< typename SOLVER >
+static void BM_PolysolveReal(benchmark::State& state)
+{
+    const auto poly = Polynomial(makeCoefficients(state.range(0) + 1));
+    for (auto _ : state) {
+        auto roots = polysolve< double, SOLVER >(poly);
+        benchmark::DoNotOptimize(roots);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolysolveReal< RealRootSolver >)->RangeMultiplier(2)->Range(8, 128);
+BENCHMARK(BM_PolysolveReal< LaguerreSolver >)->RangeMultiplier(2)->Range(8, 128);
+BENCHMARK(BM_PolysolveReal< CompanionSolver >)->RangeMultiplier(2)->Range(8, 128);
+
+//
+// Parameter sweeps: a family of polynomials whose coefficients vary smoothly, solved at each step from
+// scratch, or followed with RootTracker. The time is per step.
+//
+
+static auto makeSweepPolynomial(int64_t order, double t)
+{
+    std::vector< double > coeffs(static_cast< size_t >(order + 1));
+    for (size_t i = 0; i < coeffs.size(); ++i) coeffs[i] = std::sin(static_cast< double >(i) + 1.0 + t);
+    return Polynomial(coeffs);
+}
+
+static void BM_SweepPolysolve(benchmark::State& state)
+{
+    double t = 0.0;
+    for (auto _ : state) {
+        auto roots = polysolve< std::complex< double > >(makeSweepPolynomial(state.range(0), t));
+        benchmark::DoNotOptimize(roots);
+        t += 1.0E-3;
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_SweepPolysolve)->RangeMultiplier(2)->Range(8, 128);
+
+static void BM_SweepRootTracker(benchmark::State& state)
+{
+    RootTracker< double > tracker;
+    double                t = 0.0;
+    for (auto _ : state) {
+        auto roots = tracker.track(makeSweepPolynomial(state.range(0), t));
+        benchmark::DoNotOptimize(roots);
+        t += 1.0E-3;
+    }
+    state.counters["fallbacks"] = static_cast< double >(tracker.fallbacks());
+}
+// Register the function as a benchmark
+BENCHMARK(BM_SweepRootTracker)->RangeMultiplier(2)->Range(8, 128);
+
+//
+// Multiple roots: four distinct roots, each of multiplicity range(0), solved directly and by
+// solving the square-free factors.
+//
+
+template< typename SOLVER >
+static void BM_PolysolveMultiple(benchmark::State& state)
+{
+    auto poly = Polynomial({ 1.0 });
+    for (const double root : { -1.5, -0.5, 0.5, 1.5 })
+        for (int64_t i = 0; i < state.range(0); ++i) poly *= Polynomial({ -root, 1.0 });
+    for (auto _ : state) {
+        auto roots = polysolve< std::complex< double >, SOLVER >(poly);
+        benchmark::DoNotOptimize(roots);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolysolveMultiple< AutoSolver<> >)->RangeMultiplier(2)->Range(2, 8);
+BENCHMARK(BM_PolysolveMultiple< SquareFreeSolver<> >)->RangeMultiplier(2)->Range(2, 8);
+
+//
+// Batched closed form solvers, compared with calling cubic() for each polynomial.
+//
+
+static void BM_CubicBatch(benchmark::State& state)
+{
+    const auto                          count = static_cast< size_t >(state.range(0));
+    std::array< std::vector< double >, 4 > c;
+    std::array< std::vector< double >, 3 > re;
+    std::array< std::vector< double >, 3 > im;
+    for (size_t k = 0; k < 4; ++k) c[k] = makeCoefficients(state.range(0) + static_cast< int64_t >(k));
+    for (size_t k = 0; k < 3; ++k) {
+        re[k].resize(count);
+        im[k].resize(count);
+        c[k].resize(count);
+    }
+    c[3].resize(count);
+    for (auto& coeff : c[3]) coeff += 2.0;
+
+    for (auto _ : state) {
+        cubicBatch< double >({ c[0], c[1], c[2], c[3] }, { re[0], re[1], re[2] }, { im[0], im[1], im[2] });
+        benchmark::DoNotOptimize(re[0].data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_CubicBatch)->Arg(1 << 16);
+
+static void BM_CubicScalar(benchmark::State& state)
+{
+    const auto                             count = static_cast< size_t >(state.range(0));
+    std::array< std::vector< double >, 4 > c;
+    for (size_t k = 0; k < 4; ++k) c[k] = makeCoefficients(state.range(0) + static_cast< int64_t >(k));
+    for (auto& coeff : c[3]) coeff += 2.0;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            auto roots = cubic< std::complex< double > >(Polynomial< double >({ c[0][i], c[1][i], c[2][i], c[3][i] }));
+            benchmark::DoNotOptimize(roots);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_CubicScalar)->Arg(1 << 16);
+
+//
+// Quartics in closed form, with real and complex roots requested, compared with the iterative solvers
+// (LaguerreSolver solves quartics in closed form as well).
+//
+
+template< typename RT >
+static void BM_Quartic(benchmark::State& state)
+{
+    const auto poly = Polynomial(makeCoefficients(5));
+    for (auto _ : state) {
+        auto roots = quartic< RT >(poly);
+        benchmark::DoNotOptimize(roots);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_Quartic< double >);
+BENCHMARK(BM_Quartic< std::complex< double > >);
+
+template< typename SOLVER >
+static void BM_PolysolveQuartic(benchmark::State& state)
+{
+    const auto poly = Polynomial(makeCoefficients(5));
+    for (auto _ : state) {
+        auto roots = polysolve< std::complex< double >, SOLVER >(poly);
+        benchmark::DoNotOptimize(roots);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolysolveQuartic< AberthSolver >);
+BENCHMARK(BM_PolysolveQuartic< CompanionSolver >);
+
+//
+// Many small polynomials evaluated at a common point: a PolynomialBank, compared with evaluating a
+// std::vector of Polynomial objects one at a time. The benchmark argument is the number of polynomials.
+//
+
+static std::vector< Polynomial< double > > makePolynomials(int64_t count, int64_t order)
+{
+    std::vector< Polynomial< double > > polys;
+    std::vector< double >               coeffs(static_cast< size_t >(order + 1));
+    for (int64_t i = 0; i < count; ++i) {
+        for (size_t k = 0; k < coeffs.size(); ++k) coeffs[k] = std::sin(static_cast< double >(i) + 0.1 * static_cast< double >(k) + 1.0);
+        polys.emplace_back(coeffs);
+    }
+    return polys;
+}
+
+static void BM_PolynomialBank(benchmark::State& state)
+{
+    const PolynomialBank< double > bank(makePolynomials(state.range(0), 6));
+    std::vector< double >          out(bank.size());
+    double                         x = 0.5;
+    for (auto _ : state) {
+        bank.evaluate(x, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+        x += 1.0E-9;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolynomialBank)->Arg(64)->Arg(512)->Arg(4096);
+
+static void BM_PolynomialBankScalar(benchmark::State& state)
+{
+    const auto            polys = makePolynomials(state.range(0), 6);
+    std::vector< double > out(polys.size());
+    double                x = 0.5;
+    for (auto _ : state) {
+        for (size_t i = 0; i < polys.size(); ++i) out[i] = *polys[i].evaluate(x);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+        x += 1.0E-9;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolynomialBankScalar)->Arg(64)->Arg(512)->Arg(4096);
+
+static void BM_PolynomialBankDerivatives(benchmark::State& state)
+{
+    const PolynomialBank< double >        bank(makePolynomials(state.range(0), 6));
+    std::array< std::vector< double >, 3 > out;
+    for (auto& values : out) values.resize(bank.size());
+    double x = 0.5;
+    for (auto _ : state) {
+        bank.evaluateWithDerivatives< 2 >(x, { out[0], out[1], out[2] });
+        benchmark::DoNotOptimize(out[0].data());
+        benchmark::ClobberMemory();
+        x += 1.0E-9;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_PolynomialBankDerivatives)->Arg(64)->Arg(512)->Arg(4096);
+
+//
+// Polynomials at a matrix argument: the Paterson-Stockmeyer scheme used by evaluateMatrix(), compared with
+// Horner's method, which takes one matrix product per coefficient. The benchmark argument is the order.
+//
+
+static blaze::DynamicMatrix< double > makeMatrix(size_t dim)
+{
+    blaze::DynamicMatrix< double > A(dim, dim);
+    for (size_t i = 0; i < dim; ++i)
+        for (size_t j = 0; j < dim; ++j) A(i, j) = std::sin(static_cast< double >(dim * i + j + 1)) / static_cast< double >(dim);
+    return A;
+}
+
+static void BM_MatrixEvaluate(benchmark::State& state)
+{
+    const auto poly = makePolynomial(state.range(0));
+    const auto A    = makeMatrix(64);
+    for (auto _ : state) {
+        auto result = evaluateMatrix(poly, A);
+        benchmark::DoNotOptimize(result);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_MatrixEvaluate)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+
+static void BM_MatrixEvaluateHorner(benchmark::State& state)
+{
+    const auto                     poly   = makePolynomial(state.range(0));
+    const auto&                    coeffs = poly.coefficients();
+    const auto                     A      = makeMatrix(64);
+    blaze::DynamicMatrix< double > result(A.rows(), A.columns());
+    blaze::DynamicMatrix< double > product(A.rows(), A.columns());
+    for (auto _ : state) {
+        result = coeffs.back() * A;
+        for (size_t i = 0; i < A.rows(); ++i) result(i, i) += coeffs[coeffs.size() - 2];
+        for (size_t k = coeffs.size() - 2; k-- > 0;) {
+            product = result * A;
+            swap(result, product);
+            for (size_t i = 0; i < A.rows(); ++i) result(i, i) += coeffs[k];
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_MatrixEvaluateHorner)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+
+//
+// Multivariate polynomials: the Horner tree of MultiPolynomial, compared with summing the terms one at a time,
+// and the cost of the exact gradient and Hessian. The polynomial is dense in four variables, of the total degree
+// given by the benchmark argument.
+//
+
+static std::vector< std::pair< double, std::array< size_t, 4 > > > makeTerms(int64_t degree)
+{
+    std::vector< std::pair< double, std::array< size_t, 4 > > > terms;
+    const auto                                                   d = static_cast< size_t >(degree);
+    for (size_t a = 0; a <= d; ++a)
+        for (size_t b = 0; a + b <= d; ++b)
+            for (size_t c = 0; a + b + c <= d; ++c)
+                for (size_t e = 0; a + b + c + e <= d; ++e)
+                    terms.push_back({ std::sin(static_cast< double >(terms.size() + 1)), { a, b, c, e } });
+    return terms;
+}
+
+static MultiPolynomial< double > makeMultiPolynomial(int64_t degree)
+{
+    MultiPolynomial< double > poly(4);
+    for (const auto& [coeff, powers] : makeTerms(degree)) poly.addTerm(coeff, powers);
+    return poly;
+}
+
+static void BM_MultiPolynomialEvaluate(benchmark::State& state)
+{
+    const auto              poly = makeMultiPolynomial(state.range(0));
+    std::array< double, 4 > x { 0.3, -0.7, 0.5, 0.9 };
+    for (auto _ : state) {
+        auto result = poly(x);
+        benchmark::DoNotOptimize(result);
+        x[0] += 1.0E-9;
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_MultiPolynomialEvaluate)->Arg(2)->Arg(4)->Arg(8);
+
+static void BM_MultiPolynomialTerms(benchmark::State& state)
+{
+    const auto              terms = makeTerms(state.range(0));
+    std::array< double, 4 > x { 0.3, -0.7, 0.5, 0.9 };
+    for (auto _ : state) {
+        double result = 0.0;
+        for (const auto& [coeff, powers] : terms) {
+            double term = coeff;
+            for (size_t i = 0; i < 4; ++i) term *= std::pow(x[i], static_cast< double >(powers[i]));
+            result += term;
+        }
+        benchmark::DoNotOptimize(result);
+        x[0] += 1.0E-9;
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_MultiPolynomialTerms)->Arg(2)->Arg(4)->Arg(8);
+
+static void BM_MultiPolynomialGradient(benchmark::State& state)
+{
+    const auto              poly = makeMultiPolynomial(state.range(0));
+    std::array< double, 4 > x { 0.3, -0.7, 0.5, 0.9 };
+    std::array< double, 4 > grad {};
+    for (auto _ : state) {
+        auto result = poly.gradient(x, grad);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(grad.data());
+        x[0] += 1.0E-9;
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_MultiPolynomialGradient)->Arg(2)->Arg(4)->Arg(8);
+
+static void BM_MultiPolynomialHessian(benchmark::State& state)
+{
+    const auto               poly = makeMultiPolynomial(state.range(0));
+    std::array< double, 4 >  x { 0.3, -0.7, 0.5, 0.9 };
+    std::array< double, 4 >  grad {};
+    std::array< double, 16 > hess {};
+    for (auto _ : state) {
+        auto result = poly.hessian(x, grad, hess);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(hess.data());
+        x[0] += 1.0E-9;
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_MultiPolynomialHessian)->Arg(2)->Arg(4)->Arg(8);
+
+//
+// Orthogonal polynomials: the table of the Legendre polynomials of degree 0..32 and their first derivatives from
+// the recurrence, compared with batched evaluation of each polynomial from its monomial coefficients, and the
+// computation of Gauss-Legendre rules.
+//
+
+static void BM_OrthogonalTable(benchmark::State& state)
+{
+    const std::size_t     degree = 32;
+    std::vector< double > x(static_cast< size_t >(state.range(0)));
+    for (size_t m = 0; m < x.size(); ++m) x[m] = -1.0 + 2.0 * static_cast< double >(m) / static_cast< double >(x.size());
+    std::vector< double > values((degree + 1) * x.size());
+    std::vector< double > derivs(values.size());
+
+    for (auto _ : state) {
+        evaluateOrthogonalWithDerivatives< 1 >(LegendreFamily< double > {}, degree, x, { std::span(values), std::span(derivs) });
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(derivs.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(values.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_OrthogonalTable)->Arg(64)->Arg(4096)->Arg(65536);
+
+static void BM_OrthogonalTableMonomial(benchmark::State& state)
+{
+    const std::size_t                      degree = 32;
+    std::vector< Polynomial< double > >    polys { Polynomial< double >({ 1.0 }), Polynomial< double >({ 0.0, 1.0 }) };
+    const Polynomial< double >             t({ 0.0, 1.0 });
+    for (std::size_t k = 1; k < degree; ++k) {
+        const auto n = static_cast< double >(k);
+        polys.push_back(((2 * n + 1) / (n + 1)) * t * polys[k] - (n / (n + 1)) * polys[k - 1]);
+    }
+
+    std::vector< double > x(static_cast< size_t >(state.range(0)));
+    for (size_t m = 0; m < x.size(); ++m) x[m] = -1.0 + 2.0 * static_cast< double >(m) / static_cast< double >(x.size());
+    std::vector< double > values((degree + 1) * x.size());
+
+    for (auto _ : state) {
+        for (std::size_t k = 0; k <= degree; ++k) {
+            auto result = polys[k].evaluate(x, std::span(values).subspan(k * x.size(), x.size()));
+            benchmark::DoNotOptimize(result);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(values.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_OrthogonalTableMonomial)->Arg(64)->Arg(4096)->Arg(65536);
+
+static void BM_GaussRule(benchmark::State& state)
+{
+    for (auto _ : state) {
+        auto rule = gaussRule(LegendreFamily< double > {}, static_cast< std::size_t >(state.range(0)));
+        benchmark::DoNotOptimize(rule.nodes.data());
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_GaussRule)->Arg(16)->Arg(64)->Arg(256);
+
+//
+// Rational functions: the fused evaluation of Rational, at one point and at a batch of points, compared with
+// evaluating the numerator and the denominator as two separate polynomials.
+//
+
+static Rational< double > makeRational(int64_t order)
+{
+    return Rational< double >(makePolynomial(order), makePolynomial(order) + Polynomial< double >({ 2.0 }));
+}
+
+static void BM_RationalEvaluate(benchmark::State& state)
+{
+    const auto func = makeRational(state.range(0));
+    double     x    = 0.3;
+    for (auto _ : state) {
+        auto result = func.evaluate(x);
+        benchmark::DoNotOptimize(result);
+        x += 1.0E-9;
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_RationalEvaluate)->Arg(4)->Arg(8)->Arg(16);
+
+static void BM_RationalEvaluateSeparate(benchmark::State& state)
+{
+    const auto func = makeRational(state.range(0));
+    double     x    = 0.3;
+    for (auto _ : state) {
+        auto result = *func.numerator().evaluate(x) / *func.denominator().evaluate(x);
+        benchmark::DoNotOptimize(result);
+        x += 1.0E-9;
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_RationalEvaluateSeparate)->Arg(4)->Arg(8)->Arg(16);
+
+static void BM_RationalEvaluateBatch(benchmark::State& state)
+{
+    const auto            func = makeRational(state.range(0));
+    std::vector< double > x(4096);
+    std::vector< double > y(x.size());
+    for (size_t i = 0; i < x.size(); ++i) x[i] = -1.0 + 2.0 * static_cast< double >(i) / static_cast< double >(x.size());
+
+    for (auto _ : state) {
+        auto result = func.evaluate(x, y);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(x.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_RationalEvaluateBatch)->Arg(4)->Arg(8)->Arg(16);
+
+static void BM_RationalEvaluateBatchSeparate(benchmark::State& state)
+{
+    const auto            func = makeRational(state.range(0));
+    std::vector< double > x(4096);
+    std::vector< double > num(x.size());
+    std::vector< double > den(x.size());
+    for (size_t i = 0; i < x.size(); ++i) x[i] = -1.0 + 2.0 * static_cast< double >(i) / static_cast< double >(x.size());
+
+    for (auto _ : state) {
+        auto numResult = func.numerator().evaluate(x, num);
+        auto denResult = func.denominator().evaluate(x, den);
+        for (size_t i = 0; i < x.size(); ++i) num[i] /= den[i];
+        benchmark::DoNotOptimize(numResult);
+        benchmark::DoNotOptimize(denResult);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(x.size()));
+}
+// Register the function as a benchmark
+BENCHMARK(BM_RationalEvaluateBatchSeparate)->Arg(4)->Arg(8)->Arg(16);
@@ -194,7 +194,17 @@ namespace nxx::poly
     requires nxx::IsFloat< T > || IsComplex< T >
     class Polynomial;
 
+    template< typename T, std::size_t N >
+    requires nxx::IsFloat< T > || IsComplex< T >
+    class StaticPolynomial;
+
+    template< typename POLY >
+    concept IsDynamicPolynomial = std::same_as< POLY, Polynomial< typename POLY::value_type > >;
+
+    template< typename POLY >
+    concept IsStaticPolynomial = std::same_as< POLY, StaticPolynomial< typename POLY::value_type, POLY::static_order > >;
+
     template< typename POLY >
-    concept IsPolynomial = std::same_as< POLY, Polynomial< typename POLY::value_type > >;
+    concept IsPolynomial = IsDynamicPolynomial< POLY > || IsStaticPolynomial< POLY >;
 }    // namespace nxx::poly
 #endif    // NUMERIXX_CONCEPTS_HPP
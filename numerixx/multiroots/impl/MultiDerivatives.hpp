@@ -407,16 +407,30 @@ namespace nxx::deriv
      * of a vector-valued function. Each row of the Jacobian matrix corresponds to the gradient of one function
      * in the array with respect to the variables specified in `point`.
      *
-     * The derivative computation utilizes the `Order1CentralRichardson` algorithm, which is suitable for first-order
-     * derivative calculations. This algorithm choice provides a balance between computational efficiency and
-     * accuracy for most use cases.
+     * If every function provides its exact gradient (e.g. a `nxx::poly::MultiPolynomial`; see
+     * `multiroots::MultiFunction::hasGradient`), the rows are the exact gradients. Otherwise, the derivative computation
+     * utilizes the `Order1CentralRichardson` algorithm, which is suitable for first-order derivative calculations. This
+     * algorithm choice provides a balance between computational efficiency and accuracy for most use cases.
      *
      * @throws std::runtime_error If the derivative computation algorithm fails.
      */
     template< typename RES_T, typename PARAM_T, typename CONTAINER_T >
     blaze::DynamicMatrix< RES_T > jacobian(const multiroots::MultiFunctionArray< RES_T, PARAM_T >& functions, const CONTAINER_T& point)
     {
-        return multidiff< Order1CentralRichardson >(functions, point);
+        if (!functions.hasGradients()) return multidiff< Order1CentralRichardson >(functions, point);
+
+        const std::vector< RES_T >    args(point.begin(), point.end());
+        std::vector< RES_T >          gradient(args.size());
+        blaze::DynamicMatrix< RES_T > J(functions.size(), args.size());
+
+        size_t row = 0;
+        for (const auto& func : functions) {
+            func.gradient(args, gradient);
+            for (size_t col = 0; col < args.size(); ++col) J(row, col) = gradient[col];
+            ++row;
+        }
+
+        return J;
     }
 
     /**
@@ -434,9 +448,8 @@ namespace nxx::deriv
      * offering a more concise and readable way to define the point.
      *
      * The function internally converts the initializer list into a `std::vector` and then delegates the Jacobian matrix computation
-     * to the `multidiff` function template, using the `Order1CentralRichardson` algorithm. This approach maintains the consistency
-     * of using a first-order central difference method (Richardson extrapolation) for calculating the Jacobian, balancing accuracy
-     * and computational efficiency.
+     * to the `jacobian` function template that takes a container, which uses the exact gradients if available and a first-order
+     * central difference method (Richardson extrapolation) otherwise.
      *
      * @throws std::runtime_error If the derivative computation algorithm fails.
      */
@@ -444,7 +457,7 @@ namespace nxx::deriv
     blaze::DynamicMatrix< RES_T > jacobian(const multiroots::MultiFunctionArray< RES_T, PARAM_T >& functions,
                                            const std::initializer_list< RES_T >&                   point)
     {
-        return multidiff< Order1CentralRichardson >(functions, std::vector< RES_T >(point));
+        return jacobian(functions, std::vector< RES_T >(point));
     }
 
     /**
@@ -17,6 +17,16 @@
 
 namespace nxx::multiroots
 {
+    /**
+     * @brief Concept for callables that also provide their exact gradient, such as nxx::poly::MultiPolynomial.
+     *
+     * @details The callable must have a member function gradient(point, out), which writes the partial derivatives
+     *          at the point to out. The return value, if any, is ignored.
+     */
+    template< typename CALLABLE_T, typename RES_T >
+    concept HasGradient = requires(const CALLABLE_T& func, std::span< const RES_T > point, std::span< RES_T > out) {
+        func.gradient(point, out);
+    };
 
     /**
      * @brief A class template to encapsulate a multi-dimensional function for root finding.
@@ -34,12 +44,14 @@ namespace nxx::multiroots
     class MultiFunction
     {
     public:
-        using FUNC_T = std::function< RES_T(std::span< PARAM_T >) >;    ///< Type of the encapsulated function.
+        using FUNC_T     = std::function< RES_T(std::span< PARAM_T >) >;                               ///< Type of the encapsulated function.
+        using GRADIENT_T = std::function< void(std::span< const RES_T >, std::span< RES_T >) >;    ///< Type of the exact gradient, if any.
 
         /**
          * @brief Constructs a MultiFunction object with a given callable.
          *
          * @details This constructor wraps a given callable, ensuring it has a compatible signature.
+         *          If the callable provides its exact gradient (see HasGradient), the gradient is wrapped as well.
          *
          * @tparam CALLABLE_T The type of the callable to be wrapped.
          * @param  f The callable object to be wrapped.
@@ -51,7 +63,10 @@ namespace nxx::multiroots
              std::is_same_v< typename traits::FunctionTraits< CALLABLE_T >::argument_type, std::span< const std::remove_cvref_t< PARAM_T > > >))
         MultiFunction(CALLABLE_T f)
             : function(f)
-        {}
+        {
+            if constexpr (HasGradient< CALLABLE_T, RES_T >)
+                gradientFunction = [f](std::span< const RES_T > point, std::span< RES_T > out) { f.gradient(point, out); };
+        }
 
         MultiFunction(const MultiFunction&) = default;
         MultiFunction(MultiFunction&&)      = default;
@@ -143,8 +158,26 @@ namespace nxx::multiroots
             return function(span);
         }
 
+        /**
+         * @brief Checks if the function provides its exact gradient.
+         *
+         * @return true if gradient() can be called, false if the derivatives must be approximated.
+         */
+        bool hasGradient() const { return static_cast< bool >(gradientFunction); }
+
+        /**
+         * @brief Computes the exact gradient of the function.
+         *
+         * @param point The point at which to compute the gradient.
+         * @param out The destination for the partial derivatives; must have the same size as the point.
+         *
+         * @note Requires hasGradient() to be true.
+         */
+        void gradient(std::span< const RES_T > point, std::span< RES_T > out) const { gradientFunction(point, out); }
+
     private:
-        FUNC_T function;    ///< The internal function object.
+        FUNC_T     function;            ///< The internal function object.
+        GRADIENT_T gradientFunction;    ///< The exact gradient of the function, if provided by the callable.
     };
 
     /**
@@ -41,6 +41,7 @@
 #ifndef NUMERIXX_MULTIFUNCTIONARRAY_HPP
 #define NUMERIXX_MULTIFUNCTIONARRAY_HPP
 
+#include <algorithm>
 #include <concepts>
 #include <initializer_list>
 #include <stdexcept>
@@ -290,6 +291,15 @@ namespace nxx::multiroots
          */
         auto size() const { return functions.size(); }
 
+        /**
+         * @brief Checks if all the functions provide their exact gradients, so that the Jacobian can be computed exactly.
+         * @return bool true if the array is non-empty and every function has a gradient.
+         */
+        bool hasGradients() const
+        {
+            return !functions.empty() && std::all_of(functions.begin(), functions.end(), [](const auto& func) { return func.hasGradient(); });
+        }
+
     private:
         std::vector< FUNC_T > functions;    ///< Internal storage for function objects.
 
@@ -32,6 +32,19 @@
 #define NUMERIXX_POLY_HPP
 
 #include "impl/Polynomial.hpp"
+#include "impl/StaticPolynomial.hpp"
+#include "impl/PolyBatch.hpp"
+#include "impl/PolyBank.hpp"
+#include "impl/PolyGrid.hpp"
+#include "impl/PolySubproductTree.hpp"
+#include "impl/PolyMatrix.hpp"
+#include "impl/MultiPolynomial.hpp"
+#include "impl/PolyOrthogonal.hpp"
 #include "impl/Polyroots.hpp"
+#include "impl/PolyContinuation.hpp"
+#include "impl/PolySquareFree.hpp"
+#include "impl/PolyAdaptive.hpp"
+#include "impl/ChebyshevSeries.hpp"
+#include "impl/PolyRational.hpp"
 
 #endif    // NUMERIXX_POLY_HPP
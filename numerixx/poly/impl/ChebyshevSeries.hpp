@@ -0,0 +1,777 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+#ifndef NUMERIXX_CHEBYSHEVSERIES_HPP
+#define NUMERIXX_CHEBYSHEVSERIES_HPP
+
+// ===== Numerixx Includes
+#include "PolyCompanion.hpp"
+#include "PolyEvaluation.hpp"
+#include "PolyMultiplication.hpp"
+#include "Polynomial.hpp"
+#include "Polyroots.hpp"
+#include <Concepts.hpp>
+#include <Error.hpp>
+
+// ===== External Includes
+#include <tl/expected.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <vector>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief The number of coefficients up to which the basis conversions use the quadratic algorithms.
+         *
+         * Larger series are split in halves, which are converted recursively and combined using the fast
+         * multiplication kernels (see detail::multiply).
+         */
+        inline constexpr std::size_t CHEBYSHEV_CONVERSION_THRESHOLD = 32;
+
+        /**
+         * @brief The number of points evaluated together by clenshawBatch().
+         *
+         * @note Unlike Horner's method, Clenshaw's recurrence carries two values per point. With the lane count
+         * of hornerBatch(), the compiler unrolls the lane loops completely, and then fails to vectorise them; with
+         * a larger block, the lane loops are vectorised as loops. See BM_ChebyshevEvaluateBatch.
+         */
+        inline constexpr std::size_t CLENSHAW_BATCH_LANES = 32;
+
+        /**
+         * @brief Evaluates a Chebyshev series at a point of [-1, 1], using Clenshaw's recurrence.
+         *
+         * The recurrence b_k = c_k + 2t b_{k+1} - b_{k+2} is the Chebyshev analogue of Horner's method. It
+         * works on the coefficients directly, so no conversion to the monomial basis is needed, and it is
+         * numerically stable for all t in [-1, 1].
+         *
+         * @param coeffs The Chebyshev coefficients c_0, ..., c_n. Must not be empty.
+         * @param t The point at which to evaluate the series.
+         * @return The value of the series at t.
+         */
+        template< typename TYPE, typename T >
+        inline TYPE clenshawEval(std::span< const T > coeffs, TYPE t)
+        {
+            TYPE b1 {};
+            TYPE b2 {};
+            for (std::size_t k = coeffs.size(); k-- > 1;) {
+                const TYPE b0 = fmadd(TYPE(2) * t, b1, static_cast< TYPE >(coeffs[k]) - b2);
+                b2            = b1;
+                b1            = b0;
+            }
+            return fmadd(t, b1, static_cast< TYPE >(coeffs[0]) - b2);
+        }
+
+        /**
+         * @brief Evaluates a Chebyshev series at a range of points, running Clenshaw's recurrence across
+         * a block of CLENSHAW_BATCH_LANES points at once (see hornerBatch()).
+         *
+         * @param coeffs The Chebyshev coefficients c_0, ..., c_n. Must not be empty.
+         * @param x The points at which to evaluate the series. Each point is mapped to t = scale * x + shift.
+         * @param out The destination of the results. Must have the same size as x.
+         * @param scale The scale of the map to [-1, 1].
+         * @param shift The shift of the map to [-1, 1].
+         */
+        template< typename T >
+        inline void clenshawBatch(std::span< const T > coeffs, std::span< const T > x, std::span< T > out, T scale, T shift)
+        {
+            const std::size_t n = coeffs.size();
+
+            std::size_t i = 0;
+            for (; i + CLENSHAW_BATCH_LANES <= x.size(); i += CLENSHAW_BATCH_LANES) {
+                T b1[CLENSHAW_BATCH_LANES] {};
+                T b2[CLENSHAW_BATCH_LANES] {};
+                T arg[CLENSHAW_BATCH_LANES];
+                for (std::size_t l = 0; l < CLENSHAW_BATCH_LANES; ++l) arg[l] = T(2) * (scale * x[i + l] + shift);
+
+                // ===== The plain expression is used rather than fmadd(), as explicit fma calls prevent the compiler
+                // ===== from vectorising across the lanes. Contraction to an FMA is left to the compiler.
+                for (std::size_t k = n; k-- > 1;) {
+                    const T coeff = coeffs[k];
+                    for (std::size_t l = 0; l < CLENSHAW_BATCH_LANES; ++l) {
+                        const T b0 = arg[l] * b1[l] + (coeff - b2[l]);
+                        b2[l]      = b1[l];
+                        b1[l]      = b0;
+                    }
+                }
+
+                for (std::size_t l = 0; l < CLENSHAW_BATCH_LANES; ++l) out[i + l] = T(0.5) * arg[l] * b1[l] + (coeffs[0] - b2[l]);
+            }
+
+            for (; i < x.size(); ++i) out[i] = clenshawEval(coeffs, fmadd(scale, x[i], shift));
+        }
+
+        /**
+         * @brief Computes the Chebyshev coefficients of the derivative of a Chebyshev series.
+         *
+         * Uses the recurrence d_{k-1} = d_{k+1} + 2k c_k, with d_0 halved at the end.
+         *
+         * @param coeffs The Chebyshev coefficients c_0, ..., c_n, with n >= 1.
+         * @param out The destination for d_0, ..., d_{n-1}.
+         */
+        template< typename T >
+        inline void chebyshevDerivative(std::span< const T > coeffs, std::span< T > out)
+        {
+            const std::size_t n = coeffs.size() - 1;
+            T                 next {};    // d_{k+1}
+            T                 curr {};    // d_k
+            for (std::size_t k = n; k >= 1; --k) {
+                const T prev = next + T(2 * k) * coeffs[k];
+                out[k - 1]   = prev;
+                next         = curr;
+                curr         = prev;
+            }
+            out[0] /= T(2);
+        }
+
+        /**
+         * @brief Computes the Chebyshev coefficients of the antiderivative of a Chebyshev series, which is zero at -1.
+         *
+         * Uses C_k = (c_{k-1} - c_{k+1}) / 2k for k >= 2, and C_1 = c_0 - c_2 / 2. C_0 is chosen so that the
+         * antiderivative is zero at t = -1, where T_k(-1) = (-1)^k.
+         *
+         * @param coeffs The Chebyshev coefficients c_0, ..., c_n.
+         * @param out The destination for C_0, ..., C_{n+1}.
+         */
+        template< typename T >
+        inline void chebyshevIntegral(std::span< const T > coeffs, std::span< T > out)
+        {
+            const std::size_t n     = coeffs.size() - 1;
+            auto              coeff = [&](std::size_t k) { return k <= n ? coeffs[k] : T {}; };
+
+            out[1] = coeff(0) - coeff(2) / T(2);
+            for (std::size_t k = 2; k <= n + 1; ++k) out[k] = (coeff(k - 1) - coeff(k + 1)) / T(2 * k);
+
+            T value {};
+            for (std::size_t k = 1; k <= n + 1; ++k) value += (k % 2 == 0 ? out[k] : -out[k]);
+            out[0] = -value;
+        }
+
+        /**
+         * @brief Multiplies two Chebyshev series, using T_i T_j = (T_{i+j} + T_{|i-j|}) / 2.
+         *
+         * The T_{i+j} terms form a convolution of the coefficients, and the T_{|i-j|} terms a correlation,
+         * which is a convolution with the reversed coefficients. Both are computed by detail::multiply, so the
+         * cost is that of two polynomial products.
+         *
+         * @param u The coefficients of the first series. Must not be empty.
+         * @param v The coefficients of the second series. Must not be empty.
+         * @param out The destination; must hold u.size() + v.size() - 1 elements. It is overwritten.
+         */
+        template< typename T >
+        inline void chebyshevProduct(std::span< const T > u, std::span< const T > v, std::span< T > out)
+        {
+            const std::size_t nu = u.size();
+            const std::size_t nv = v.size();
+
+            std::vector< T > reversed(v.rbegin(), v.rend());
+            std::vector< T > correlation(nu + nv - 1);
+            multiply(u, v, out);
+            multiply(u, std::span< const T >(reversed), std::span< T >(correlation));
+
+            // ===== correlation[d + nv - 1] holds the sum of u_i v_j over i - j = d.
+            out[0] = (out[0] + correlation[nv - 1]) / T(2);
+            for (std::size_t k = 1; k < nu + nv - 1; ++k) {
+                T sum = out[k];
+                if (k < nu) sum += correlation[k + nv - 1];
+                if (k < nv) sum += correlation[nv - 1 - k];
+                out[k] = sum / T(2);
+            }
+        }
+
+        /**
+         * @brief Converts a Chebyshev series in t = scale * x + shift to the monomial basis in x.
+         *
+         * Short series are converted with Clenshaw's recurrence run on polynomials, at a cost of O(n^2).
+         * Longer series are split at a power of two m, using T_{m+j} = 2 T_m T_j - T_{m-j}:
+         *
+         *      sum c_k T_k = (sum_{k <= m} c_k T_k - sum_{k > m} c_k T_{2m-k}) + 2 T_m sum_{k > m} c_k T_{k-m},
+         *
+         * and the two halves are converted recursively, and combined using the monomial form of T_m. With the
+         * FFT based multiplication, the cost is O(n log^2 n).
+         *
+         * @param coeffs The Chebyshev coefficients. Must not be empty.
+         * @param out The destination for the monomial coefficients; must have the same size as coeffs.
+         * @param powers The monomial forms of T_1, T_2, T_4, ... in x, computed on demand.
+         */
+        template< typename T >
+        inline void chebyshevToMonomial(std::span< const T > coeffs, std::span< T > out, std::vector< std::vector< T > >& powers)
+        {
+            const std::size_t n = coeffs.size();
+            const auto&       t = powers.front();    // T_1 = shift + scale * x
+
+            if (n <= CHEBYSHEV_CONVERSION_THRESHOLD) {
+                // ===== b_k = c_k + 2t b_{k+1} - b_{k+2}, with polynomial valued b_k of degree n - 1 - k.
+                std::vector< T > b1(n);
+                std::vector< T > b2(n);
+                std::vector< T > b0(n);
+                for (std::size_t k = n; k-- > 1;) {
+                    const std::size_t deg = n - 1 - k;
+                    b0[0]                 = T(2) * t[0] * b1[0] - b2[0];
+                    for (std::size_t j = 1; j <= deg; ++j) b0[j] = T(2) * (t[0] * b1[j] + t[1] * b1[j - 1]) - b2[j];
+                    b0[0] += coeffs[k];
+                    std::swap(b2, b1);
+                    std::swap(b1, b0);
+                }
+                out[0] = coeffs[0] + t[0] * b1[0] - b2[0];
+                for (std::size_t j = 1; j < n; ++j) out[j] = t[0] * b1[j] + t[1] * b1[j - 1] - b2[j];
+                return;
+            }
+
+            // ===== Split at m, the largest power of two below the degree, so that n - 1 <= 2m.
+            const std::size_t degree = n - 1;
+            const std::size_t m      = std::bit_ceil(degree) / 2;
+            const std::size_t level  = static_cast< std::size_t >(std::countr_zero(m));
+            while (powers.size() <= level) {
+                const auto&      last = powers.back();
+                std::vector< T > next(2 * last.size() - 1);
+                multiply(std::span< const T >(last), std::span< const T >(last), std::span< T >(next));
+                for (auto& coeff : next) coeff *= T(2);
+                next[0] -= T(1);
+                powers.push_back(std::move(next));
+            }
+
+            std::vector< T > low(coeffs.begin(), coeffs.begin() + static_cast< std::ptrdiff_t >(m + 1));
+            std::vector< T > high(degree - m + 1);
+            for (std::size_t k = m + 1; k <= degree; ++k) {
+                low[2 * m - k] -= coeffs[k];
+                high[k - m] = coeffs[k];
+            }
+
+            std::vector< T > lowMonomial(low.size());
+            std::vector< T > highMonomial(high.size());
+            chebyshevToMonomial(std::span< const T >(low), std::span< T >(lowMonomial), powers);
+            chebyshevToMonomial(std::span< const T >(high), std::span< T >(highMonomial), powers);
+
+            multiply(std::span< const T >(highMonomial), std::span< const T >(powers[level]), out);
+            for (std::size_t k = 0; k < n; ++k) out[k] *= T(2);
+            for (std::size_t k = 0; k < lowMonomial.size(); ++k) out[k] += lowMonomial[k];
+        }
+
+        /**
+         * @brief Converts a polynomial in the monomial basis in x to a Chebyshev series in t, where x = scale * t + shift.
+         *
+         * Short polynomials are converted with Horner's method carried out in the Chebyshev basis, using
+         * t T_0 = T_1 and t T_k = (T_{k-1} + T_{k+1}) / 2, at a cost of O(n^2). Longer polynomials are split as
+         * p = L + x^m H at a power of two m, and the halves are converted recursively and combined with the
+         * Chebyshev form of x^m, using chebyshevProduct(). The cost is O(n log^2 n).
+         *
+         * @param coeffs The monomial coefficients. Must not be empty.
+         * @param out The destination for the Chebyshev coefficients; must have the same size as coeffs.
+         * @param powers The Chebyshev forms of x, x^2, x^4, ... in t, computed on demand.
+         */
+        template< typename T >
+        inline void monomialToChebyshev(std::span< const T > coeffs, std::span< T > out, std::vector< std::vector< T > >& powers)
+        {
+            const std::size_t n = coeffs.size();
+            const auto&       x = powers.front();    // x = shift T_0 + scale T_1
+
+            if (n <= CHEBYSHEV_CONVERSION_THRESHOLD) {
+                std::vector< T > next(n);
+                std::fill(out.begin(), out.end(), T {});
+                out[0] = coeffs[n - 1];
+                for (std::size_t j = n - 1; j-- > 0;) {
+                    // ===== out = out * x + a_j, where out has degree n - 2 - j before the multiplication.
+                    const std::size_t deg = n - 2 - j;
+                    std::fill(next.begin(), next.begin() + static_cast< std::ptrdiff_t >(deg + 2), T {});
+                    for (std::size_t k = 0; k <= deg; ++k) {
+                        next[k] += x[0] * out[k];
+                        if (k == 0)
+                            next[1] += x[1] * out[0];
+                        else {
+                            next[k - 1] += x[1] * out[k] / T(2);
+                            next[k + 1] += x[1] * out[k] / T(2);
+                        }
+                    }
+                    next[0] += coeffs[j];
+                    std::copy(next.begin(), next.begin() + static_cast< std::ptrdiff_t >(deg + 2), out.begin());
+                }
+                return;
+            }
+
+            // ===== Split at m, the largest power of two below n, so that n <= 2m.
+            const std::size_t m     = std::bit_ceil(n) / 2;
+            const std::size_t level = static_cast< std::size_t >(std::countr_zero(m));
+            while (powers.size() <= level) {
+                const auto&      last = powers.back();
+                std::vector< T > next(2 * last.size() - 1);
+                chebyshevProduct(std::span< const T >(last), std::span< const T >(last), std::span< T >(next));
+                powers.push_back(std::move(next));
+            }
+
+            std::vector< T > low(m);
+            std::vector< T > high(n - m);
+            monomialToChebyshev(coeffs.first(m), std::span< T >(low), powers);
+            monomialToChebyshev(coeffs.subspan(m), std::span< T >(high), powers);
+
+            chebyshevProduct(std::span< const T >(high), std::span< const T >(powers[level]), out);
+            for (std::size_t k = 0; k < m; ++k) out[k] += low[k];
+        }
+
+        /**
+         * @brief Computes the Chebyshev coefficients of the interpolant through values at the Chebyshev points.
+         *
+         * The points are the n + 1 Chebyshev extreme points t_j = cos(pi j / n), j = 0, ..., n, and the
+         * coefficients are given by a type I discrete cosine transform of the values. If 2n is a power of two,
+         * the transform is computed with the FFT, by extending the values to an even sequence of length 2n, at
+         * a cost of O(n log n); otherwise, it is computed directly, at a cost of O(n^2).
+         *
+         * @param values The values f(t_0), ..., f(t_n), with n >= 1.
+         * @param out The destination for the coefficients c_0, ..., c_n.
+         */
+        template< typename T >
+        inline void chebyshevFromValues(std::span< const T > values, std::span< T > out)
+        {
+            using FLOAT_T   = typename FundamentalType< T >::type;
+            using COMPLEX_T = std::complex< FLOAT_T >;
+
+            const std::size_t n     = values.size() - 1;
+            const FLOAT_T     scale = FLOAT_T(1) / static_cast< FLOAT_T >(n);
+
+            if (std::has_single_bit(2 * n) && !IsComplex< T >) {
+                std::vector< COMPLEX_T > data(2 * n);
+                for (std::size_t j = 0; j <= n; ++j) data[j] = values[j];
+                for (std::size_t j = 1; j < n; ++j) data[2 * n - j] = values[j];
+                fft(std::span< COMPLEX_T >(data), false);
+                for (std::size_t k = 0; k <= n; ++k) out[k] = static_cast< T >(data[k].real() * scale);
+            }
+            else {
+                for (std::size_t k = 0; k <= n; ++k) {
+                    T sum = (values[0] + (k % 2 == 0 ? values[n] : -values[n])) / FLOAT_T(2);
+                    for (std::size_t j = 1; j < n; ++j)
+                        sum += values[j] * std::cos(std::numbers::pi_v< FLOAT_T > * static_cast< FLOAT_T >(j * k % (2 * n)) * scale);
+                    out[k] = sum * FLOAT_T(2) * scale;
+                }
+            }
+
+            out[0] /= FLOAT_T(2);
+            out[n] /= FLOAT_T(2);
+        }
+
+    }    // namespace detail
+
+    /**
+     * @brief A class representing a series c_0 T_0(t) + c_1 T_1(t) + ... + c_n T_n(t) of Chebyshev polynomials.
+     *
+     * The series is defined on an interval [lower, upper], which is mapped to t in [-1, 1] by
+     * t = (2x - (lower + upper)) / (upper - lower). On that interval, the Chebyshev basis is far better
+     * conditioned than the monomial basis, so fitted correlations and interpolants can be evaluated,
+     * differentiated, integrated and solved at high degree without converting them to a Polynomial.
+     *
+     * The series is evaluated with Clenshaw's recurrence, and its roots are computed as the eigenvalues of
+     * the colleague matrix (see polysolve()). Trailing coefficients that are zero within machine precision
+     * are removed, like for Polynomial.
+     *
+     * @tparam T The type of the coefficients. Must be a floating point type or a complex type.
+     */
+    template< typename T = double >
+        requires nxx::IsFloat< T > || IsComplex< T >
+    class ChebyshevSeries final
+    {
+    public:
+        /**
+         * @brief The type of the coefficients.
+         */
+        using value_type = T;
+
+        /**
+         * @brief The floating point type of the interval bounds.
+         */
+        using fundamental_type = typename detail::FundamentalType< T >::type;
+
+    private:
+        std::vector< T >  m_coefficients;        /**< The Chebyshev coefficients, in increasing order of degree. */
+        fundamental_type m_lower { -1 };        /**< The lower bound of the interval. */
+        fundamental_type m_upper { 1 };         /**< The upper bound of the interval. */
+
+        /**
+         * @brief Removes trailing near-zero coefficients, keeping at least one coefficient.
+         */
+        void trim()
+        {
+            constexpr auto epsilon = std::numeric_limits< fundamental_type >::epsilon();
+            while (m_coefficients.size() > 1 && std::norm(m_coefficients.back()) <= epsilon * epsilon) m_coefficients.pop_back();
+            if (m_coefficients.empty()) m_coefficients.push_back(T {});
+        }
+
+        /**
+         * @brief Validates the interval of the series.
+         */
+        void validateInterval() const
+        {
+            if (!(m_lower < m_upper)) throw NumerixxError("The interval of a Chebyshev series must have lower < upper.");
+        }
+
+    public:
+        /**
+         * @brief Constructs a zero series on [-1, 1].
+         */
+        ChebyshevSeries()
+            : m_coefficients { T {} }
+        {}
+
+        /**
+         * @brief Constructs a Chebyshev series from a container of coefficients.
+         *
+         * @param coefficients The Chebyshev coefficients c_0, c_1, ..., in increasing order of degree.
+         * @param lower The lower bound of the interval. Defaults to -1.
+         * @param upper The upper bound of the interval. Defaults to 1.
+         *
+         * @throws NumerixxError if lower is not less than upper.
+         */
+        explicit ChebyshevSeries(const IsCoefficientContainer auto& coefficients, fundamental_type lower = -1, fundamental_type upper = 1)
+            : m_coefficients(coefficients.begin(), coefficients.end()),
+              m_lower { lower },
+              m_upper { upper }
+        {
+            validateInterval();
+            trim();
+        }
+
+        /**
+         * @brief Constructs a Chebyshev series on [-1, 1] from an initializer list of coefficients.
+         */
+        ChebyshevSeries(std::initializer_list< T > coefficients)
+            : ChebyshevSeries(std::vector< T >(coefficients))
+        {}
+
+        /**
+         * @brief Returns the order of the series, i.e. the degree of its highest Chebyshev polynomial.
+         */
+        [[nodiscard]]
+        auto order() const
+        {
+            return m_coefficients.size() - 1;
+        }
+
+        /**
+         * @brief Returns the Chebyshev coefficients, in increasing order of degree.
+         */
+        [[nodiscard]]
+        const std::vector< T >& coefficients() const
+        {
+            return m_coefficients;
+        }
+
+        /**
+         * @brief Returns the lower bound of the interval.
+         */
+        [[nodiscard]]
+        fundamental_type lower() const
+        {
+            return m_lower;
+        }
+
+        /**
+         * @brief Returns the upper bound of the interval.
+         */
+        [[nodiscard]]
+        fundamental_type upper() const
+        {
+            return m_upper;
+        }
+
+        /**
+         * @brief Maps a point of the interval to [-1, 1].
+         */
+        template< typename U >
+        [[nodiscard]]
+        U toStandard(U x) const
+        {
+            return (U(2) * x - U(m_lower + m_upper)) / U(m_upper - m_lower);
+        }
+
+        /**
+         * @brief Maps a point of [-1, 1] to the interval.
+         */
+        template< typename U >
+        [[nodiscard]]
+        U fromStandard(U t) const
+        {
+            return (U(m_upper - m_lower) * t + U(m_lower + m_upper)) / U(2);
+        }
+
+        /**
+         * @brief Evaluates the series at a given value. See evaluate().
+         */
+        inline auto operator()(auto value) const { return *evaluate(value); }
+
+        /**
+         * @brief Evaluates the series at a given point, using Clenshaw's recurrence.
+         *
+         * @param value The point at which to evaluate the series. Points outside the interval are allowed,
+         * but the evaluation is only guaranteed to be stable inside it.
+         * @return The value of the series, or an error if the result is non-finite.
+         */
+        template< typename U >
+            requires std::convertible_to< U, T > || nxx::IsFloat< U > || IsComplex< U >
+        [[nodiscard]]
+        inline auto evaluate(U value) const
+            -> tl::expected< std::common_type_t< T, U >, Error< detail::PolyErrorData< std::common_type_t< T, U > > > >
+        {
+            using TYPE      = std::common_type_t< T, U >;
+            using PolyError = Error< detail::PolyErrorData< TYPE > >;
+
+            const TYPE result = detail::clenshawEval(std::span< const T >(m_coefficients), toStandard(static_cast< TYPE >(value)));
+
+            if (!detail::isFinite(result)) [[unlikely]]
+                return tl::unexpected(PolyError("Polynomial error",
+                                                nxx::NumerixxErrorType::Poly,
+                                                { .details      = "Chebyshev series evaluation failed; non-finite result.",
+                                                  .coefficients = { m_coefficients.begin(), m_coefficients.end() },
+                                                  .arg          = value,
+                                                  .result       = result }));
+
+            return result;
+        }
+
+        /**
+         * @brief Evaluates the series at a range of points in a single batched pass.
+         *
+         * Clenshaw's recurrence is run across several points at once (see detail::clenshawBatch). As for
+         * Polynomial::evaluate, errors are reported as one aggregate status for the whole batch.
+         *
+         * @param x The points at which to evaluate the series.
+         * @param out The destination of the results. Must have the same size as `x`.
+         * @return An empty expected on success, or an error if any of the results is non-finite.
+         *
+         * @throws NumerixxError if the sizes of `x` and `out` differ.
+         */
+        [[nodiscard]]
+        auto evaluate(std::span< const T > x, std::span< T > out) const -> tl::expected< void, Error< detail::PolyErrorData< T > > >
+        {
+            using PolyError = Error< detail::PolyErrorData< T > >;
+
+            if (x.size() != out.size())
+                throw NumerixxError("Batch evaluation requires the input and output ranges to be of equal size.");
+
+            const T scale = T(2) / T(m_upper - m_lower);
+            const T shift = -T(m_lower + m_upper) / T(m_upper - m_lower);
+            detail::clenshawBatch(std::span< const T >(m_coefficients), x, out, scale, shift);
+
+            const auto failures = std::count_if(out.begin(), out.end(), [](const T& val) { return !detail::isFinite(val); });
+            if (failures > 0) [[unlikely]] {
+                const auto pos = std::find_if(out.begin(), out.end(), [](const T& val) { return !detail::isFinite(val); }) - out.begin();
+                return tl::unexpected(PolyError("Polynomial error",
+                                                nxx::NumerixxErrorType::Poly,
+                                                { .details = "Batch Chebyshev series evaluation failed; " + std::to_string(failures) +
+                                                             " non-finite result(s).",
+                                                  .coefficients = { m_coefficients.begin(), m_coefficients.end() },
+                                                  .arg          = x[static_cast< std::size_t >(pos)],
+                                                  .result       = out[static_cast< std::size_t >(pos)] }));
+            }
+
+            return {};
+        }
+
+        /**
+         * @brief Converts the series to a Polynomial in x, i.e. in the monomial basis.
+         *
+         * The conversion uses a divide and conquer algorithm with a cost of O(n log^2 n) (see
+         * detail::chebyshevToMonomial).
+         *
+         * @note The monomial coefficients of T_n grow like 2^n, so the conversion loses accuracy at high
+         * degree. Where possible, evaluate and solve the series directly.
+         */
+        [[nodiscard]]
+        Polynomial< T > toPolynomial() const
+        {
+            const T scale = T(2) / T(m_upper - m_lower);
+            const T shift = -T(m_lower + m_upper) / T(m_upper - m_lower);
+
+            std::vector< std::vector< T > > powers { { shift, scale } };
+            std::vector< T >                coeffs(m_coefficients.size());
+            detail::chebyshevToMonomial(std::span< const T >(m_coefficients), std::span< T >(coeffs), powers);
+            return Polynomial< T >(std::move(coeffs));
+        }
+
+        /**
+         * @brief Equality operator. Two series are equal if their intervals and coefficients are equal.
+         */
+        bool operator==(const ChebyshevSeries& rhs) const = default;
+
+        auto begin() const { return m_coefficients.cbegin(); }
+        auto end() const { return m_coefficients.cend(); }
+    };
+
+    /*
+     * Deduction guides.
+     */
+    template< typename CONTAINER >
+        requires IsCoefficientContainer< CONTAINER >
+    ChebyshevSeries(CONTAINER, auto...) -> ChebyshevSeries< typename CONTAINER::value_type >;
+
+    template< typename T >
+        requires nxx::IsFloat< T > || IsComplex< T >
+    ChebyshevSeries(std::initializer_list< T >) -> ChebyshevSeries< T >;
+
+    /**
+     * @brief Converts a Polynomial to a Chebyshev series on the interval [lower, upper].
+     *
+     * The conversion uses a divide and conquer algorithm with a cost of O(n log^2 n) (see
+     * detail::monomialToChebyshev). Unlike the reverse conversion, it is well conditioned.
+     *
+     * @param poly The polynomial to convert.
+     * @param lower The lower bound of the interval. Defaults to -1.
+     * @param upper The upper bound of the interval. Defaults to 1.
+     * @return The Chebyshev series, which equals the polynomial everywhere.
+     */
+    template< typename T >
+    ChebyshevSeries< T > toChebyshev(const Polynomial< T >&                                 poly,
+                                     typename ChebyshevSeries< T >::fundamental_type lower = -1,
+                                     typename ChebyshevSeries< T >::fundamental_type upper = 1)
+    {
+        if (!(lower < upper)) throw NumerixxError("The interval of a Chebyshev series must have lower < upper.");
+
+        const T scale = T(upper - lower) / T(2);
+        const T shift = T(upper + lower) / T(2);
+
+        std::vector< std::vector< T > > powers { { shift, scale } };
+        std::vector< T >                coeffs(poly.order() + 1);
+        detail::monomialToChebyshev(std::span< const T >(poly.coefficients()), std::span< T >(coeffs), powers);
+        return ChebyshevSeries< T >(coeffs, lower, upper);
+    }
+
+    /**
+     * @brief Interpolates a function on [lower, upper] by a Chebyshev series, at the Chebyshev points.
+     *
+     * The function is sampled at the order + 1 Chebyshev extreme points of the interval, and the coefficients
+     * are computed by a discrete cosine transform (see detail::chebyshevFromValues), which uses the FFT when
+     * the order is a power of two. For smooth functions, the coefficients decay quickly, and the interpolant
+     * is close to the best polynomial approximation of the given order.
+     *
+     * @param function The function to interpolate.
+     * @param order The order of the series. Must be at least one.
+     * @param lower The lower bound of the interval.
+     * @param upper The upper bound of the interval.
+     * @return The interpolating Chebyshev series.
+     */
+    template< std::floating_point T = double >
+    ChebyshevSeries< T > chebyshevInterpolate(std::invocable< T > auto function, std::size_t order, T lower = -1, T upper = 1)
+    {
+        if (order < 1) throw NumerixxError("Chebyshev interpolation requires an order of at least one.");
+        if (!(lower < upper)) throw NumerixxError("The interval of a Chebyshev series must have lower < upper.");
+
+        std::vector< T > values(order + 1);
+        for (std::size_t j = 0; j <= order; ++j) {
+            const T t = std::cos(std::numbers::pi_v< T > * static_cast< T >(j) / static_cast< T >(order));
+            values[j] = static_cast< T >(function(((upper - lower) * t + (upper + lower)) / T(2)));
+        }
+
+        std::vector< T > coeffs(order + 1);
+        detail::chebyshevFromValues(std::span< const T >(values), std::span< T >(coeffs));
+        return ChebyshevSeries< T >(coeffs, lower, upper);
+    }
+
+    /**
+     * @brief Computes the derivative of a Chebyshev series, in coefficient space.
+     *
+     * @param func The series to differentiate.
+     * @return A Chebyshev series on the same interval, holding the derivative.
+     */
+    template< typename T >
+    ChebyshevSeries< T > derivativeOf(const ChebyshevSeries< T >& func)
+    {
+        if (func.order() == 0) return ChebyshevSeries< T >(std::vector< T > { T {} }, func.lower(), func.upper());
+
+        std::vector< T > coeffs(func.order());
+        detail::chebyshevDerivative(std::span< const T >(func.coefficients()), std::span< T >(coeffs));
+
+        const T scale = T(2) / T(func.upper() - func.lower());
+        for (auto& coeff : coeffs) coeff *= scale;
+        return ChebyshevSeries< T >(coeffs, func.lower(), func.upper());
+    }
+
+    /**
+     * @brief Computes the antiderivative of a Chebyshev series which is zero at the lower bound, in coefficient space.
+     *
+     * @param func The series to integrate.
+     * @return A Chebyshev series on the same interval, holding the antiderivative.
+     */
+    template< typename T >
+    ChebyshevSeries< T > integralOf(const ChebyshevSeries< T >& func)
+    {
+        std::vector< T > coeffs(func.order() + 2);
+        detail::chebyshevIntegral(std::span< const T >(func.coefficients()), std::span< T >(coeffs));
+
+        const T scale = T(func.upper() - func.lower()) / T(2);
+        for (auto& coeff : coeffs) coeff *= scale;
+        return ChebyshevSeries< T >(coeffs, func.lower(), func.upper());
+    }
+
+    /**
+     * @brief Finds all roots of a Chebyshev series as the eigenvalues of its colleague matrix, using LAPACK.
+     *
+     * The roots are computed in the Chebyshev basis (see detail::colleagueRoots), and mapped back from
+     * [-1, 1] to the interval of the series. Roots outside the interval are also returned; for real series,
+     * the real roots on the interval are usually the ones of interest, and can be selected from the result.
+     *
+     * @tparam RT The desired return type for the roots. Defaults to void, which will return the same type as
+     * the coefficients. If RT is a floating point type, only the real roots are returned.
+     * @param series The Chebyshev series to solve. The coefficients must be based on float or double.
+     * @param tolerance The tolerance used to decide if a root is real. Defaults to nxx::EPS.
+     * @return A vector containing the sorted roots, or a NumerixxError if the QR algorithm did not converge.
+     *
+     * @throws NumerixxError if the order of the series is less than one.
+     */
+    template< typename RT = void, typename T >
+        requires detail::IsLapackType< T >
+    inline auto polysolve(const ChebyshevSeries< T >& series, typename ChebyshevSeries< T >::fundamental_type tolerance = nxx::EPS)
+    {
+        impl::validateTolerance(tolerance);
+        impl::validatePolynomialOrder(series.order(), 1ull);
+
+        using FLOAT_T    = typename ChebyshevSeries< T >::fundamental_type;
+        using COMPLEX_T  = std::complex< FLOAT_T >;
+        using RETURN_T   = std::conditional_t< std::same_as< RT, void >, T, RT >;
+        using EXPECTED_T = tl::expected< std::vector< RETURN_T >, NumerixxError >;
+
+        std::vector< COMPLEX_T > roots(series.order());
+        if (!detail::colleagueRoots(std::span< const T >(series.coefficients()), std::span< COMPLEX_T >(roots)))
+            return EXPECTED_T(tl::unexpected(NumerixxError("The QR algorithm failed to converge.")));
+
+        for (auto& root : roots) root = series.fromStandard(root);
+        return EXPECTED_T(impl::sortRoots< RETURN_T >(std::move(roots), tolerance));
+    }
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_CHEBYSHEVSERIES_HPP
@@ -0,0 +1,470 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_MULTIPOLYNOMIAL_HPP
+#define NUMERIXX_MULTIPOLYNOMIAL_HPP
+
+// ===== Numerixx Includes
+#include "PolyEvaluation.hpp"
+#include <Concepts.hpp>
+#include <Error.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief Computes x^n for a non-negative integer exponent, by binary exponentiation.
+         */
+        template< typename T >
+        constexpr T integerPower(T x, std::size_t n)
+        {
+            T result = 1;
+            while (n > 0) {
+                if (n & 1) result *= x;
+                n >>= 1;
+                if (n > 0) x *= x;
+            }
+            return result;
+        }
+    }    // namespace detail
+
+    /**
+     * @brief A sparse polynomial in several variables, with exact gradients and Hessians.
+     *
+     * The polynomial is stored as a list of terms c * x_0^e_0 * ... * x_{n-1}^e_{n-1}, and evaluated with a
+     * multivariate Horner scheme: p is written as a polynomial in x_0 whose coefficients are polynomials in
+     * x_1, ..., x_{n-1}, and so on recursively. The recursion is built once, as a tree with one node per distinct
+     * prefix of exponents, so that each evaluation takes one multiplication by a power of a variable and one
+     * addition per node, rather than a full product of powers per term.
+     *
+     * The gradient and the Hessian are propagated through the same sweep (forward mode), which gives them to
+     * working precision, at a cost of O(n) and O(n^2) per node, respectively.
+     *
+     * The call operator takes a std::span< const T >, and the class provides a gradient() member, so a
+     * MultiPolynomial can be added to a nxx::multiroots::MultiFunctionArray directly; the solvers then use the
+     * exact Jacobian rather than finite differences.
+     *
+     * @tparam T The type of the coefficients and the variables. Must be a floating point type or a complex type.
+     */
+    template< typename T >
+        requires nxx::IsFloat< T > || IsComplex< T >
+    class MultiPolynomial final
+    {
+        /**
+         * @brief A node of the Horner tree. The children of a node at depth v hold the polynomials in
+         * x_{v+1}, ..., x_{n-1} that multiply the powers of x_v.
+         */
+        struct Node
+        {
+            std::size_t first; /**< The index of the first child in m_children. */
+            std::size_t count; /**< The number of children. */
+        };
+
+        /**
+         * @brief A child of a node, i.e. one power of the variable of the node.
+         */
+        struct Child
+        {
+            std::size_t exponent; /**< The exponent of the variable of the node. */
+            std::size_t index;    /**< The index of the child in m_nodes or, below the last variable, of the coefficient in m_coefficients. */
+        };
+
+        std::size_t                m_variables {}; /**< The number of variables. */
+        std::vector< std::size_t > m_exponents;    /**< The exponents of the terms, m_variables per term, in decreasing lexicographic order. */
+        std::vector< T >           m_coefficients; /**< The coefficients of the terms. */
+        std::vector< Node >        m_nodes;        /**< The nodes of the Horner tree; the root is m_nodes[0]. Empty for the zero polynomial. */
+        std::vector< Child >       m_children;     /**< The children of the nodes, in decreasing order of the exponent within each node. */
+
+        /**
+         * @brief Returns the exponents of a term.
+         */
+        [[nodiscard]]
+        std::span< const std::size_t > exponents(std::size_t term) const
+        {
+            return std::span< const std::size_t >(m_exponents).subspan(term * m_variables, m_variables);
+        }
+
+        /**
+         * @brief Builds the subtree for the terms [begin, end), which share the exponents of the variables before depth.
+         *
+         * @return The index of the node.
+         */
+        std::size_t build(std::size_t depth, std::size_t begin, std::size_t end)
+        {
+            const std::size_t node = m_nodes.size();
+            m_nodes.push_back({ m_children.size(), 0 });
+
+            // ===== The terms are sorted, so the terms with the same power of the variable are contiguous.
+            std::vector< std::size_t > groups;
+            for (std::size_t term = begin; term < end; ++term)
+                if (term == begin || exponents(term)[depth] != exponents(term - 1)[depth]) groups.push_back(term);
+            groups.push_back(end);
+
+            const std::size_t first = m_children.size();
+            m_nodes[node].count     = groups.size() - 1;
+            m_children.resize(first + groups.size() - 1);
+            for (std::size_t g = 0; g + 1 < groups.size(); ++g) {
+                const std::size_t index = depth + 1 < m_variables ? build(depth + 1, groups[g], groups[g + 1]) : groups[g];
+                m_children[first + g]   = { exponents(groups[g])[depth], index };
+            }
+
+            return node;
+        }
+
+        /**
+         * @brief Adds a term to the sorted list of terms, without rebuilding the tree.
+         */
+        void insert(T coefficient, std::span< const std::size_t > powers)
+        {
+            if (powers.size() != m_variables) throw NumerixxError("The number of exponents must match the number of variables.");
+
+            // ===== Binary search for the term, with the terms in decreasing lexicographic order.
+            std::size_t lower = 0;
+            std::size_t upper = size();
+            while (lower < upper) {
+                const std::size_t mid = (lower + upper) / 2;
+                if (std::ranges::lexicographical_compare(powers, exponents(mid)))
+                    lower = mid + 1;
+                else
+                    upper = mid;
+            }
+
+            if (lower < size() && std::ranges::equal(powers, exponents(lower))) {
+                m_coefficients[lower] += coefficient;
+                if (m_coefficients[lower] == T {}) {
+                    m_coefficients.erase(m_coefficients.begin() + static_cast< std::ptrdiff_t >(lower));
+                    const auto first = m_exponents.begin() + static_cast< std::ptrdiff_t >(lower * m_variables);
+                    m_exponents.erase(first, first + static_cast< std::ptrdiff_t >(m_variables));
+                }
+                return;
+            }
+
+            if (coefficient == T {}) return;
+            m_coefficients.insert(m_coefficients.begin() + static_cast< std::ptrdiff_t >(lower), coefficient);
+            m_exponents.insert(m_exponents.begin() + static_cast< std::ptrdiff_t >(lower * m_variables), powers.begin(), powers.end());
+        }
+
+        /**
+         * @brief Rebuilds the Horner tree from the terms.
+         */
+        void rebuild()
+        {
+            m_nodes.clear();
+            m_children.clear();
+            if (!m_coefficients.empty()) build(0, 0, m_coefficients.size());
+        }
+
+        /**
+         * @brief Returns the children of a node.
+         */
+        [[nodiscard]]
+        std::span< const Child > children(std::size_t node) const
+        {
+            return std::span< const Child >(m_children).subspan(m_nodes[node].first, m_nodes[node].count);
+        }
+
+        /**
+         * @brief Evaluates the subtree of a node at depth `depth`.
+         */
+        [[nodiscard]]
+        T evaluateNode(std::size_t node, std::size_t depth, std::span< const T > x) const
+        {
+            const auto children = this->children(node);
+            auto value = [&](const Child& child) { return depth + 1 < m_variables ? evaluateNode(child.index, depth + 1, x) : m_coefficients[child.index]; };
+
+            T acc = value(children[0]);
+            for (std::size_t i = 1; i < children.size(); ++i)
+                acc = detail::fmadd(acc, detail::integerPower(x[depth], children[i - 1].exponent - children[i].exponent), value(children[i]));
+            return acc * detail::integerPower(x[depth], children.back().exponent);
+        }
+
+        /**
+         * @brief Returns the number of elements of a jet, i.e. the value, the gradient and (optionally) the Hessian.
+         */
+        template< bool HESSIAN >
+        [[nodiscard]]
+        std::size_t jetSize() const
+        {
+            return 1 + m_variables + (HESSIAN ? m_variables * m_variables : 0);
+        }
+
+        /**
+         * @brief Evaluates the subtree of a node at depth `depth`, with its gradient and (optionally) its Hessian.
+         *
+         * The jet of depth d is stored at offset d * jetSize() in the workspace, as the value, the gradient, and the
+         * Hessian in row-major order. The subtree of a node at depth v only depends on x_v, ..., x_{n-1}, so only
+         * these entries are touched; the children are evaluated into the jet of depth v + 1.
+         */
+        template< bool HESSIAN >
+        void evaluateJet(std::size_t node, std::size_t depth, std::span< const T > x, std::span< T > work) const
+        {
+            using FLOAT_T = typename detail::FundamentalType< T >::type;
+
+            const std::size_t n    = m_variables;
+            const std::size_t size = jetSize< HESSIAN >();
+            const auto        acc  = work.subspan(depth * size, size);
+            const auto        grad = acc.subspan(1, n);
+            const auto        hess = acc.subspan(1 + n);
+
+            // ===== Sets (or adds) a child; the entries of x_depth are zero in the child.
+            auto combine = [&](const Child& child, bool add) {
+                if (depth + 1 == n) {
+                    acc[0] = add ? acc[0] + m_coefficients[child.index] : m_coefficients[child.index];
+                    if (!add) {
+                        grad[depth] = T {};
+                        if constexpr (HESSIAN) hess[depth * n + depth] = T {};
+                    }
+                    return;
+                }
+
+                evaluateJet< HESSIAN >(child.index, depth + 1, x, work);
+                const auto source = work.subspan((depth + 1) * size, size);
+                acc[0]            = add ? acc[0] + source[0] : source[0];
+                for (std::size_t i = depth + 1; i < n; ++i) grad[i] = add ? grad[i] + source[1 + i] : source[1 + i];
+                if (!add) grad[depth] = T {};
+                if constexpr (HESSIAN) {
+                    for (std::size_t i = depth + 1; i < n; ++i)
+                        for (std::size_t j = depth + 1; j < n; ++j)
+                            hess[i * n + j] = add ? hess[i * n + j] + source[1 + n + i * n + j] : source[1 + n + i * n + j];
+                    if (!add)
+                        for (std::size_t i = depth; i < n; ++i) hess[depth * n + i] = hess[i * n + depth] = T {};
+                }
+            };
+
+            // ===== Multiplies the jet by x_depth^e, by the product rule.
+            auto multiply = [&](std::size_t e) {
+                if (e == 0) return;
+                const T xv     = x[depth];
+                const T lower  = detail::integerPower(xv, e - 1);
+                const T power  = lower * xv;
+                const T first  = lower * static_cast< FLOAT_T >(e);
+                if constexpr (HESSIAN) {
+                    const T second = e < 2 ? T {} : detail::integerPower(xv, e - 2) * static_cast< FLOAT_T >(e * (e - 1));
+                    for (std::size_t i = depth; i < n; ++i)
+                        for (std::size_t j = depth; j < n; ++j) hess[i * n + j] *= power;
+                    for (std::size_t i = depth; i < n; ++i) {
+                        hess[depth * n + i] += first * grad[i];
+                        hess[i * n + depth] += first * grad[i];
+                    }
+                    hess[depth * n + depth] += second * acc[0];
+                }
+                for (std::size_t i = depth; i < n; ++i) grad[i] *= power;
+                grad[depth] += first * acc[0];
+                acc[0] *= power;
+            };
+
+            const auto children = this->children(node);
+            combine(children[0], false);
+            for (std::size_t i = 1; i < children.size(); ++i) {
+                multiply(children[i - 1].exponent - children[i].exponent);
+                combine(children[i], true);
+            }
+            multiply(children.back().exponent);
+        }
+
+        /**
+         * @brief Evaluates the polynomial with its gradient and (optionally) its Hessian.
+         */
+        template< bool HESSIAN >
+        T evaluateDerivatives(std::span< const T > x, std::span< T > grad, std::span< T > hess) const
+        {
+            if (x.size() != m_variables || grad.size() != m_variables || (HESSIAN && hess.size() != m_variables * m_variables))
+                throw NumerixxError("The arguments and derivatives must match the number of variables.");
+
+            std::fill(grad.begin(), grad.end(), T {});
+            std::fill(hess.begin(), hess.end(), T {});
+            if (m_nodes.empty()) return T {};
+
+            std::vector< T > work(m_variables * jetSize< HESSIAN >());
+            evaluateJet< HESSIAN >(0, 0, x, std::span< T >(work));
+
+            std::copy(work.begin() + 1, work.begin() + 1 + static_cast< std::ptrdiff_t >(m_variables), grad.begin());
+            if constexpr (HESSIAN)
+                std::copy(work.begin() + 1 + static_cast< std::ptrdiff_t >(m_variables),
+                          work.begin() + static_cast< std::ptrdiff_t >(jetSize< HESSIAN >()),
+                          hess.begin());
+            return work[0];
+        }
+
+    public:
+        using value_type = T;
+
+        /**
+         * @brief Constructs the zero polynomial in a number of variables.
+         *
+         * @param variables The number of variables. Must be positive.
+         *
+         * @throws NumerixxError if the number of variables is zero.
+         */
+        explicit MultiPolynomial(std::size_t variables)
+            : m_variables(variables)
+        {
+            if (variables == 0) throw NumerixxError("A multivariate polynomial requires at least one variable.");
+        }
+
+        /**
+         * @brief Constructs a polynomial from a list of terms.
+         *
+         * The number of variables is the number of exponents of the terms. Terms with the same exponents are
+         * combined.
+         *
+         * @param terms The terms, as pairs of a coefficient and the exponents of the variables, e.g.
+         * { { 2.0, { 1, 0 } }, { -1.0, { 0, 2 } } } for 2x - y^2.
+         *
+         * @throws NumerixxError if there are no terms, or if the terms have different numbers of exponents.
+         */
+        MultiPolynomial(std::initializer_list< std::pair< T, std::vector< std::size_t > > > terms)
+            : MultiPolynomial(terms.size() == 0 ? 0 : terms.begin()->second.size())
+        {
+            for (const auto& [coefficient, powers] : terms) insert(coefficient, std::span< const std::size_t >(powers));
+            rebuild();
+        }
+
+        /**
+         * @brief Adds a term to the polynomial.
+         *
+         * @param coefficient The coefficient of the term.
+         * @param powers The exponents of the variables.
+         *
+         * @throws NumerixxError if the number of exponents differs from the number of variables.
+         *
+         * @note The Horner tree is rebuilt for each term; for polynomials with many terms, the list constructor
+         * is faster.
+         */
+        void addTerm(T coefficient, std::span< const std::size_t > powers)
+        {
+            insert(coefficient, powers);
+            rebuild();
+        }
+
+        /**
+         * @brief Adds a term to the polynomial.
+         *
+         * @param coefficient The coefficient of the term.
+         * @param powers The exponents of the variables.
+         *
+         * @throws NumerixxError if the number of exponents differs from the number of variables.
+         */
+        void addTerm(T coefficient, std::initializer_list< std::size_t > powers)
+        {
+            addTerm(coefficient, std::span< const std::size_t >(powers.begin(), powers.size()));
+        }
+
+        /**
+         * @brief Returns the number of variables.
+         */
+        [[nodiscard]]
+        std::size_t variables() const
+        {
+            return m_variables;
+        }
+
+        /**
+         * @brief Returns the number of (non-zero) terms.
+         */
+        [[nodiscard]]
+        std::size_t size() const
+        {
+            return m_coefficients.size();
+        }
+
+        /**
+         * @brief Returns the total degree, i.e. the largest sum of the exponents of a term.
+         */
+        [[nodiscard]]
+        std::size_t degree() const
+        {
+            std::size_t result = 0;
+            for (std::size_t term = 0; term < size(); ++term) {
+                const auto powers = exponents(term);
+                result            = std::max(result, std::accumulate(powers.begin(), powers.end(), std::size_t {}));
+            }
+            return result;
+        }
+
+        /**
+         * @brief Evaluates the polynomial.
+         *
+         * @param x The values of the variables.
+         * @return The value of the polynomial.
+         *
+         * @throws NumerixxError if the number of values differs from the number of variables.
+         */
+        [[nodiscard]]
+        T operator()(std::span< const T > x) const
+        {
+            if (x.size() != m_variables) throw NumerixxError("The arguments must match the number of variables.");
+            return m_nodes.empty() ? T {} : evaluateNode(0, 0, x);
+        }
+
+        /**
+         * @brief Evaluates the polynomial and its gradient, in one sweep.
+         *
+         * @param x The values of the variables.
+         * @param grad The destination for the partial derivatives; must hold one element per variable.
+         * @return The value of the polynomial.
+         *
+         * @throws NumerixxError if the sizes differ from the number of variables.
+         */
+        T gradient(std::span< const T > x, std::span< T > grad) const
+        {
+            return evaluateDerivatives< false >(x, grad, {});
+        }
+
+        /**
+         * @brief Evaluates the polynomial, its gradient and its Hessian, in one sweep.
+         *
+         * @param x The values of the variables.
+         * @param grad The destination for the partial derivatives; must hold one element per variable.
+         * @param hess The destination for the second partial derivatives, in row-major order; must hold n * n
+         * elements for n variables.
+         * @return The value of the polynomial.
+         *
+         * @throws NumerixxError if the sizes do not match the number of variables.
+         */
+        T hessian(std::span< const T > x, std::span< T > grad, std::span< T > hess) const
+        {
+            return evaluateDerivatives< true >(x, grad, hess);
+        }
+    };
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_MULTIPOLYNOMIAL_HPP
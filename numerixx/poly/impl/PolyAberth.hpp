@@ -0,0 +1,234 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef NUMERIXX_POLYABERTH_HPP
+#define NUMERIXX_POLYABERTH_HPP
+
+// ===== Numerixx Includes
+#include "PolyEvaluation.hpp"
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <vector>
+
+namespace nxx::poly::detail
+{
+    /**
+     * @brief The polynomial order from which the Aberth corrections are computed in parallel (with OpenMP).
+     */
+    inline constexpr std::size_t ABERTH_PARALLEL_THRESHOLD = 64;
+
+    /**
+     * @brief Computes initial estimates for all roots of a polynomial, placed on circles (Bini's strategy).
+     *
+     * The upper convex hull of the points (i, log|a_i|) (the Newton polygon) is computed. Each edge of the
+     * hull, from vertex i to vertex j, gives j - i roots of modulus (|a_i| / |a_j|)^(1 / (j - i)), which are
+     * spread evenly on a circle with that radius. The circles are rotated against each other, to avoid
+     * starting points that are symmetric about the real axis.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree. The leading coefficient
+     * must be non-zero.
+     * @param roots The destination for the estimates; must hold coeffs.size() - 1 elements.
+     */
+    template< typename FLOAT_T >
+    inline void aberthInitialGuesses(std::span< const std::complex< FLOAT_T > > coeffs, std::span< std::complex< FLOAT_T > > roots)
+    {
+        const std::size_t n = coeffs.size() - 1;
+
+        // ===== Points of the Newton polygon; zero coefficients are represented by a very low value.
+        std::vector< FLOAT_T > logs(n + 1);
+        for (std::size_t i = 0; i <= n; ++i)
+            logs[i] = coeffs[i] == std::complex< FLOAT_T > {} ? std::numeric_limits< FLOAT_T >::lowest() : std::log(std::abs(coeffs[i]));
+
+        // ===== Upper convex hull (monotone chain), starting at the lowest degree with a non-zero coefficient.
+        std::vector< std::size_t > hull;
+        for (std::size_t i = 0; i <= n; ++i) {
+            if (logs[i] == std::numeric_limits< FLOAT_T >::lowest()) continue;
+            while (hull.size() >= 2) {
+                const std::size_t a = hull[hull.size() - 2];
+                const std::size_t b = hull.back();
+                const FLOAT_T     cross =
+                    static_cast< FLOAT_T >(b - a) * (logs[i] - logs[a]) - static_cast< FLOAT_T >(i - a) * (logs[b] - logs[a]);
+                if (cross < 0) break;
+                hull.pop_back();
+            }
+            hull.push_back(i);
+        }
+
+        // ===== Roots at zero, for zero low-order coefficients.
+        std::size_t count = 0;
+        for (; count < hull.front(); ++count) roots[count] = std::complex< FLOAT_T > {};
+
+        constexpr FLOAT_T sigma = FLOAT_T(0.7);
+        const FLOAT_T     twoPi = 2 * std::numbers::pi_v< FLOAT_T >;
+        for (std::size_t h = 1; h < hull.size(); ++h) {
+            const std::size_t i      = hull[h - 1];
+            const std::size_t j      = hull[h];
+            const std::size_t k      = j - i;
+            const FLOAT_T     radius = std::exp((logs[i] - logs[j]) / static_cast< FLOAT_T >(k));
+            for (std::size_t m = 0; m < k; ++m) {
+                const FLOAT_T angle = twoPi * static_cast< FLOAT_T >(m) / static_cast< FLOAT_T >(k) +
+                                      twoPi * static_cast< FLOAT_T >(i) / static_cast< FLOAT_T >(n) + sigma;
+                roots[count++] = std::polar(radius, angle);
+            }
+        }
+    }
+
+    /**
+     * @brief Computes the Newton correction p(z) / p'(z) of a polynomial, without overflow for large |z|.
+     *
+     * For |z| <= 1, the polynomial is evaluated directly. Otherwise, the reversed polynomial r(y) is
+     * evaluated at y = 1/z, and the correction is computed as z / (n - y * r'(y) / r(y)), which avoids the
+     * overflow of z^n for high orders.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree.
+     * @param reversed The polynomial coefficients, in decreasing order of degree.
+     * @param z The point at which to compute the correction.
+     * @param value On return, |p(z)| (or |r(1/z)| for |z| > 1).
+     * @param bound On return, the rounding error bound of the value, eps * sum(|a_i| |x|^i), where x is the
+     * point at which the polynomial was evaluated.
+     * @return The Newton correction.
+     */
+    template< typename FLOAT_T >
+    inline std::complex< FLOAT_T > aberthNewtonCorrection(std::span< const std::complex< FLOAT_T > > coeffs,
+                                                          std::span< const std::complex< FLOAT_T > > reversed,
+                                                          std::complex< FLOAT_T >                    z,
+                                                          FLOAT_T&                                   value,
+                                                          FLOAT_T&                                   bound)
+    {
+        using COMPLEX_T = std::complex< FLOAT_T >;
+        const bool    inside = std::abs(z) <= 1;
+        const auto    poly   = inside ? coeffs : reversed;
+        const auto    x      = inside ? z : COMPLEX_T(1) / z;
+        const FLOAT_T ax     = std::abs(x);
+
+        const auto [p, dp] = hornerDerivatives< 1 >(poly, x);
+        FLOAT_T sum        = 0;
+        for (std::size_t i = poly.size(); i-- > 0;) sum = sum * ax + std::abs(poly[i]);
+        value = std::abs(p);
+        bound = std::numeric_limits< FLOAT_T >::epsilon() * sum;
+
+        if (inside) return p / dp;
+        const auto n = static_cast< FLOAT_T >(coeffs.size() - 1);
+        return z / (n - x * dp / p);
+    }
+
+    /**
+     * @brief Refines estimates of all roots of a polynomial simultaneously, using the Aberth–Ehrlich method.
+     *
+     * In each sweep, every unconverged root z_i is moved by w_i = N_i / (1 - N_i * S_i), where N_i is the
+     * Newton correction p(z_i) / p'(z_i) and S_i = sum_{j != i} 1 / (z_i - z_j). The corrections of a sweep
+     * are all computed from the estimates of the previous sweep (Jacobi style), so they are independent of
+     * each other, and are computed in parallel for high orders. The method converges cubically for simple
+     * roots, and linearly for multiple roots.
+     *
+     * A root is considered converged when its correction is below the tolerance (relative to |z_i| for
+     * |z_i| > 1), or when |p(z_i)| is within the rounding error bound of the evaluation. An estimate whose
+     * correction is not finite, e.g. at a critical point of the polynomial, is not converged; it is rotated
+     * by a small angle about the origin (and moved off the origin), and the iteration continues.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree.
+     * @param roots On entry, the initial estimates; on return, the refined roots.
+     * @param tolerance The tolerance on the corrections.
+     * @param max_iterations The maximum number of sweeps.
+     * @return true if all roots converged, false otherwise.
+     */
+    template< typename FLOAT_T >
+    inline bool aberthIterate(std::span< const std::complex< FLOAT_T > > coeffs,
+                              std::span< std::complex< FLOAT_T > >       roots,
+                              FLOAT_T                                    tolerance,
+                              int                                        max_iterations)
+    {
+        using COMPLEX_T   = std::complex< FLOAT_T >;
+        const std::size_t n = roots.size();
+
+        std::vector< COMPLEX_T > reversed(coeffs.rbegin(), coeffs.rend());
+        std::vector< COMPLEX_T > corrections(n);
+        std::vector< char >      converged(n, 0);
+        std::vector< char >      perturbed(n, 0);
+
+        const COMPLEX_T rotation = std::polar(FLOAT_T(1), FLOAT_T(0.1));
+        const FLOAT_T   offset   = std::sqrt(std::numeric_limits< FLOAT_T >::epsilon());
+
+        for (int iter = 0; iter < max_iterations; ++iter) {
+            const auto count = static_cast< std::ptrdiff_t >(n);
+
+#pragma omp parallel for if (n >= ABERTH_PARALLEL_THRESHOLD)
+            for (std::ptrdiff_t s = 0; s < count; ++s) {
+                const auto i  = static_cast< std::size_t >(s);
+                corrections[i] = COMPLEX_T {};
+                perturbed[i]   = 0;
+                if (converged[i]) continue;
+
+                FLOAT_T    value;
+                FLOAT_T    bound;
+                const auto newton = aberthNewtonCorrection(coeffs, std::span< const COMPLEX_T >(reversed), roots[i], value, bound);
+                if (value <= bound) {
+                    converged[i] = 1;
+                    continue;
+                }
+
+                COMPLEX_T sum {};
+                for (std::size_t j = 0; j < n; ++j)
+                    if (j != i) sum += COMPLEX_T(1) / (roots[i] - roots[j]);
+                corrections[i] = newton / (COMPLEX_T(1) - newton * sum);
+
+                // ===== No usable correction (e.g. p'(z_i) = 0, or coinciding estimates): perturb the estimate.
+                if (!isFinite(newton) || !isFinite(corrections[i])) {
+                    corrections[i] = roots[i] - (roots[i] + offset) * rotation;
+                    perturbed[i]   = 1;
+                }
+            }
+
+            bool done = true;
+            for (std::size_t i = 0; i < n; ++i) {
+                if (converged[i]) continue;
+                if (!perturbed[i] && std::abs(corrections[i]) <= tolerance * std::max(FLOAT_T(1), std::abs(roots[i])))
+                    converged[i] = 1;
+                else
+                    done = false;
+                roots[i] -= corrections[i];
+            }
+            if (done) return true;
+        }
+
+        return std::all_of(converged.begin(), converged.end(), [](char flag) { return flag != 0; });
+    }
+
+}    // namespace nxx::poly::detail
+
+#endif    // NUMERIXX_POLYABERTH_HPP
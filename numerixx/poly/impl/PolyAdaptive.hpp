@@ -0,0 +1,320 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYADAPTIVE_HPP
+#define NUMERIXX_POLYADAPTIVE_HPP
+
+// ===== Numerixx Includes
+#include "PolyEvaluation.hpp"
+#include "Polynomial.hpp"
+#include "Polyroots.hpp"
+#include <Concepts.hpp>
+
+// ===== External Includes
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <tl/expected.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief The number of Aberth sweeps with compensated evaluation, before the remaining roots are
+         * refined in multiprecision.
+         *
+         * @note Each sweep gains at least the digits lost to the conditioning of the root, so a root that is
+         * still uncertified after a few sweeps is too ill-conditioned for double-double evaluation.
+         */
+        inline constexpr int ADAPTIVE_COMPENSATED_SWEEPS = 3;
+
+        /**
+         * @brief The maximum number of Aberth sweeps in multiprecision.
+         *
+         * @note The corrections converge cubically for simple roots, but only linearly for multiple roots,
+         * which need the most sweeps.
+         */
+        inline constexpr int ADAPTIVE_MULTIPRECISION_SWEEPS = 200;
+
+        /**
+         * @brief The smallest relative error that can be certified, in units of the machine epsilon, as the
+         * roots are returned in working precision.
+         */
+        inline constexpr int ADAPTIVE_ACCURACY_FLOOR = 4;
+
+        /**
+         * @brief Returns the bound gamma_k = k u / (1 - k u) on the relative rounding error of k operations.
+         */
+        template< typename FLOAT_T >
+        inline FLOAT_T roundingBound(std::size_t operations, const FLOAT_T& unit)
+        {
+            const FLOAT_T bound = static_cast< FLOAT_T >(operations) * unit;
+            return bound / (1 - bound);
+        }
+
+        /**
+         * @brief Computes Newton corrections of approximate roots of a polynomial, with bounds on their
+         * relative errors, evaluating the polynomial with the given strategy.
+         *
+         * For a simple root, the error of an estimate z is about |p(z)| / |p'(z)|. The computed value of p(z)
+         * is itself uncertain by at most err * p~(|z|), where p~ is the polynomial with the absolute values of
+         * the coefficients, and err the relative error bound of the evaluation strategy, which is added to
+         * |p(z)|. The ratio p~(|z|) / (|z| |p'(z)|) is the condition number of the root, so an estimate can
+         * only be certified if the condition number times err is below the required accuracy.
+         *
+         * As in detail::aberthNewtonCorrection, the reversed polynomial is evaluated at 1 / z for |z| > 1,
+         * which avoids overflow for high orders; the relative error of a root is the same for z and 1 / z.
+         *
+         * @tparam COMPLEX_T The complex type of the arithmetic.
+         * @tparam STRATEGY The evaluation strategy, e.g. CompensatedHorner.
+         */
+        template< typename COMPLEX_T, typename STRATEGY >
+        class RootCertifier final
+        {
+            using FLOAT_T = typename COMPLEX_T::value_type;
+
+            std::vector< COMPLEX_T > m_coefficients;    /**< The coefficients in increasing, then in decreasing order of degree. */
+            std::vector< FLOAT_T >   m_magnitudes;      /**< The absolute values of the coefficients, in the same order. */
+            FLOAT_T                  m_evaluationError; /**< The relative error bound of the evaluation. */
+
+        public:
+            /**
+             * @brief Constructor, converting the coefficients to COMPLEX_T.
+             *
+             * @param coefficients The polynomial coefficients, in increasing order of degree.
+             * @param evaluationError The relative error bound of the evaluation strategy.
+             */
+            template< typename T >
+            RootCertifier(std::span< const std::complex< T > > coefficients, FLOAT_T evaluationError)
+                : m_coefficients(2 * coefficients.size()),
+                  m_magnitudes(2 * coefficients.size()),
+                  m_evaluationError { evaluationError }
+            {
+                using std::abs;
+                const std::size_t size = coefficients.size();
+                for (std::size_t i = 0; i < size; ++i) {
+                    m_coefficients[i] = m_coefficients[2 * size - 1 - i] = COMPLEX_T(coefficients[i]);
+                    m_magnitudes[i] = m_magnitudes[2 * size - 1 - i] = abs(m_coefficients[i]);
+                }
+            }
+
+            /**
+             * @brief Computes the Newton correction p(z) / p'(z) at an approximate root.
+             *
+             * @param z The approximate root.
+             * @param bound On return, the bound on the relative error of z.
+             * @return The Newton correction.
+             */
+            COMPLEX_T newtonCorrection(const COMPLEX_T& z, FLOAT_T& bound) const
+            {
+                using std::abs;
+                const bool    inside = abs(z) <= 1;
+                const COMPLEX_T x    = inside ? z : COMPLEX_T(1) / z;
+                const FLOAT_T ax     = abs(x);
+
+                const std::size_t size   = m_coefficients.size() / 2;
+                const std::size_t offset = inside ? 0 : size;
+
+                const auto [p, dp] =
+                    STRATEGY::template evaluateWithDerivatives< 1 >(std::span< const COMPLEX_T >(m_coefficients.data() + offset, size), x);
+                if (p == COMPLEX_T {}) {
+                    bound = 0;
+                    return COMPLEX_T {};
+                }
+
+                const FLOAT_T absolute = hornerEval(std::span< const FLOAT_T >(m_magnitudes.data() + offset, size), ax);
+                bound                  = (abs(p) + m_evaluationError * absolute) / (ax * abs(dp));
+
+                if (inside) return p / dp;
+                const auto n = static_cast< FLOAT_T >(size - 1);
+                return z / (n - x * dp / p);
+            }
+        };
+
+    }    // namespace detail
+
+    /**
+     * @brief The number of roots certified at each precision by the last call of AdaptiveSolver::solve().
+     */
+    struct AdaptiveStatistics
+    {
+        std::size_t working {};        /**< Roots certified as found by the solver, in working precision. */
+        std::size_t compensated {};    /**< Roots certified after refinement with compensated evaluation. */
+        std::size_t multiprecision {}; /**< Roots certified after refinement in multiprecision. */
+        std::size_t uncertified {};    /**< Roots whose error bound still exceeds the accuracy after refinement. */
+    };
+
+    /**
+     * @brief Root finding strategy for polysolve, solving in working precision, and refining only the
+     * ill-conditioned roots in higher precision.
+     *
+     * The roots are found by the SOLVER strategy, and the relative error of each root is bounded from its
+     * residual and condition number, with the polynomial evaluated by the compensated Horner scheme (see
+     * detail::RootCertifier). Roots whose bound exceeds the tolerance are refined by Aberth sweeps, which
+     * keep them from converging to a neighbouring root: first with compensated evaluation, which behaves as
+     * double-double arithmetic and costs 2-4 times plain Horner, and then, for the roots that are still
+     * uncertified, with all arithmetic in MP_T. Well-conditioned roots are therefore returned as found by
+     * SOLVER, at the cost of one compensated evaluation each, and only the hard cases pay for the higher
+     * precision. The number of roots certified at each stage is recorded in statistics.
+     *
+     * @tparam SOLVER The root finding strategy for the initial roots.
+     * @tparam MP_T The multiprecision type for the last stage.
+     *
+     * @note The bounds assume simple roots. Multiple roots are still refined, and certified once the
+     * multiprecision estimates are within the tolerance, but the corrections converge only linearly; see
+     * SquareFreeSolver for polynomials that are known to have multiple roots.
+     * @note The coefficients are taken as exact, so the roots are those of the polynomial as represented in
+     * working precision. As the roots are returned in working precision, the tolerance is raised to at least
+     * a few machine epsilons. Zero roots, i.e. vanishing coefficients of the lowest degrees, are divided out
+     * before solving, and counted as certified in working precision.
+     */
+    template< IsPolySolver SOLVER = AutoSolver<>, typename MP_T = boost::multiprecision::cpp_bin_float_50 >
+    requires nxx::IsFloat< MP_T >
+    struct AdaptiveSolver
+    {
+        static constexpr bool IsPolySolver = true;
+
+        SOLVER             solver {};     /**< The solver for the initial roots. */
+        AdaptiveStatistics statistics {}; /**< The statistics of the last call of solve(). */
+
+        template< std::floating_point FLOAT_T >
+        auto solve(const Polynomial< std::complex< FLOAT_T > >& original, FLOAT_T tolerance, int max_iterations)
+            -> tl::expected< std::vector< std::complex< FLOAT_T > >, NumerixxError >
+        {
+            static_assert(std::numeric_limits< MP_T >::digits > 2 * std::numeric_limits< FLOAT_T >::digits,
+                          "The multiprecision type must be more precise than double-double arithmetic.");
+
+            using COMPLEX_T    = std::complex< FLOAT_T >;
+            using MP_COMPLEX_T = std::complex< MP_T >;
+
+            statistics = {};
+
+            // ===== Zero roots are exact, but have no relative error to certify, so they are divided out first.
+            const auto& all   = original.coefficients();
+            std::size_t zeros = 0;
+            while (zeros + 1 < all.size() && all[zeros] == COMPLEX_T {}) ++zeros;
+            if (zeros > 0) {
+                auto roots = std::vector< COMPLEX_T >(zeros);
+                if (zeros + 1 < all.size()) {
+                    const auto quotient = std::vector< COMPLEX_T >(all.begin() + static_cast< std::ptrdiff_t >(zeros), all.end());
+                    auto       reduced  = solve(Polynomial< COMPLEX_T >(quotient), tolerance, max_iterations);
+                    if (!reduced) [[unlikely]]
+                        return reduced;
+                    roots.insert(roots.end(), reduced->begin(), reduced->end());
+                }
+                statistics.working += zeros;
+                return roots;
+            }
+
+            auto roots = solver.solve(original, tolerance, max_iterations);
+            if (!roots) [[unlikely]]
+                return roots;
+
+            const auto        coeffs  = std::span< const COMPLEX_T >(original.coefficients());
+            const std::size_t order   = coeffs.size() - 1;
+            const FLOAT_T     epsilon = std::numeric_limits< FLOAT_T >::epsilon();
+            const FLOAT_T     target  = std::max(tolerance, detail::ADAPTIVE_ACCURACY_FLOOR * epsilon);
+
+            std::vector< std::size_t > pending(roots->size());
+            std::iota(pending.begin(), pending.end(), std::size_t { 0 });
+
+            // ===== Working precision, then Aberth sweeps with compensated evaluation.
+            const FLOAT_T compensatedError = detail::roundingBound(4 * order, epsilon);
+            const auto compensated = detail::RootCertifier< COMPLEX_T, CompensatedHorner >(coeffs, compensatedError * compensatedError);
+            statistics.working     = certify(compensated, std::span< COMPLEX_T >(*roots), pending, target, true);
+            for (int sweep = 1; sweep <= detail::ADAPTIVE_COMPENSATED_SWEEPS && !pending.empty(); ++sweep)
+                statistics.compensated +=
+                    certify(compensated, std::span< COMPLEX_T >(*roots), pending, target, sweep < detail::ADAPTIVE_COMPENSATED_SWEEPS);
+            if (pending.empty()) return roots;
+
+            // ===== Aberth sweeps in multiprecision, for the remaining roots.
+            const auto mpError   = detail::roundingBound(4 * order, MP_T(std::numeric_limits< MP_T >::epsilon()));
+            const auto precise   = detail::RootCertifier< MP_COMPLEX_T, Horner >(coeffs, mpError);
+            const int  sweeps    = std::min(max_iterations, detail::ADAPTIVE_MULTIPRECISION_SWEEPS);
+            auto       estimates = std::vector< MP_COMPLEX_T >(roots->begin(), roots->end());
+            for (int sweep = 0; sweep <= sweeps && !pending.empty(); ++sweep)
+                statistics.multiprecision += certify(precise, std::span< MP_COMPLEX_T >(estimates), pending, MP_T(target), sweep < sweeps);
+            statistics.uncertified = pending.size();
+
+            // The roots that were not refined convert back exactly.
+            std::transform(estimates.begin(), estimates.end(), roots->begin(), [](const MP_COMPLEX_T& root) {
+                return COMPLEX_T(static_cast< FLOAT_T >(root.real()), static_cast< FLOAT_T >(root.imag()));
+            });
+            return roots;
+        }
+
+    private:
+        /**
+         * @brief Removes the pending roots whose error bound is within the target, and applies an Aberth
+         * correction to the others (Gauss-Seidel style, using the corrected roots as they become available).
+         *
+         * @return The number of roots certified.
+         */
+        template< typename CERTIFIER, typename COMPLEX_T >
+        static std::size_t certify(const CERTIFIER&                       certifier,
+                                   std::span< COMPLEX_T >                 roots,
+                                   std::vector< std::size_t >&            pending,
+                                   const typename COMPLEX_T::value_type& target,
+                                   bool                                   correct)
+        {
+            std::size_t kept = 0;
+            for (const std::size_t i : pending) {
+                typename COMPLEX_T::value_type bound;
+                const COMPLEX_T                newton = certifier.newtonCorrection(roots[i], bound);
+                if (bound <= target) continue;
+
+                pending[kept++] = i;
+                if (!correct) continue;
+
+                COMPLEX_T sum {};
+                for (std::size_t j = 0; j < roots.size(); ++j)
+                    if (j != i && roots[j] != roots[i]) sum += COMPLEX_T(1) / (roots[i] - roots[j]);
+                const COMPLEX_T step = newton / (COMPLEX_T(1) - newton * sum);
+                if (detail::isFinite(step)) roots[i] -= step;
+            }
+
+            const std::size_t certified = pending.size() - kept;
+            pending.resize(kept);
+            return certified;
+        }
+    };
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYADAPTIVE_HPP
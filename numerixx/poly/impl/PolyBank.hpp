@@ -0,0 +1,308 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYBANK_HPP
+#define NUMERIXX_POLYBANK_HPP
+
+// ===== Numerixx Includes
+#include "PolyEvaluation.hpp"
+#include "Polynomial.hpp"
+#include <Concepts.hpp>
+#include <Error.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <vector>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief The number of polynomials processed together by hornerBank().
+         *
+         * @note The accumulators of a block are kept in the output ranges, which must stay in L1 across the sweep
+         * over the coefficients: 1024 values per derivative is 8 KiB for double. The block size was determined
+         * with benchPolynomial (BM_PolynomialBank).
+         */
+        inline constexpr std::size_t POLY_BANK_BLOCK = 1024;
+
+        /**
+         * @brief Evaluates a bank of polynomials and their first K derivatives at a single point.
+         *
+         * The coefficients are stored as a structure of arrays: coefficient k of polynomial i is found at
+         * k * stride + i. The polynomials are processed in blocks of POLY_BANK_BLOCK, and within a block, the
+         * loop over the coefficients is the outer loop and the loop over the polynomials is the inner loop. Each
+         * polynomial carries its own accumulators and the coefficients of one degree are contiguous, so the inner
+         * loop is a plain vector multiply-add. The derivatives are computed with the extended Horner scheme, as in
+         * hornerDerivatives().
+         *
+         * Polynomials of lower order are padded with zero coefficients, which leaves their values unchanged.
+         *
+         * @tparam K The number of derivatives to compute.
+         * @param coeffs The coefficients of the polynomials; must hold (order + 1) * stride elements.
+         * @param stride The number of polynomials.
+         * @param x The point at which to evaluate the polynomials.
+         * @param out The destinations for p_i(x), p_i'(x), ..., p_i^(K)(x); each must hold stride elements.
+         */
+        template< std::size_t K, typename T >
+        inline void hornerBank(std::span< const T > coeffs, std::size_t stride, T x, const std::array< std::span< T >, K + 1 >& out)
+        {
+            const std::size_t n = coeffs.size() / stride;
+
+            for (std::size_t first = 0; first < stride; first += POLY_BANK_BLOCK) {
+                const std::size_t count = std::min(POLY_BANK_BLOCK, stride - first);
+
+                std::array< T*, K + 1 > acc;
+                for (std::size_t j = 0; j <= K; ++j) acc[j] = out[j].data() + first;
+
+                const T* lead = coeffs.data() + (n - 1) * stride + first;
+                std::copy(lead, lead + count, acc[0]);
+                for (std::size_t j = 1; j <= K; ++j) std::fill(acc[j], acc[j] + count, T {});
+
+                for (std::size_t k = n - 1; k-- > 0;) {
+                    for (std::size_t j = std::min(K, n - 1 - k); j > 0; --j) {
+                        T* const       dst = acc[j];
+                        const T* const src = acc[j - 1];
+#pragma omp simd
+                        for (std::size_t i = 0; i < count; ++i) dst[i] = fmadd(dst[i], x, src[i]);
+                    }
+
+                    T* const       dst = acc[0];
+                    const T* const row = coeffs.data() + k * stride + first;
+#pragma omp simd
+                    for (std::size_t i = 0; i < count; ++i) dst[i] = fmadd(dst[i], x, row[i]);
+                }
+            }
+
+            // ===== Convert the Taylor coefficients to derivatives.
+            using FLOAT_T  = typename FundamentalType< T >::type;
+            FLOAT_T factor = 1;
+            for (std::size_t j = 2; j <= K; ++j) {
+                factor *= static_cast< FLOAT_T >(j);
+                for (auto& value : out[j]) value *= factor;
+            }
+        }
+    }    // namespace detail
+
+    /**
+     * @brief A bank of polynomials of bounded order, stored together for evaluation at a common point.
+     *
+     * The coefficients of all the polynomials are stored in one contiguous matrix, with one row per degree
+     * and one column per polynomial (a structure of arrays). Evaluating the bank at a point x then runs
+     * Horner's method across the polynomials, with the coefficients of each degree loaded as one vector, which
+     * is much faster than evaluating a std::vector of Polynomial objects one at a time. This is the typical
+     * situation for fitted models, basis functions and property correlations, where many small polynomials
+     * are evaluated at the same argument.
+     *
+     * Polynomials of lower order than the bank are padded with zero coefficients.
+     *
+     * @note Like the batched root solvers, the evaluation functions do not check the results for non-finite
+     * values.
+     *
+     * @tparam T The type of the coefficients. Must be a floating point type or a complex type.
+     */
+    template< typename T >
+        requires nxx::IsFloat< T > || IsComplex< T >
+    class PolynomialBank final
+    {
+        std::vector< T > m_coefficients; /**< The coefficients; coefficient k of polynomial i is stored at k * m_size + i. */
+        std::size_t      m_size {};      /**< The number of polynomials. */
+        std::size_t      m_order {};     /**< The order of the bank, i.e. the largest order the polynomials may have. */
+
+    public:
+        /**
+         * @brief Constructs an empty bank.
+         */
+        PolynomialBank() = default;
+
+        /**
+         * @brief Constructs a bank of zero polynomials.
+         *
+         * @param size The number of polynomials.
+         * @param order The largest order the polynomials may have.
+         */
+        PolynomialBank(std::size_t size, std::size_t order)
+            : m_coefficients((order + 1) * size),
+              m_size(size),
+              m_order(order)
+        {}
+
+        /**
+         * @brief Constructs a bank from a range of polynomials.
+         *
+         * The order of the bank is the largest order of the polynomials.
+         *
+         * @param polys The polynomials. The range is traversed twice, so it must be a forward range.
+         */
+        template< std::ranges::forward_range RANGE >
+            requires std::same_as< std::ranges::range_value_t< RANGE >, Polynomial< T > >
+        explicit PolynomialBank(const RANGE& polys)
+        {
+            for (const auto& poly : polys) {
+                m_order = std::max(m_order, static_cast< std::size_t >(poly.order()));
+                ++m_size;
+            }
+
+            m_coefficients.resize((m_order + 1) * m_size);
+            std::size_t index = 0;
+            for (const auto& poly : polys) assign(index++, poly);
+        }
+
+        /**
+         * @brief Returns the number of polynomials.
+         */
+        [[nodiscard]]
+        std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Returns the order of the bank, i.e. the largest order the polynomials may have.
+         */
+        [[nodiscard]]
+        std::size_t order() const
+        {
+            return m_order;
+        }
+
+        /**
+         * @brief Returns one of the polynomials.
+         *
+         * @param index The index of the polynomial.
+         * @return The polynomial, without the padding.
+         *
+         * @throws NumerixxError if the index is out of range.
+         */
+        [[nodiscard]]
+        Polynomial< T > polynomial(std::size_t index) const
+        {
+            if (index >= m_size) throw NumerixxError("Polynomial index out of range.");
+
+            std::vector< T > coeffs(m_order + 1);
+            for (std::size_t k = 0; k <= m_order; ++k) coeffs[k] = m_coefficients[k * m_size + index];
+            return Polynomial< T >(std::move(coeffs));
+        }
+
+        /**
+         * @brief Replaces one of the polynomials.
+         *
+         * @param index The index of the polynomial.
+         * @param poly The new polynomial; its order must not exceed the order of the bank.
+         *
+         * @throws NumerixxError if the index is out of range, or if the order of the polynomial is too high.
+         */
+        void assign(std::size_t index, const Polynomial< T >& poly)
+        {
+            if (index >= m_size) throw NumerixxError("Polynomial index out of range.");
+            if (poly.order() > m_order) throw NumerixxError("The order of the polynomial exceeds the order of the bank.");
+
+            const auto& coeffs = poly.coefficients();
+            for (std::size_t k = 0; k <= m_order; ++k) m_coefficients[k * m_size + index] = k < coeffs.size() ? coeffs[k] : T {};
+        }
+
+        /**
+         * @brief Evaluates all the polynomials at a point.
+         *
+         * @param x The point at which to evaluate the polynomials.
+         * @param out The destination for the values; must hold one element per polynomial.
+         *
+         * @throws NumerixxError if the size of `out` differs from the number of polynomials.
+         */
+        void evaluate(T x, std::span< T > out) const
+        {
+            evaluateWithDerivatives< 0 >(x, { out });
+        }
+
+        /**
+         * @brief Evaluates all the polynomials at a point.
+         *
+         * @param x The point at which to evaluate the polynomials.
+         * @return A vector holding the values of the polynomials at x.
+         */
+        [[nodiscard]]
+        std::vector< T > operator()(T x) const
+        {
+            std::vector< T > result(m_size);
+            evaluate(x, std::span< T >(result));
+            return result;
+        }
+
+        /**
+         * @brief Evaluates all the polynomials and their first K derivatives at a point, in one sweep.
+         *
+         * @tparam K The number of derivatives to compute.
+         * @param x The point at which to evaluate the polynomials.
+         * @param out The destinations for the values and the derivatives, in increasing order of the
+         * derivative; each must hold one element per polynomial.
+         *
+         * @throws NumerixxError if the size of any of the output ranges differs from the number of polynomials.
+         */
+        template< std::size_t K >
+        void evaluateWithDerivatives(T x, const std::array< std::span< T >, K + 1 >& out) const
+        {
+            if (std::ranges::any_of(out, [&](const auto& range) { return range.size() != m_size; }))
+                throw NumerixxError("The output ranges must have one element per polynomial.");
+            if (m_size == 0) return;
+
+            detail::hornerBank< K >(std::span< const T >(m_coefficients), m_size, x, out);
+        }
+
+        /**
+         * @brief Evaluates all the polynomials and their first K derivatives at a point, in one sweep.
+         *
+         * @tparam K The number of derivatives to compute.
+         * @param x The point at which to evaluate the polynomials.
+         * @return An array holding the values, the first derivatives, ..., the K'th derivatives of the
+         * polynomials at x.
+         */
+        template< std::size_t K >
+        [[nodiscard]]
+        std::array< std::vector< T >, K + 1 > evaluateWithDerivatives(T x) const
+        {
+            std::array< std::vector< T >, K + 1 > result;
+            std::array< std::span< T >, K + 1 >   spans;
+            for (std::size_t j = 0; j <= K; ++j) {
+                result[j].resize(m_size);
+                spans[j] = std::span< T >(result[j]);
+            }
+            evaluateWithDerivatives< K >(x, spans);
+            return result;
+        }
+    };
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYBANK_HPP
@@ -0,0 +1,365 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef NUMERIXX_POLYBATCH_HPP
+#define NUMERIXX_POLYBATCH_HPP
+
+// ===== Numerixx Includes
+#include <Error.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <utility>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief The number of polynomials from which the batched solvers use multiple threads (with OpenMP).
+         */
+        inline constexpr std::size_t BATCH_PARALLEL_THRESHOLD = 16384;
+
+        /**
+         * @brief The number of polynomials handled by each thread at a time in the batched solvers.
+         */
+        inline constexpr std::size_t BATCH_CHUNK_SIZE = 4096;
+
+        /**
+         * @brief The number of Newton steps polishing the root of the resolvent cubic in the batched quartic solver.
+         *
+         * @note The closed form root is accurate in absolute terms, so two quadratically convergent steps restore
+         * the full relative accuracy of the small roots that occur near the biquadratic case.
+         */
+        inline constexpr int RESOLVENT_POLISH_STEPS = 2;
+
+        /**
+         * @brief Sorts the roots of one polynomial into the canonical order of the batched solvers.
+         *
+         * Real roots come first, in increasing order, followed by the complex conjugate pairs, each with the
+         * negative imaginary part first. The roots are sorted with insertion sort, which is optimal for N <= 4.
+         */
+        template< std::floating_point T, std::size_t N >
+        inline void sortLaneRoots(std::array< T, N >& re, std::array< T, N >& im)
+        {
+            auto before = [&](std::size_t i, std::size_t j) {
+                const bool realI = im[i] == 0;
+                const bool realJ = im[j] == 0;
+                if (realI != realJ) return realI;
+                if (re[i] != re[j]) return re[i] < re[j];
+                return im[i] < im[j];
+            };
+            for (std::size_t i = 1; i < N; ++i)
+                for (std::size_t j = i; j > 0 && before(j, j - 1); --j) {
+                    std::swap(re[j], re[j - 1]);
+                    std::swap(im[j], im[j - 1]);
+                }
+        }
+
+        /**
+         * @brief Computes the roots of c0 + c1*x + c2*x^2 in real arithmetic.
+         *
+         * The numerically stable form q = -(b + sign(b) * sqrt(b^2 - 4ac)) / 2, x = {q/a, c/q} is used for real
+         * roots, to avoid cancellation. Both branches are computed and the result is selected, so the function
+         * is branch free.
+         */
+        template< std::floating_point T >
+        inline void quadraticLane(T c0, T c1, T c2, std::array< T, 2 >& re, std::array< T, 2 >& im)
+        {
+            const T disc = c1 * c1 - 4 * c2 * c0;
+            const T root = std::sqrt(std::abs(disc));
+
+            // ===== Two real roots.
+            const T q  = T(-0.5) * (c1 + std::copysign(root, c1));
+            const T x1 = q / c2;
+            const T x0 = c0 / q;
+            const T x2 = q == 0 ? T(0) : x0;
+
+            // ===== A pair of complex roots.
+            const T real = -c1 / (2 * c2);
+            const T imag = root / (2 * std::abs(c2));
+
+            const bool isReal = disc >= 0;
+            re = { isReal ? std::min(x1, x2) : real, isReal ? std::max(x1, x2) : real };
+            im = { isReal ? T(0) : -imag, isReal ? T(0) : imag };
+        }
+
+        /**
+         * @brief Computes the roots of c0 + c1*x + c2*x^2 + c3*x^3 in real arithmetic.
+         *
+         * With the normalised coefficients a, b, c, Q = (a^2 - 3b) / 9 and R = (2a^3 - 9ab + 27c) / 54. If
+         * R^2 < Q^3, there are three real roots, which are computed with the trigonometric method; otherwise,
+         * there is one real root and a complex pair, which are computed with Cardano's formula.
+         *
+         * @note Unlike quadraticLane, this function branches: computing both branches in every lane, to allow
+         * vectorisation with a vector math library, was measured to be slower, due to the cost of the
+         * transcendental functions (acos, cos and cbrt).
+         */
+        template< std::floating_point T >
+        inline void cubicLane(T c0, T c1, T c2, T c3, std::array< T, 3 >& re, std::array< T, 3 >& im)
+        {
+            const T a  = c2 / c3;
+            const T b  = c1 / c3;
+            const T c  = c0 / c3;
+            const T a3 = a / 3;
+
+            const T Q  = (a * a - 3 * b) / 9;
+            const T R  = (2 * a * a * a - 9 * a * b + 27 * c) / 54;
+            const T Q3 = Q * Q * Q;
+            const T D  = R * R - Q3;
+
+            if (D < 0) {
+                // ===== Three real roots (trigonometric method), in increasing order.
+                const T sq    = std::sqrt(Q);
+                const T theta = std::acos(std::clamp(R / (sq * sq * sq), T(-1), T(1))) / 3;
+                const T third = 2 * std::numbers::pi_v< T > / 3;
+                re            = { -2 * sq * std::cos(theta) - a3, -2 * sq * std::cos(theta - third) - a3, -2 * sq * std::cos(theta + third) - a3 };
+                im            = { T(0), T(0), T(0) };
+            }
+            else {
+                // ===== One real root and a complex pair (Cardano's formula).
+                const T A    = -std::copysign(std::cbrt(std::abs(R) + std::sqrt(D)), R);
+                const T B    = A == 0 ? T(0) : Q / A;
+                const T real = -(A + B) / 2 - a3;
+                const T imag = std::sqrt(T(3)) / 2 * std::abs(A - B);
+                re           = { A + B - a3, real, real };
+                im           = { T(0), -imag, imag };
+
+                // ===== For a double root, the pair is real and may come before the single root.
+                sortLaneRoots(re, im);
+            }
+        }
+
+        /**
+         * @brief Computes the roots of c0 + c1*x + c2*x^2 + c3*x^3 + c4*x^4 in real arithmetic (Ferrari's method).
+         *
+         * The quartic is depressed to y^4 + p*y^2 + q*y + r (with x = y - a/4), and factored into two real
+         * quadratics y^2 -+ s*y + (h +- k), where m is the largest root of the resolvent cubic
+         * m^3 + p*m^2 + (p^2/4 - r)*m - q^2/8, s = sqrt(2m), h = p/2 + m and k = q/(2s).
+         *
+         * Near the biquadratic case (q -> 0), m is small, and the closed form only gives it to an absolute
+         * error of about eps * p^2, so s and k would lose most of their digits. m is therefore polished with
+         * RESOLVENT_POLISH_STEPS Newton steps on the resolvent cubic, which determine it to a relative accuracy,
+         * and once s is too small for the quotient, k is computed from k^2 = m^2 + p*m + p^2/4 - r instead. A
+         * step is only kept if it reduces the residual, as the derivative vanishes at a double root of the
+         * resolvent, e.g. when the quartic has a double root.
+         */
+        template< std::floating_point T >
+        inline void quarticLane(T c0, T c1, T c2, T c3, T c4, std::array< T, 4 >& re, std::array< T, 4 >& im)
+        {
+            const T a  = c3 / c4;
+            const T b  = c2 / c4;
+            const T c  = c1 / c4;
+            const T d  = c0 / c4;
+            const T a2 = a * a;
+            const T a4 = a / 4;
+
+            const T p = b - T(3) / 8 * a2;
+            const T q = c - a * b / 2 + a2 * a / 8;
+            const T r = d - a * c / 4 + a2 * b / 16 - T(3) / 256 * a2 * a2;
+            const T e = p * p / 4 - r;
+
+            std::array< T, 3 > mre;
+            std::array< T, 3 > mim;
+            cubicLane(-q * q / 8, e, p, T(1), mre, mim);
+            T m = std::max(mim[1] == 0 ? std::max(mre[0], mre[2]) : mre[0], T(0));
+            for (int i = 0; i < RESOLVENT_POLISH_STEPS; ++i) {
+                const T value = ((m + p) * m + e) * m - q * q / 8;
+                const T deriv = (3 * m + 2 * p) * m + e;
+                const T next  = std::max(deriv == 0 ? m : m - value / deriv, T(0));
+                m             = std::abs(((next + p) * next + e) * next - q * q / 8) < std::abs(value) ? next : m;
+            }
+            const T s = std::sqrt(2 * m);
+
+            // ===== The constants h +- k of the quadratics multiply to r, so the smaller one, which may suffer
+            // from cancellation, is computed as r divided by the larger one.
+            const T    h        = p / 2 + m;
+            const T    k        = s > std::sqrt(std::numeric_limits< T >::epsilon()) * std::max({ T(1), std::abs(p), std::sqrt(std::abs(r)) })
+                                      ? q / (2 * s)
+                                      : std::copysign(std::sqrt(std::max((m + p) * m + e, T(0))), q);
+            const T    larger   = h + std::copysign(std::abs(k), h);
+            const T    smaller  = larger == 0 ? T(0) : r / larger;
+            const bool sameSign = (h < 0) == (k < 0);
+
+            std::array< T, 2 > re1;
+            std::array< T, 2 > im1;
+            std::array< T, 2 > re2;
+            std::array< T, 2 > im2;
+            quadraticLane(sameSign ? larger : smaller, -s, T(1), re1, im1);
+            quadraticLane(sameSign ? smaller : larger, s, T(1), re2, im2);
+
+            re = { re1[0] - a4, re1[1] - a4, re2[0] - a4, re2[1] - a4 };
+            im = { im1[0], im1[1], im2[0], im2[1] };
+            sortLaneRoots(re, im);
+        }
+
+        /**
+         * @brief Runs a batched closed form solver over all polynomials, in chunks, optionally using multiple threads.
+         *
+         * @return The number of polynomials with a zero leading coefficient.
+         */
+        template< std::size_t ORDER, std::floating_point T, typename LANE >
+        inline std::size_t solveBatch(const std::array< std::span< const T >, ORDER + 1 >& coeffs,
+                                      const std::array< std::span< T >, ORDER >&           real,
+                                      const std::array< std::span< T >, ORDER >&           imag,
+                                      LANE                                                 lane)
+        {
+            const std::size_t count = coeffs[0].size();
+            for (const auto& span : coeffs)
+                if (span.size() != count) throw NumerixxError("Batched polynomial solvers require coefficient ranges of equal size.");
+            for (std::size_t k = 0; k < ORDER; ++k)
+                if (real[k].size() != count || imag[k].size() != count)
+                    throw NumerixxError("Batched polynomial solvers require output ranges of the same size as the coefficient ranges.");
+
+            const auto  chunks     = static_cast< std::ptrdiff_t >((count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE);
+            std::size_t degenerate = 0;
+
+#pragma omp parallel for if (count >= BATCH_PARALLEL_THRESHOLD) reduction(+ : degenerate) schedule(static)
+            for (std::ptrdiff_t chunk = 0; chunk < chunks; ++chunk) {
+                const std::size_t first = static_cast< std::size_t >(chunk) * BATCH_CHUNK_SIZE;
+                const std::size_t last  = std::min(first + BATCH_CHUNK_SIZE, count);
+
+                // ===== The loops over the coefficients and roots are expanded, so that the loop over the
+                // polynomials is the only loop, and can be vectorised for branch free lane functions.
+                degenerate += [&]< std::size_t... K >(std::index_sequence< K... >) {
+                    const std::array< const T*, ORDER + 1 > in { coeffs[K].data()..., coeffs[ORDER].data() };
+                    const std::array< T*, ORDER >           outRe { real[K].data()... };
+                    const std::array< T*, ORDER >           outIm { imag[K].data()... };
+
+                    // ===== The output ranges never alias the input ranges or each other.
+                    std::size_t failures = 0;
+#pragma omp simd reduction(+ : failures)
+                    for (std::size_t i = first; i < last; ++i) {
+                        const std::array< T, ORDER + 1 > c { in[K][i]..., in[ORDER][i] };
+                        std::array< T, ORDER >           re;
+                        std::array< T, ORDER >           im;
+                        lane(c, re, im);
+
+                        const bool isDegenerate = c[ORDER] == 0;
+                        failures += isDegenerate ? 1 : 0;
+                        ((outRe[K][i] = isDegenerate ? std::numeric_limits< T >::quiet_NaN() : re[K]), ...);
+                        ((outIm[K][i] = isDegenerate ? std::numeric_limits< T >::quiet_NaN() : im[K]), ...);
+                    }
+                    return failures;
+                }(std::make_index_sequence< ORDER > {});
+            }
+
+            return degenerate;
+        }
+
+    }    // namespace detail
+
+    /**
+     * @brief Solves many quadratic equations c0 + c1*x + c2*x^2 = 0 at once, in real arithmetic.
+     *
+     * The coefficients and the roots are stored as structure of arrays: coeffs[k][i] is the k'th coefficient of
+     * the i'th polynomial, and real[k][i] + imag[k][i]*i is its k'th root. Nothing is allocated, and no errors
+     * are raised for individual polynomials, so the loop over the polynomials can be vectorised; the work is
+     * split over multiple threads for large batches when OpenMP is enabled.
+     *
+     * The roots of each polynomial are ordered with the real roots first, in increasing order, followed by the
+     * complex conjugate pairs, with the negative imaginary part first. Real roots have an imaginary part of
+     * exactly zero.
+     *
+     * @param coeffs The coefficient ranges {c0, c1, c2}, all of the same size.
+     * @param real The ranges for the real parts of the two roots, of the same size as the coefficient ranges.
+     * @param imag The ranges for the imaginary parts of the two roots, of the same size as the coefficient ranges.
+     * @return The number of polynomials with a zero leading coefficient. Their roots are set to NaN.
+     *
+     * @throws NumerixxError if the sizes of the ranges differ.
+     */
+    template< std::floating_point T >
+    inline std::size_t quadraticBatch(const std::array< std::span< const T >, 3 >& coeffs,
+                                      const std::array< std::span< T >, 2 >&       real,
+                                      const std::array< std::span< T >, 2 >&       imag)
+    {
+        return detail::solveBatch< 2, T >(coeffs, real, imag, [](const auto& c, auto& re, auto& im) {
+            detail::quadraticLane(c[0], c[1], c[2], re, im);
+        });
+    }
+
+    /**
+     * @brief Solves many cubic equations c0 + c1*x + c2*x^2 + c3*x^3 = 0 at once, in real arithmetic.
+     *
+     * Three real roots are computed with the trigonometric method, and one real root with a complex pair with
+     * Cardano's formula, both without complex arithmetic. See quadraticBatch() for the layout of the
+     * coefficients and roots.
+     *
+     * @param coeffs The coefficient ranges {c0, c1, c2, c3}, all of the same size.
+     * @param real The ranges for the real parts of the three roots.
+     * @param imag The ranges for the imaginary parts of the three roots.
+     * @return The number of polynomials with a zero leading coefficient. Their roots are set to NaN.
+     *
+     * @throws NumerixxError if the sizes of the ranges differ.
+     */
+    template< std::floating_point T >
+    inline std::size_t cubicBatch(const std::array< std::span< const T >, 4 >& coeffs,
+                                  const std::array< std::span< T >, 3 >&       real,
+                                  const std::array< std::span< T >, 3 >&       imag)
+    {
+        return detail::solveBatch< 3, T >(coeffs, real, imag, [](const auto& c, auto& re, auto& im) {
+            detail::cubicLane(c[0], c[1], c[2], c[3], re, im);
+        });
+    }
+
+    /**
+     * @brief Solves many quartic equations c0 + c1*x + ... + c4*x^4 = 0 at once, in real arithmetic.
+     *
+     * The roots are computed with Ferrari's method, factoring each quartic into two real quadratics via the
+     * largest root of its resolvent cubic. See quadraticBatch() for the layout of the coefficients and roots.
+     *
+     * @param coeffs The coefficient ranges {c0, c1, c2, c3, c4}, all of the same size.
+     * @param real The ranges for the real parts of the four roots.
+     * @param imag The ranges for the imaginary parts of the four roots.
+     * @return The number of polynomials with a zero leading coefficient. Their roots are set to NaN.
+     *
+     * @throws NumerixxError if the sizes of the ranges differ.
+     */
+    template< std::floating_point T >
+    inline std::size_t quarticBatch(const std::array< std::span< const T >, 5 >& coeffs,
+                                    const std::array< std::span< T >, 4 >&       real,
+                                    const std::array< std::span< T >, 4 >&       imag)
+    {
+        return detail::solveBatch< 4, T >(coeffs, real, imag, [](const auto& c, auto& re, auto& im) {
+            detail::quarticLane(c[0], c[1], c[2], c[3], c[4], re, im);
+        });
+    }
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYBATCH_HPP
@@ -0,0 +1,224 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef NUMERIXX_POLYCOMPANION_HPP
+#define NUMERIXX_POLYCOMPANION_HPP
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// ===== LAPACK routines used by the companion matrix backend (Fortran calling convention; the trailing
+// arguments are the hidden lengths of the character arguments).
+extern "C" {
+void sgebal_(const char* job, const int* n, float* A, const int* lda, int* ilo, int* ihi, float* scale, int* info, std::size_t);
+void dgebal_(const char* job, const int* n, double* A, const int* lda, int* ilo, int* ihi, double* scale, int* info, std::size_t);
+void cgebal_(const char* job, const int* n, std::complex< float >* A, const int* lda, int* ilo, int* ihi, float* scale, int* info, std::size_t);
+void zgebal_(const char* job, const int* n, std::complex< double >* A, const int* lda, int* ilo, int* ihi, double* scale, int* info, std::size_t);
+
+void shseqr_(const char* job, const char* compz, const int* n, const int* ilo, const int* ihi, float* H, const int* ldh, float* wr, float* wi,
+             float* Z, const int* ldz, float* work, const int* lwork, int* info, std::size_t, std::size_t);
+void dhseqr_(const char* job, const char* compz, const int* n, const int* ilo, const int* ihi, double* H, const int* ldh, double* wr, double* wi,
+             double* Z, const int* ldz, double* work, const int* lwork, int* info, std::size_t, std::size_t);
+void chseqr_(const char* job, const char* compz, const int* n, const int* ilo, const int* ihi, std::complex< float >* H, const int* ldh,
+             std::complex< float >* w, std::complex< float >* Z, const int* ldz, std::complex< float >* work, const int* lwork, int* info,
+             std::size_t, std::size_t);
+void zhseqr_(const char* job, const char* compz, const int* n, const int* ilo, const int* ihi, std::complex< double >* H, const int* ldh,
+             std::complex< double >* w, std::complex< double >* Z, const int* ldz, std::complex< double >* work, const int* lwork, int* info,
+             std::size_t, std::size_t);
+}
+
+namespace nxx::poly::detail
+{
+    /**
+     * @brief Concept for the coefficient types supported by the LAPACK backend.
+     */
+    template< typename T >
+    concept IsLapackType = std::same_as< T, float > || std::same_as< T, double > || std::same_as< T, std::complex< float > > ||
+                           std::same_as< T, std::complex< double > >;
+
+    /**
+     * @brief Overloads dispatching to the LAPACK balancing routines (xGEBAL).
+     */
+    inline void lapackGebal(int n, float* A, int& ilo, int& ihi, float* scale, int& info)
+    {
+        sgebal_("S", &n, A, &n, &ilo, &ihi, scale, &info, 1);
+    }
+    inline void lapackGebal(int n, double* A, int& ilo, int& ihi, double* scale, int& info)
+    {
+        dgebal_("S", &n, A, &n, &ilo, &ihi, scale, &info, 1);
+    }
+    inline void lapackGebal(int n, std::complex< float >* A, int& ilo, int& ihi, float* scale, int& info)
+    {
+        cgebal_("S", &n, A, &n, &ilo, &ihi, scale, &info, 1);
+    }
+    inline void lapackGebal(int n, std::complex< double >* A, int& ilo, int& ihi, double* scale, int& info)
+    {
+        zgebal_("S", &n, A, &n, &ilo, &ihi, scale, &info, 1);
+    }
+
+    /**
+     * @brief Overloads dispatching to the LAPACK Hessenberg QR routines (xHSEQR), computing eigenvalues only.
+     *
+     * For real matrices, the real and imaginary parts of the eigenvalues are stored in wr and wi; for complex
+     * matrices, the eigenvalues are stored in wr, and wi is unused. A negative lwork queries the workspace size.
+     */
+    inline void lapackHseqr(int n, int ilo, int ihi, float* H, float* wr, float* wi, float* work, int lwork, int& info)
+    {
+        const int one = 1;
+        shseqr_("E", "N", &n, &ilo, &ihi, H, &n, wr, wi, nullptr, &one, work, &lwork, &info, 1, 1);
+    }
+    inline void lapackHseqr(int n, int ilo, int ihi, double* H, double* wr, double* wi, double* work, int lwork, int& info)
+    {
+        const int one = 1;
+        dhseqr_("E", "N", &n, &ilo, &ihi, H, &n, wr, wi, nullptr, &one, work, &lwork, &info, 1, 1);
+    }
+    inline void lapackHseqr(int n, int ilo, int ihi, std::complex< float >* H, std::complex< float >* w, std::complex< float >*,
+                            std::complex< float >* work, int lwork, int& info)
+    {
+        const int one = 1;
+        chseqr_("E", "N", &n, &ilo, &ihi, H, &n, w, nullptr, &one, work, &lwork, &info, 1, 1);
+    }
+    inline void lapackHseqr(int n, int ilo, int ihi, std::complex< double >* H, std::complex< double >* w, std::complex< double >*,
+                            std::complex< double >* work, int lwork, int& info)
+    {
+        const int one = 1;
+        zhseqr_("E", "N", &n, &ilo, &ihi, H, &n, w, nullptr, &one, work, &lwork, &info, 1, 1);
+    }
+
+    /**
+     * @brief Computes the eigenvalues of an upper Hessenberg matrix, after balancing it.
+     *
+     * The matrix is balanced by diagonal scaling (xGEBAL, which keeps the Hessenberg form) and its
+     * eigenvalues are computed by the Hessenberg QR algorithm (xHSEQR).
+     *
+     * @param H The matrix, in column major order. It is overwritten.
+     * @param roots The destination for the eigenvalues; its size is the order of the matrix.
+     * @return true if the QR algorithm converged for all eigenvalues, false otherwise.
+     */
+    template< IsLapackType TYPE, typename FLOAT_T >
+    inline bool hessenbergEigenvalues(std::vector< TYPE >& H, std::span< std::complex< FLOAT_T > > roots)
+    {
+        const std::size_t size = roots.size();
+        const int         n    = static_cast< int >(size);
+
+        int                    ilo  = 1;
+        int                    ihi  = n;
+        int                    info = 0;
+        std::vector< FLOAT_T > scale(size);
+        lapackGebal(n, H.data(), ilo, ihi, scale.data(), info);
+        if (info != 0) return false;
+
+        std::vector< TYPE > wr(size);
+        std::vector< TYPE > wi(size);
+        TYPE                query {};
+        lapackHseqr(n, ilo, ihi, H.data(), wr.data(), wi.data(), &query, -1, info);
+        std::vector< TYPE > work(std::max(size, static_cast< std::size_t >(std::real(query))));
+        lapackHseqr(n, ilo, ihi, H.data(), wr.data(), wi.data(), work.data(), static_cast< int >(work.size()), info);
+        if (info != 0) return false;
+
+        for (std::size_t i = 0; i < size; ++i) {
+            if constexpr (std::floating_point< TYPE >)
+                roots[i] = std::complex< FLOAT_T >(wr[i], wi[i]);
+            else
+                roots[i] = wr[i];
+        }
+        return true;
+    }
+
+    /**
+     * @brief Computes the roots of a polynomial as the eigenvalues of its companion matrix.
+     *
+     * The companion matrix of the monic polynomial x^n + c_{n-1} x^{n-1} + ... + c_0 has the negated
+     * coefficients -c_{n-1}, ..., -c_0 in its first row and ones on the subdiagonal, so it is already in upper
+     * Hessenberg form. Its eigenvalues are computed by hessenbergEigenvalues(). The cost is O(n^3), but the
+     * method is backward stable and does not depend on deflation.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree. The leading coefficient
+     * must be non-zero.
+     * @param roots The destination for the roots; must hold coeffs.size() - 1 elements.
+     * @return true if the QR algorithm converged for all eigenvalues, false otherwise.
+     */
+    template< IsLapackType TYPE, typename FLOAT_T >
+    inline bool companionRoots(std::span< const TYPE > coeffs, std::span< std::complex< FLOAT_T > > roots)
+    {
+        const std::size_t size = coeffs.size() - 1;
+        const TYPE        lead = coeffs.back();
+
+        // ===== The companion matrix, in column major order.
+        std::vector< TYPE > H(size * size);
+        for (std::size_t j = 0; j < size; ++j) H[j * size] = -coeffs[size - 1 - j] / lead;
+        for (std::size_t i = 1; i < size; ++i) H[(i - 1) * size + i] = TYPE { 1 };
+
+        return hessenbergEigenvalues(H, roots.first(size));
+    }
+
+    /**
+     * @brief Computes the roots of a Chebyshev series as the eigenvalues of its colleague matrix.
+     *
+     * For a root x of c_0 T_0 + ... + c_n T_n, the vector v = (T_0(x), ..., T_{n-1}(x)) satisfies A v = x v,
+     * where A follows from the recurrences x T_0 = T_1 and x T_k = (T_{k-1} + T_{k+1}) / 2, with T_n
+     * eliminated using the series itself. A is tridiagonal except for its last row; its transpose, which
+     * has the same eigenvalues, is upper Hessenberg, and is solved by hessenbergEigenvalues(). The roots
+     * are computed without leaving the Chebyshev basis, which is much better conditioned on [-1, 1] than
+     * the monomial basis.
+     *
+     * @param coeffs The Chebyshev coefficients c_0, ..., c_n. The leading coefficient must be non-zero.
+     * @param roots The destination for the roots; must hold coeffs.size() - 1 elements.
+     * @return true if the QR algorithm converged for all eigenvalues, false otherwise.
+     */
+    template< IsLapackType TYPE, typename FLOAT_T >
+    inline bool colleagueRoots(std::span< const TYPE > coeffs, std::span< std::complex< FLOAT_T > > roots)
+    {
+        const std::size_t size = coeffs.size() - 1;
+        const TYPE        lead = coeffs.back();
+
+        // ===== The transpose of A, in column major order: A(r, c) is stored at H[c + r * size].
+        std::vector< TYPE > H(size * size);
+        auto                A = [&](std::size_t r, std::size_t c) -> TYPE& { return H[c + r * size]; };
+        if (size > 1) A(0, 1) = TYPE { 1 };
+        for (std::size_t k = 1; k < size; ++k) {
+            A(k, k - 1) = TYPE { 0.5 };
+            if (k + 1 < size) A(k, k + 1) = TYPE { 0.5 };
+        }
+        const TYPE factor = size > 1 ? TYPE { 2 } * lead : lead;
+        for (std::size_t j = 0; j < size; ++j) A(size - 1, j) -= coeffs[j] / factor;
+
+        return hessenbergEigenvalues(H, roots.first(size));
+    }
+
+}    // namespace nxx::poly::detail
+
+#endif    // NUMERIXX_POLYCOMPANION_HPP
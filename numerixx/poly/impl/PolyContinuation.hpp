@@ -0,0 +1,260 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYCONTINUATION_HPP
+#define NUMERIXX_POLYCONTINUATION_HPP
+
+// ===== Numerixx Includes
+#include "PolyAberth.hpp"
+#include "Polyroots.hpp"
+#include <Constants.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief The maximum number of Aberth sweeps for following the roots from one step to the next.
+         *
+         * @note On a smooth sweep, the previous roots are within the region of cubic convergence, and two or
+         * three sweeps suffice. Needing more means that the step was too large to be tracked reliably, and
+         * it is cheaper to solve from scratch than to keep iterating.
+         */
+        inline constexpr int CONTINUATION_MAX_SWEEPS = 16;
+
+        /**
+         * @brief Checks whether each root stayed closer to its previous position than to any other previous root.
+         *
+         * Each root must have moved by less than half the distance from its previous position to the nearest
+         * other previous root. The disks of this radius are disjoint, so no two roots may have swapped or
+         * converged to the same root.
+         *
+         * @param previous The roots at the previous step.
+         * @param current The roots at the current step, in the same order.
+         * @return true if the identity of every root is preserved, false otherwise.
+         */
+        template< typename FLOAT_T >
+        inline bool rootsTracked(std::span< const std::complex< FLOAT_T > > previous, std::span< const std::complex< FLOAT_T > > current)
+        {
+            for (std::size_t i = 0; i < previous.size(); ++i) {
+                FLOAT_T separation = std::numeric_limits< FLOAT_T >::infinity();
+                for (std::size_t j = 0; j < previous.size(); ++j)
+                    if (j != i) separation = std::min(separation, std::abs(previous[i] - previous[j]));
+                if (!(std::abs(current[i] - previous[i]) < separation / 2)) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Orders a set of roots to match a previous set, pairing the closest roots first.
+         *
+         * @param previous The roots at the previous step.
+         * @param found The roots at the current step, in no particular order; must have the same size as previous.
+         * @param matched The destination for the roots of found, where matched[i] is the root paired with previous[i].
+         */
+        template< typename FLOAT_T >
+        inline void matchRoots(std::span< const std::complex< FLOAT_T > > previous,
+                               std::span< const std::complex< FLOAT_T > > found,
+                               std::span< std::complex< FLOAT_T > >       matched)
+        {
+            struct Pair
+            {
+                FLOAT_T     distance;
+                std::size_t from;
+                std::size_t to;
+            };
+
+            const std::size_t   n = previous.size();
+            std::vector< Pair > pairs;
+            pairs.reserve(n * n);
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t j = 0; j < n; ++j) pairs.push_back({ std::abs(previous[i] - found[j]), i, j });
+            std::sort(pairs.begin(), pairs.end(), [](const Pair& a, const Pair& b) { return a.distance < b.distance; });
+
+            std::vector< char > fromUsed(n, 0);
+            std::vector< char > toUsed(n, 0);
+            for (const auto& pair : pairs) {
+                if (fromUsed[pair.from] || toUsed[pair.to]) continue;
+                matched[pair.from] = found[pair.to];
+                fromUsed[pair.from] = toUsed[pair.to] = 1;
+            }
+        }
+    }    // namespace detail
+
+    /**
+     * @brief Follows the roots of a polynomial whose coefficients vary smoothly, e.g. along a parameter sweep.
+     *
+     * The first call to track() finds all roots from scratch (using AutoSolver). Each following call uses the
+     * roots of the previous call as the initial estimates of the Aberth–Ehrlich iteration (see aberth()),
+     * which refines them simultaneously, and typically converges in a few sweeps instead of the many
+     * iterations of a cold start. The roots are kept in a fixed order, so roots[i] at one step is the
+     * continuation of roots[i] at the previous step.
+     *
+     * If the iteration does not converge within a few sweeps, or if a root moved so far that its identity
+     * is ambiguous (see detail::rootsTracked()), the polynomial is solved from scratch instead, and the
+     * roots are matched to the previous ones by distance. If the order of the polynomial changes, the roots
+     * are solved from scratch and their order starts anew.
+     *
+     * The storage for the roots and coefficients is kept between calls, so it is only allocated while it
+     * grows to the order of the polynomial.
+     *
+     * @tparam FLOAT_T The floating point type of the roots.
+     */
+    template< typename FLOAT_T >
+    class RootTracker
+    {
+        using COMPLEX_T = std::complex< FLOAT_T >;
+
+        std::vector< COMPLEX_T > m_roots {};        /**< The roots at the current step, in tracking order. */
+        std::vector< COMPLEX_T > m_previous {};     /**< The roots at the previous step. */
+        std::vector< COMPLEX_T > m_coefficients {}; /**< The coefficients of the current polynomial, as complex numbers. */
+        AutoSolver<>             m_solver {};       /**< The solver used when the roots are solved from scratch. */
+        std::size_t              m_steps { 0 };     /**< The number of steps tracked so far. */
+        std::size_t              m_fallbacks { 0 }; /**< The number of steps that had to be solved from scratch. */
+
+    public:
+        /**
+         * @brief Constructs a tracker without roots; the first step is solved from scratch.
+         */
+        RootTracker() = default;
+
+        /**
+         * @brief Constructs a tracker from known roots, which are used as the estimates for the first step.
+         *
+         * @param roots The roots of the polynomial preceding the first step.
+         */
+        explicit RootTracker(std::span< const COMPLEX_T > roots)
+            : m_roots(roots.begin(), roots.end())
+        {}
+
+        /**
+         * @brief Finds the roots of the next polynomial of the sweep, starting from the current roots.
+         *
+         * @param poly A polynomial, which should satisfy the IsPolynomial concept. Its coefficients may be real
+         * or complex.
+         * @param tolerance The convergence tolerance. Defaults to nxx::EPS.
+         * @param max_iterations The maximum number of iterations, when solving from scratch. Defaults to nxx::MAXITER.
+         * @return The roots, in tracking order, or a NumerixxError if solving from scratch failed. The range
+         * remains valid until the next call to a non-const member function.
+         *
+         * @throws NumerixxError if the tolerance, the maximum number of iterations or the order of the polynomial is invalid.
+         */
+        auto track(const IsPolynomial auto& poly, FLOAT_T tolerance = nxx::EPS, int max_iterations = nxx::MAXITER)
+            -> tl::expected< std::span< const COMPLEX_T >, NumerixxError >
+        {
+            using EXPECTED_T = tl::expected< std::span< const COMPLEX_T >, NumerixxError >;
+
+            impl::validateTolerance(tolerance);
+            impl::validateMaxIterations(max_iterations);
+            impl::validatePolynomialOrder(poly.order(), 1ull);
+
+            const std::size_t order = poly.order();
+            m_coefficients.resize(order + 1);
+            std::transform(poly.begin(), poly.begin() + static_cast< std::ptrdiff_t >(order + 1), m_coefficients.begin(), [](const auto& c) {
+                return static_cast< COMPLEX_T >(c);
+            });
+            const auto coeffs = std::span< const COMPLEX_T >(m_coefficients);
+
+            ++m_steps;
+            const bool continued = m_roots.size() == order;
+            if (continued) {
+                m_previous.assign(m_roots.begin(), m_roots.end());
+                const int sweeps = std::min(max_iterations, detail::CONTINUATION_MAX_SWEEPS);
+                if (detail::aberthIterate(coeffs, std::span< COMPLEX_T >(m_roots), tolerance, sweeps) &&
+                    detail::rootsTracked(std::span< const COMPLEX_T >(m_previous), std::span< const COMPLEX_T >(m_roots)))
+                    return EXPECTED_T(std::span< const COMPLEX_T >(m_roots));
+            }
+            if (!m_roots.empty()) ++m_fallbacks;
+
+            // ===== Solve from scratch, and keep the identity of the roots where possible.
+            auto found = m_solver.solve(Polynomial< COMPLEX_T >(std::vector< COMPLEX_T >(coeffs.begin(), coeffs.end())), tolerance, max_iterations);
+            if (!found) [[unlikely]] {
+                m_roots.clear();
+                return EXPECTED_T(tl::unexpected(found.error()));
+            }
+            if (continued && found->size() == order) {
+                m_roots.resize(order);
+                detail::matchRoots(std::span< const COMPLEX_T >(m_previous), std::span< const COMPLEX_T >(*found), std::span< COMPLEX_T >(m_roots));
+            }
+            else
+                m_roots = std::move(*found);
+
+            return EXPECTED_T(std::span< const COMPLEX_T >(m_roots));
+        }
+
+        /**
+         * @brief Returns the roots at the current step, in tracking order.
+         */
+        [[nodiscard]]
+        std::span< const COMPLEX_T > roots() const
+        {
+            return m_roots;
+        }
+
+        /**
+         * @brief Returns the number of steps tracked so far.
+         */
+        [[nodiscard]]
+        std::size_t steps() const
+        {
+            return m_steps;
+        }
+
+        /**
+         * @brief Returns the number of steps that could not be tracked, and were solved from scratch.
+         */
+        [[nodiscard]]
+        std::size_t fallbacks() const
+        {
+            return m_fallbacks;
+        }
+
+        /**
+         * @brief Forgets the current roots, so the next step is solved from scratch.
+         */
+        void reset()
+        {
+            m_roots.clear();
+            m_steps     = 0;
+            m_fallbacks = 0;
+        }
+    };
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYCONTINUATION_HPP
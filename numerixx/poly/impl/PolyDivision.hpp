@@ -0,0 +1,197 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef NUMERIXX_POLYDIVISION_HPP
+#define NUMERIXX_POLYDIVISION_HPP
+
+// ===== Numerixx Includes
+#include "PolyMultiplication.hpp"
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace nxx::poly::detail
+{
+    /**
+     * @brief The length of the divisor and of the quotient from which Newton division is used.
+     *
+     * @note Newton division costs a handful of multiplications, so it only pays off once these run
+     * on the FFT kernel. The threshold was determined with benchPolynomial (BM_PolyDivide*).
+     */
+    inline constexpr std::size_t NEWTON_DIVISION_THRESHOLD = 3072;
+
+    /**
+     * @brief Divides a polynomial by a linear factor (x - root) in place, using synthetic division.
+     *
+     * @param coeffs The coefficients of the dividend, in increasing order of degree. On return, the first
+     * coeffs.size() - 1 elements hold the quotient; the last element is left unchanged.
+     * @param root The root of the linear factor.
+     * @return The remainder, i.e. the value of the dividend at root.
+     */
+    template< typename TYPE >
+    inline TYPE deflateLinear(std::span< TYPE > coeffs, TYPE root)
+    {
+        const std::size_t n     = coeffs.size() - 1;
+        TYPE              carry = coeffs[n];
+        for (std::size_t k = n; k-- > 0;) {
+            const TYPE next = coeffs[k] + root * carry;
+            coeffs[k]       = carry;
+            carry           = next;
+        }
+        return carry;
+    }
+
+    /**
+     * @brief Divides a polynomial by a monic quadratic factor (x^2 + p*x + q) in place.
+     *
+     * @param coeffs The coefficients of the dividend, in increasing order of degree. On return, the first
+     * coeffs.size() - 2 elements hold the quotient; the last two elements are left unchanged.
+     * @param p The linear coefficient of the quadratic factor.
+     * @param q The constant coefficient of the quadratic factor.
+     * @return The coefficients of the remainder {r0, r1}, i.e. r0 + r1*x.
+     */
+    template< typename TYPE >
+    inline std::array< TYPE, 2 > deflateQuadratic(std::span< TYPE > coeffs, TYPE p, TYPE q)
+    {
+        // ===== Each quotient coefficient overwrites a dividend coefficient that is still needed two steps
+        // later, so the last two original coefficients (o1, o2) and quotient coefficients (q1, q2) are carried.
+        const std::size_t n  = coeffs.size() - 1;
+        TYPE              o2 = coeffs[n];
+        TYPE              o1 = coeffs[n - 1];
+        TYPE              q1 {};
+        TYPE              q2 {};
+        for (std::size_t k = n - 1; k-- > 0;) {
+            const TYPE quot = o2 - p * q1 - q * q2;
+            o2              = o1;
+            o1              = coeffs[k];
+            coeffs[k]       = quot;
+            q2              = q1;
+            q1              = quot;
+        }
+        return { o1 - q * q1, o2 - p * q1 - q * q2 };
+    }
+
+    /**
+     * @brief Divides two coefficient sequences using schoolbook long division.
+     *
+     * @param remainder On entry, the coefficients of the dividend. On return, the first b.size() - 1
+     * elements hold the remainder; the rest are left in an unspecified state.
+     * @param b The coefficients of the divisor. The leading coefficient must be non-zero.
+     * @param quotient The destination for the quotient; must hold remainder.size() - b.size() + 1 elements.
+     */
+    template< typename TYPE >
+    inline void divideSchoolbook(std::span< TYPE > remainder, std::span< const TYPE > b, std::span< TYPE > quotient)
+    {
+        const std::size_t m    = b.size() - 1;
+        const TYPE        lead = b[m];
+        for (std::size_t k = quotient.size(); k-- > 0;) {
+            const TYPE coef = remainder[k + m] / lead;
+            quotient[k]     = coef;
+            TYPE* dest      = remainder.data() + k;
+            for (std::size_t j = 0; j < m; ++j) dest[j] -= coef * b[j];
+        }
+    }
+
+    /**
+     * @brief Computes the first out.size() coefficients of the power series inverse 1/f, using Newton iteration.
+     *
+     * Starting from g = 1/f[0], each step g <- g * (2 - f*g) doubles the number of correct coefficients.
+     *
+     * @param f The coefficients of the power series. f[0] must be non-zero.
+     * @param out The destination for the coefficients of the inverse.
+     */
+    template< typename TYPE >
+    inline void seriesInverse(std::span< const TYPE > f, std::span< TYPE > out)
+    {
+        const std::size_t size = out.size();
+        std::vector< TYPE > product(2 * size);
+        std::vector< TYPE > correction(size);
+
+        out[0] = TYPE { 1 } / f[0];
+        for (std::size_t len = 1; len < size;) {
+            const std::size_t next = std::min(2 * len, size);
+            const std::size_t flen = std::min(next, f.size());
+
+            // ===== correction = (2 - f*g) mod x^next
+            multiply(f.first(flen), std::span< const TYPE >(out.first(len)), std::span< TYPE >(product).first(flen + len - 1));
+            for (std::size_t i = flen + len - 1; i < next; ++i) product[i] = TYPE {};
+            for (std::size_t i = 0; i < next; ++i) correction[i] = -product[i];
+            correction[0] += TYPE { 2 };
+
+            // ===== g = g * correction mod x^next
+            multiply(std::span< const TYPE >(out.first(len)), std::span< const TYPE >(correction).first(next), std::span< TYPE >(product).first(len + next - 1));
+            std::copy(product.begin(), product.begin() + static_cast< std::ptrdiff_t >(next), out.begin());
+            len = next;
+        }
+    }
+
+    /**
+     * @brief Divides two coefficient sequences using Newton iteration on the reversed polynomials.
+     *
+     * With rev(p) denoting the coefficients of p in reverse order, the quotient satisfies
+     * rev(q) = rev(a) / rev(b) mod x^(n - m + 1), where n and m are the orders of a and b. The inverse of
+     * rev(b) is computed by seriesInverse, so the cost is a small multiple of the cost of a multiplication.
+     *
+     * @param a The coefficients of the dividend.
+     * @param b The coefficients of the divisor. The leading coefficient must be non-zero.
+     * @param quotient The destination for the quotient; must hold a.size() - b.size() + 1 elements.
+     * @param remainder The destination for the remainder; must hold b.size() - 1 elements.
+     */
+    template< typename TYPE >
+    inline void divideNewton(std::span< const TYPE > a, std::span< const TYPE > b, std::span< TYPE > quotient, std::span< TYPE > remainder)
+    {
+        const std::size_t qlen = quotient.size();
+
+        std::vector< TYPE > reversed(qlen);
+        std::vector< TYPE > inverse(qlen);
+        std::vector< TYPE > product(std::max(a.size(), 2 * qlen - 1));
+
+        // ===== rev(q) = rev(a) * rev(b)^-1 mod x^qlen
+        const std::size_t blen = std::min(qlen, b.size());
+        std::reverse_copy(b.end() - static_cast< std::ptrdiff_t >(blen), b.end(), reversed.begin());
+        seriesInverse(std::span< const TYPE >(reversed).first(blen), std::span< TYPE >(inverse));
+
+        std::reverse_copy(a.end() - static_cast< std::ptrdiff_t >(qlen), a.end(), reversed.begin());
+        multiply(std::span< const TYPE >(reversed), std::span< const TYPE >(inverse), std::span< TYPE >(product).first(2 * qlen - 1));
+        std::reverse_copy(product.begin(), product.begin() + static_cast< std::ptrdiff_t >(qlen), quotient.begin());
+
+        // ===== r = a - b*q, of which only the terms below the order of b are needed.
+        multiply(b, std::span< const TYPE >(quotient), std::span< TYPE >(product).first(a.size()));
+        for (std::size_t i = 0; i < remainder.size(); ++i) remainder[i] = a[i] - product[i];
+    }
+
+}    // namespace nxx::poly::detail
+
+#endif    // NUMERIXX_POLYDIVISION_HPP
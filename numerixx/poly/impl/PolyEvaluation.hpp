@@ -0,0 +1,565 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYEVALUATION_HPP
+#define NUMERIXX_POLYEVALUATION_HPP
+
+// ===== Numerixx Includes
+#include <Concepts.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief The number of independent evaluation points processed together by the batched kernels.
+         *
+         * Each lane carries its own Horner accumulator, so the inner loop over the lanes has no loop-carried
+         * dependency and maps directly onto the SIMD registers of the target. Eight lanes fill an AVX-512
+         * register for double, or two AVX2 registers, which also hides the latency of the multiply-add chain.
+         */
+        inline constexpr std::size_t POLY_BATCH_LANES = 8;
+
+        /**
+         * @brief Computes a * b + c, using a fused multiply-add where the target supports it natively.
+         *
+         * std::fma is only used when the FP_FAST_FMA* macros signal a hardware instruction; otherwise the
+         * call would dispatch to a (slow) software emulation in the math library. For complex and
+         * multiprecision types, and in constant evaluation, the plain expression is used.
+         *
+         * @param a The first factor.
+         * @param b The second factor.
+         * @param c The addend.
+         * @return The value of a * b + c.
+         */
+        template< typename T >
+        constexpr T fmadd(const T& a, const T& b, const T& c)
+        {
+            if (std::is_constant_evaluated()) return a * b + c;
+#if defined(FP_FAST_FMA)
+            if constexpr (std::same_as< T, double >) return std::fma(a, b, c);
+#endif
+#if defined(FP_FAST_FMAF)
+            if constexpr (std::same_as< T, float >) return std::fma(a, b, c);
+#endif
+#if defined(FP_FAST_FMAL)
+            if constexpr (std::same_as< T, long double >) return std::fma(a, b, c);
+#endif
+            return a * b + c;
+        }
+
+        /**
+         * @brief Checks if a real or complex value is finite.
+         */
+        template< typename T >
+        inline bool isFinite(const T& value)
+        {
+            using std::isfinite;
+            if constexpr (IsComplex< T >)
+                return isfinite(value.real()) && isfinite(value.imag());
+            else
+                return isfinite(value);
+        }
+
+        /**
+         * @brief Evaluates a polynomial at a range of points, using Horner's method across several lanes at once.
+         *
+         * The points are processed in blocks of POLY_BATCH_LANES. Within a block, the loop over the coefficients
+         * is the outer loop and the loop over the lanes is the inner loop, which allows the compiler to keep
+         * the accumulators in vector registers. The remaining points are evaluated one at a time.
+         *
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param x The points at which to evaluate the polynomial.
+         * @param out The destination of the results. Must have the same size as x.
+         */
+        template< typename T >
+        inline void hornerBatch(std::span< const T > coeffs, std::span< const T > x, std::span< T > out)
+        {
+            const std::size_t n    = coeffs.size();
+            const T           lead = coeffs[n - 1];
+
+            std::size_t i = 0;
+            for (; i + POLY_BATCH_LANES <= x.size(); i += POLY_BATCH_LANES) {
+                T acc[POLY_BATCH_LANES];
+                T arg[POLY_BATCH_LANES];
+                for (std::size_t l = 0; l < POLY_BATCH_LANES; ++l) {
+                    acc[l] = lead;
+                    arg[l] = x[i + l];
+                }
+
+                for (std::size_t k = n - 1; k-- > 0;) {
+                    const T coeff = coeffs[k];
+                    for (std::size_t l = 0; l < POLY_BATCH_LANES; ++l) acc[l] = fmadd(acc[l], arg[l], coeff);
+                }
+
+                std::copy(acc, acc + POLY_BATCH_LANES, out.begin() + static_cast< std::ptrdiff_t >(i));
+            }
+
+            for (; i < x.size(); ++i) {
+                T acc = lead;
+                for (std::size_t k = n - 1; k-- > 0;) acc = fmadd(acc, x[i], coeffs[k]);
+                out[i] = acc;
+            }
+        }
+
+        /**
+         * @brief Evaluates a polynomial at a single point, using Horner's method.
+         *
+         * This is one serial chain of dependent multiply-adds, which makes it the fastest scheme for low
+         * degrees, but its latency grows linearly with the degree.
+         *
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param x The point at which to evaluate the polynomial.
+         * @return The value of the polynomial at x.
+         */
+        template< typename TYPE, typename T >
+        constexpr TYPE hornerEval(std::span< const T > coeffs, TYPE x)
+        {
+            TYPE acc = static_cast< TYPE >(coeffs.back());
+            for (std::size_t k = coeffs.size() - 1; k-- > 0;) acc = fmadd(acc, x, static_cast< TYPE >(coeffs[k]));
+            return acc;
+        }
+
+        /**
+         * @brief Evaluates a polynomial at a single point, using a second-order Horner scheme.
+         *
+         * The polynomial is split into its even and odd parts, p(x) = E(x^2) + x * O(x^2), which are evaluated
+         * as two independent Horner chains in x^2. This halves the length of the dependency chain at the cost
+         * of one extra multiplication.
+         *
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param x The point at which to evaluate the polynomial.
+         * @return The value of the polynomial at x.
+         */
+        template< typename TYPE, typename T >
+        inline TYPE horner2Eval(std::span< const T > coeffs, TYPE x)
+        {
+            const std::size_t n = coeffs.size();
+            if (n < 3) return hornerEval(coeffs, x);
+
+            const TYPE x2 = x * x;
+
+            // ===== Start both chains at the highest even and odd coefficients.
+            std::size_t ie   = (n - 1) % 2 == 0 ? n - 1 : n - 2;
+            std::size_t io   = (n - 1) % 2 == 0 ? n - 2 : n - 1;
+            TYPE        even = static_cast< TYPE >(coeffs[ie]);
+            TYPE        odd  = static_cast< TYPE >(coeffs[io]);
+
+            // ===== Both chains advance by one power of x^2 per iteration.
+            while (io >= 3) {
+                ie -= 2;
+                io -= 2;
+                even = fmadd(even, x2, static_cast< TYPE >(coeffs[ie]));
+                odd  = fmadd(odd, x2, static_cast< TYPE >(coeffs[io]));
+            }
+            if (ie >= 2) even = fmadd(even, x2, static_cast< TYPE >(coeffs[ie - 2]));
+
+            return fmadd(odd, x, even);
+        }
+
+        /**
+         * @brief Evaluates a polynomial at a single point, using Estrin's scheme.
+         *
+         * The coefficients are processed in blocks of eight. Each block is a degree-7 polynomial that is
+         * evaluated with Estrin's scheme, i.e. by combining pairs of terms with x, then pairs of pairs with x^2,
+         * and finally the two halves with x^4. The blocks are independent of each other, and are combined with
+         * Horner's method in x^8. The critical path is therefore about n/8 multiply-adds rather than n, and no
+         * intermediate storage is needed.
+         *
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param x The point at which to evaluate the polynomial.
+         * @return The value of the polynomial at x.
+         */
+        template< typename TYPE, typename T >
+        inline TYPE estrinEval(std::span< const T > coeffs, TYPE x)
+        {
+            const std::size_t n = coeffs.size();
+            if (n < 4) return hornerEval(coeffs, x);
+
+            const TYPE x2 = x * x;
+            const TYPE x4 = x2 * x2;
+            const TYPE x8 = x4 * x4;
+
+            auto block = [&](std::size_t pos) {
+                auto c = [&](std::size_t i) { return static_cast< TYPE >(coeffs[pos + i]); };
+                const TYPE p01 = fmadd(c(1), x, c(0));
+                const TYPE p23 = fmadd(c(3), x, c(2));
+                const TYPE p45 = fmadd(c(5), x, c(4));
+                const TYPE p67 = fmadd(c(7), x, c(6));
+                return fmadd(fmadd(p67, x2, p45), x4, fmadd(p23, x2, p01));
+            };
+
+            // ===== The highest (possibly partial) block is evaluated with Horner's method.
+            const std::size_t full = n / 8;
+            const std::size_t rest = n % 8;
+            TYPE              acc  = rest == 0 ? block(8 * (full - 1)) : hornerEval(coeffs.subspan(8 * full), x);
+
+            for (std::size_t j = (rest == 0 ? full - 1 : full); j-- > 0;) acc = fmadd(acc, x8, block(8 * j));
+            return acc;
+        }
+
+
+        /**
+         * @brief Evaluates a polynomial and its first K derivatives at a single point, in one sweep.
+         *
+         * This is the extended Horner scheme: alongside the usual Horner accumulator, K further accumulators
+         * are updated per coefficient, each one lagging one step behind the previous. After the sweep, the
+         * k'th accumulator holds p^(k)(x) / k!, which is then scaled by k!. No derivative polynomials are
+         * formed, so nothing is allocated.
+         *
+         * @tparam K The number of derivatives to compute.
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param x The point at which to evaluate the polynomial.
+         * @return An array holding p(x), p'(x), ..., p^(K)(x).
+         */
+        template< std::size_t K, typename TYPE, typename T >
+        constexpr std::array< TYPE, K + 1 > hornerDerivatives(std::span< const T > coeffs, TYPE x)
+        {
+            std::array< TYPE, K + 1 > acc {};
+            acc[0] = static_cast< TYPE >(coeffs.back());
+
+            const std::size_t n = coeffs.size();
+            for (std::size_t k = n - 1; k-- > 0;) {
+                for (std::size_t j = std::min(K, n - 1 - k); j > 0; --j) acc[j] = fmadd(acc[j], x, acc[j - 1]);
+                acc[0] = fmadd(acc[0], x, static_cast< TYPE >(coeffs[k]));
+            }
+
+            // ===== Convert the Taylor coefficients to derivatives.
+            using FLOAT_T  = decltype(std::abs(x));
+            FLOAT_T factor = 1;
+            for (std::size_t j = 2; j <= K; ++j) {
+                factor *= static_cast< FLOAT_T >(j);
+                acc[j] *= factor;
+            }
+
+            return acc;
+        }
+
+        /**
+         * @brief Whether the target has a hardware fused multiply-add for the floating point type T.
+         */
+        template< typename T >
+        inline constexpr bool HasFastFma =
+#if defined(FP_FAST_FMA)
+            std::same_as< T, double > ||
+#endif
+#if defined(FP_FAST_FMAF)
+            std::same_as< T, float > ||
+#endif
+#if defined(FP_FAST_FMAL)
+            std::same_as< T, long double > ||
+#endif
+            false;
+
+        /**
+         * @brief Concept for the types supported by the error-free transformations: the standard floating
+         * point types, and std::complex of these.
+         */
+        template< typename T >
+        concept IsErrorFreeType = std::floating_point< T > || (IsComplex< T > && std::floating_point< typename T::value_type >);
+
+        /**
+         * @brief Computes the sum of two numbers as s + e exactly, where s = fl(a + b) (Knuth's TwoSum).
+         *
+         * @return An array holding {s, e}.
+         */
+        template< std::floating_point T >
+        constexpr std::array< T, 2 > twoSum(T a, T b)
+        {
+            const T sum       = a + b;
+            const T virtual_b = sum - a;
+            return { sum, (a - (sum - virtual_b)) + (b - virtual_b) };
+        }
+
+        /**
+         * @brief Computes the sum of two complex numbers as s + e exactly, applying TwoSum to each component.
+         */
+        template< std::floating_point T >
+        constexpr std::array< std::complex< T >, 2 > twoSum(const std::complex< T >& a, const std::complex< T >& b)
+        {
+            const auto [re, re_err] = twoSum(a.real(), b.real());
+            const auto [im, im_err] = twoSum(a.imag(), b.imag());
+            return { std::complex< T >(re, im), std::complex< T >(re_err, im_err) };
+        }
+
+        /**
+         * @brief Computes the product of two numbers as p + e exactly, where p = fl(a * b) (TwoProduct).
+         *
+         * With a hardware fused multiply-add, the error is fma(a, b, -p). Otherwise, both factors are split
+         * into two halves (Veltkamp splitting), whose products are exact (Dekker's algorithm).
+         *
+         * @return An array holding {p, e}.
+         */
+        template< std::floating_point T >
+        constexpr std::array< T, 2 > twoProduct(T a, T b)
+        {
+            const T product = a * b;
+            if constexpr (HasFastFma< T >)
+                if (!std::is_constant_evaluated()) return { product, std::fma(a, b, -product) };
+
+            constexpr T splitter = [] {
+                T factor = 1;
+                for (int i = 0; i < (std::numeric_limits< T >::digits + 1) / 2; ++i) factor *= 2;
+                return factor + 1;
+            }();
+            const auto split = [](T value) {
+                const T scaled = splitter * value;
+                const T high   = scaled - (scaled - value);
+                return std::array< T, 2 > { high, value - high };
+            };
+
+            const auto [a_hi, a_lo] = split(a);
+            const auto [b_hi, b_lo] = split(b);
+            return { product, a_lo * b_lo - (((product - a_hi * b_hi) - a_lo * b_hi) - a_hi * b_lo) };
+        }
+
+        /**
+         * @brief Computes the product of two complex numbers as p + e, where p is the product computed from
+         * the four real products, and e is their combined rounding error. The error is exact up to the
+         * rounding of its own components, which is of second order.
+         */
+        template< std::floating_point T >
+        constexpr std::array< std::complex< T >, 2 > twoProduct(const std::complex< T >& a, const std::complex< T >& b)
+        {
+            const auto [rr, rr_err] = twoProduct(a.real(), b.real());
+            const auto [ii, ii_err] = twoProduct(a.imag(), b.imag());
+            const auto [ri, ri_err] = twoProduct(a.real(), b.imag());
+            const auto [ir, ir_err] = twoProduct(a.imag(), b.real());
+            const auto [re, re_err] = twoSum(rr, -ii);
+            const auto [im, im_err] = twoSum(ri, ir);
+            return { std::complex< T >(re, im), std::complex< T >(rr_err - ii_err + re_err, ri_err + ir_err + im_err) };
+        }
+
+        /**
+         * @brief Evaluates a polynomial at a single point, using the compensated Horner scheme (CompHorner).
+         *
+         * Each multiply-add of Horner's method is replaced by TwoProduct and TwoSum, and the rounding errors
+         * are accumulated by a second Horner chain, which is added to the result at the end. The result is
+         * as accurate as if it had been computed with twice the working precision and then rounded, i.e. the
+         * relative error is about eps + cond * eps^2 instead of cond * eps, where cond is the condition number
+         * of the evaluation. This matters close to clustered or multiple roots, where cond is large. The cost
+         * is about 2-4 times that of plain Horner (more without a hardware fused multiply-add).
+         *
+         * For types that are not supported by the error-free transformations (e.g. multiprecision types),
+         * plain Horner is used.
+         *
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param x The point at which to evaluate the polynomial.
+         * @return The value of the polynomial at x.
+         */
+        template< typename TYPE, typename T >
+        constexpr TYPE compHornerEval(std::span< const T > coeffs, TYPE x)
+        {
+            if constexpr (!IsErrorFreeType< TYPE >)
+                return hornerEval(coeffs, x);
+            else {
+                TYPE sum   = static_cast< TYPE >(coeffs.back());
+                TYPE error = 0;
+                for (std::size_t k = coeffs.size() - 1; k-- > 0;) {
+                    const auto [product, product_err] = twoProduct(sum, x);
+                    const auto [next, sum_err]        = twoSum(product, static_cast< TYPE >(coeffs[k]));
+                    sum                               = next;
+                    error                             = fmadd(error, x, product_err + sum_err);
+                }
+                return sum + error;
+            }
+        }
+
+        /**
+         * @brief Evaluates a polynomial and its first K derivatives at a single point, where the value is
+         * computed with the compensated Horner scheme (see compHornerEval()).
+         *
+         * The derivatives are computed with the extended Horner scheme (see hornerDerivatives()), in the same
+         * sweep. Close to a root, only the value suffers from cancellation, so this gives Newton and Laguerre
+         * iterations the accuracy of CompHorner at little extra cost.
+         *
+         * @tparam K The number of derivatives to compute.
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param x The point at which to evaluate the polynomial.
+         * @return An array holding p(x), p'(x), ..., p^(K)(x).
+         */
+        template< std::size_t K, typename TYPE, typename T >
+        constexpr std::array< TYPE, K + 1 > compHornerDerivatives(std::span< const T > coeffs, TYPE x)
+        {
+            if constexpr (!IsErrorFreeType< TYPE >)
+                return hornerDerivatives< K >(coeffs, x);
+            else {
+                std::array< TYPE, K + 1 > acc {};
+                acc[0]     = static_cast< TYPE >(coeffs.back());
+                TYPE error = 0;
+
+                const std::size_t n = coeffs.size();
+                for (std::size_t k = n - 1; k-- > 0;) {
+                    for (std::size_t j = std::min(K, n - 1 - k); j > 0; --j) acc[j] = fmadd(acc[j], x, acc[j - 1]);
+                    const auto [product, product_err] = twoProduct(acc[0], x);
+                    const auto [next, sum_err]        = twoSum(product, static_cast< TYPE >(coeffs[k]));
+                    acc[0]                            = next;
+                    error                             = fmadd(error, x, product_err + sum_err);
+                }
+                acc[0] += error;
+
+                // ===== Convert the Taylor coefficients to derivatives.
+                using FLOAT_T  = decltype(std::abs(x));
+                FLOAT_T factor = 1;
+                for (std::size_t j = 2; j <= K; ++j) {
+                    factor *= static_cast< FLOAT_T >(j);
+                    acc[j] *= factor;
+                }
+
+                return acc;
+            }
+        }
+
+    }    // namespace detail
+
+    /**
+     * @brief Evaluation strategy using Horner's method.
+     *
+     * Horner's method needs the fewest operations, but it forms one serial chain of dependent
+     * multiply-adds. It is the best choice for low-degree polynomials.
+     */
+    struct Horner
+    {
+        static constexpr bool IsEvaluationStrategy = true;
+
+        template< typename TYPE, typename T >
+        static TYPE evaluate(std::span< const T > coeffs, TYPE x)
+        {
+            return detail::hornerEval(coeffs, x);
+        }
+
+        template< std::size_t K, typename TYPE, typename T >
+        static std::array< TYPE, K + 1 > evaluateWithDerivatives(std::span< const T > coeffs, TYPE x)
+        {
+            return detail::hornerDerivatives< K >(coeffs, x);
+        }
+    };
+
+    /**
+     * @brief Evaluation strategy using the compensated Horner scheme (CompHorner).
+     *
+     * The rounding errors of Horner's method are computed with error-free transformations (TwoProduct and
+     * TwoSum, using fused multiply-adds where available) and added back, which gives about twice the working
+     * precision at 2-4 times the cost of Horner. Use it close to clustered or multiple roots, where plain
+     * evaluation loses most of its significant digits; it is much cheaper than switching to a multiprecision
+     * type. Types that do not support the transformations are evaluated with plain Horner.
+     */
+    struct CompensatedHorner
+    {
+        static constexpr bool IsEvaluationStrategy = true;
+
+        template< typename TYPE, typename T >
+        static TYPE evaluate(std::span< const T > coeffs, TYPE x)
+        {
+            return detail::compHornerEval(coeffs, x);
+        }
+
+        template< std::size_t K, typename TYPE, typename T >
+        static std::array< TYPE, K + 1 > evaluateWithDerivatives(std::span< const T > coeffs, TYPE x)
+        {
+            return detail::compHornerDerivatives< K >(coeffs, x);
+        }
+    };
+
+    /**
+     * @brief Evaluation strategy using a second-order Horner scheme.
+     *
+     * The even and odd parts of the polynomial are evaluated as two independent Horner chains in x^2,
+     * which halves the latency of plain Horner for medium degrees.
+     */
+    struct Horner2
+    {
+        static constexpr bool IsEvaluationStrategy = true;
+
+        template< typename TYPE, typename T >
+        static TYPE evaluate(std::span< const T > coeffs, TYPE x)
+        {
+            return detail::horner2Eval(coeffs, x);
+        }
+    };
+
+    /**
+     * @brief Evaluation strategy using Estrin's scheme.
+     *
+     * Blocks of eight coefficients are evaluated with Estrin's scheme, and combined with Horner's method
+     * in x^8. This exposes the most instruction-level parallelism and wins for high-degree polynomials.
+     */
+    struct Estrin
+    {
+        static constexpr bool IsEvaluationStrategy = true;
+
+        template< typename TYPE, typename T >
+        static TYPE evaluate(std::span< const T > coeffs, TYPE x)
+        {
+            return detail::estrinEval(coeffs, x);
+        }
+    };
+
+    /**
+     * @brief Evaluation strategy that picks Horner, Horner2 or Estrin based on the polynomial degree.
+     *
+     * This is the default strategy for Polynomial::evaluate. The thresholds are set from the benchmarks
+     * in benchmark/benchPolynomial.cpp.
+     */
+    struct AutoEvaluation
+    {
+        static constexpr bool        IsEvaluationStrategy = true;
+        static constexpr std::size_t Horner2Threshold     = 6;  /**< Lowest order evaluated with Horner2. */
+        static constexpr std::size_t EstrinThreshold      = 20; /**< Lowest order evaluated with Estrin. */
+
+        template< typename TYPE, typename T >
+        static TYPE evaluate(std::span< const T > coeffs, TYPE x)
+        {
+            const std::size_t order = coeffs.size() - 1;
+            if (order < Horner2Threshold) return detail::hornerEval(coeffs, x);
+            if (order < EstrinThreshold) return detail::horner2Eval(coeffs, x);
+            return detail::estrinEval(coeffs, x);
+        }
+    };
+
+    /**
+     * @brief Concept checking whether a type is a polynomial evaluation strategy.
+     */
+    template< typename STRATEGY >
+    concept IsEvaluationStrategy = STRATEGY::IsEvaluationStrategy;
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYEVALUATION_HPP
@@ -0,0 +1,296 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYGRID_HPP
+#define NUMERIXX_POLYGRID_HPP
+
+// ===== Numerixx Includes
+#include "PolyEvaluation.hpp"
+#include "PolyMultiplication.hpp"
+#include "Polynomial.hpp"
+#include <Concepts.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief The number of steps per lane after which gridDifferences() recomputes the difference table.
+         *
+         * @note Between the anchors, the rounding errors of the table grow like binomial coefficients in the
+         * number of steps. With the table computed from the Taylor coefficients, the error stays within a few
+         * ulps of the magnitude of the terms over an interval of this length; the interval was determined with
+         * benchPolynomial (BM_PolyEvaluateGrid) and the accuracy tests. The error is bounded by the terms of the
+         * Taylor expansion at the anchor over the distance covered, so coarser grids are anchored more often,
+         * after a distance of at most max(|x|, 1) / n for a polynomial of order n.
+         */
+        inline constexpr std::size_t GRID_ANCHOR_INTERVAL = 64;
+
+        /**
+         * @brief The highest order for which evaluateGrid() uses the forward difference table for complex polynomials.
+         *
+         * @note An addition replaces a fused multiply-add per coefficient, which only pays off where multiplication
+         * is markedly more expensive than addition, as for complex numbers. For real types, the batched Horner's
+         * method was faster at every order; for complex types, the table was faster up to order 16, and no faster
+         * than Horner at order 24, where the O(n^2) cost of the anchors dominates. The value was determined with
+         * benchPolynomial (BM_PolyEvaluateGridDifferences, BM_PolyEvaluateGridComplex).
+         */
+        inline constexpr std::size_t GRID_DIFFERENCE_MAX_ORDER = 16;
+
+        /**
+         * @brief The number of grid points generated at a time by gridHorner().
+         */
+        inline constexpr std::size_t GRID_CHUNK = 256;
+
+        /**
+         * @brief Computes the table of the numbers of surjections from a k-set onto a j-set, k! S(k, j), for
+         * 0 <= j <= k <= order.
+         *
+         * @param order The order of the polynomial.
+         * @return The table, with the entry (k, j) at k * (order + 1) + j.
+         */
+        template< typename FLOAT_T >
+        std::vector< FLOAT_T > surjectionTable(std::size_t order)
+        {
+            const std::size_t      n = order + 1;
+            std::vector< FLOAT_T > table(n * n);
+            table[0] = 1;
+            for (std::size_t k = 1; k < n; ++k)
+                for (std::size_t j = 1; j <= k; ++j)
+                    table[k * n + j] = static_cast< FLOAT_T >(j) * (table[(k - 1) * n + j] + table[(k - 1) * n + j - 1]);
+            return table;
+        }
+
+        /**
+         * @brief Computes the forward differences of a polynomial at a point, Δ^j p(x) for j = 0, ..., n, with step h.
+         *
+         * The differences are not formed from values of the polynomial, which would lose about one bit per order
+         * to cancellation, but from its Taylor coefficients t_k at x: Δ^j p(x) = sum_k j! S(k, j) t_k h^k. The
+         * Taylor coefficients are computed by repeated synthetic division, in O(n^2).
+         *
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param x The point.
+         * @param h The step.
+         * @param surjections The table from surjectionTable().
+         * @param out The destination for the differences; must hold coeffs.size() elements.
+         * @param work Scratch space; must hold coeffs.size() elements.
+         */
+        template< typename T, typename FLOAT_T >
+        void forwardDifferences(std::span< const T > coeffs, T x, T h, std::span< const FLOAT_T > surjections, std::span< T > out, std::span< T > work)
+        {
+            const std::size_t n = coeffs.size();
+            std::copy(coeffs.begin(), coeffs.end(), work.begin());
+            for (std::size_t i = 0; i + 1 < n; ++i)
+                for (std::size_t j = n - 1; j-- > i;) work[j] = fmadd(work[j + 1], x, work[j]);
+
+            T power = 1;
+            for (std::size_t k = 0; k < n; ++k) {
+                work[k] *= power;
+                power *= h;
+            }
+
+            for (std::size_t j = 0; j < n; ++j) {
+                T sum = 0;
+                for (std::size_t k = j; k < n; ++k) sum += surjections[k * n + j] * work[k];
+                out[j] = sum;
+            }
+        }
+
+        /**
+         * @brief Evaluates a polynomial on an equispaced grid, using a forward difference table.
+         *
+         * Once the table of differences Δ^j p(x) is known, the next point follows from n additions,
+         * Δ^j p(x + h) = Δ^j p(x) + Δ^(j+1) p(x), without any multiplications. The grid is split into LANES
+         * contiguous sub-grids, which are advanced together, so that the additions for the lanes form a vector
+         * operation. Every GRID_ANCHOR_INTERVAL steps, or after a distance of max(|x|, 1) / n if that is shorter,
+         * the tables are recomputed at the current points (see forwardDifferences()) to bound the growth of the
+         * rounding errors. Where fewer than n + 1 steps fit into that distance, e.g. for coarse grids close to the
+         * origin, the anchors do not pay off, and the points are evaluated with the batched Horner's method
+         * instead. The points left over after splitting the grid evenly are evaluated with Horner's method.
+         *
+         * @note The lanes are contiguous rather than interleaved, although interleaving would make the stores
+         * contiguous: the rounding errors grow with the distance covered between the anchors, raised to the power
+         * of the order, and interleaved lanes step LANES times as far.
+         *
+         * @tparam LANES The number of sub-grids; 1 gives the scalar scheme.
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param x0 The first point of the grid.
+         * @param h The spacing of the grid.
+         * @param out The destination for the values p(x0 + i h).
+         */
+        template< std::size_t LANES, typename T >
+        void gridDifferences(std::span< const T > coeffs, T x0, T h, std::span< T > out)
+        {
+            using FLOAT_T = typename FundamentalType< T >::type;
+            using std::abs;
+
+            const std::size_t n    = coeffs.size();
+            const std::size_t size = out.size() / LANES;    // The number of points per lane.
+
+            const auto       surjections = surjectionTable< FLOAT_T >(n - 1);
+            std::vector< T > table(n * LANES);    // Difference j of lane l is stored at j * LANES + l.
+            std::vector< T > differences(n);
+            std::vector< T > work(n);
+            std::vector< T > points(LANES * n);
+            std::vector< T > values(LANES * n);
+
+            const FLOAT_T order = static_cast< FLOAT_T >(std::max< std::size_t >(n - 1, 1));
+            for (std::size_t start = 0; start < size;) {
+                // ===== The steps to the next anchor, limited by the distance max(|x|, 1) / order for every lane.
+                std::size_t steps = std::min(GRID_ANCHOR_INTERVAL, size - start);
+                for (std::size_t l = 0; l < LANES; ++l) {
+                    const FLOAT_T reach = std::max(abs(x0 + h * static_cast< FLOAT_T >(l * size + start)), FLOAT_T(1)) / (order * abs(h));
+                    if (reach < static_cast< FLOAT_T >(steps)) steps = std::max(static_cast< std::size_t >(reach), std::size_t(1));
+                }
+
+                // ===== Too few steps to pay for the anchors: the points are evaluated with Horner's method.
+                if (steps < n) {
+                    for (std::size_t l = 0; l < LANES; ++l)
+                        for (std::size_t i = 0; i < steps; ++i)
+                            points[l * steps + i] = x0 + h * static_cast< FLOAT_T >(l * size + start + i);
+                    hornerBatch(coeffs, std::span< const T >(points).first(LANES * steps), std::span< T >(values).first(LANES * steps));
+                    for (std::size_t l = 0; l < LANES; ++l)
+                        std::copy_n(values.begin() + static_cast< std::ptrdiff_t >(l * steps),
+                                    steps,
+                                    out.begin() + static_cast< std::ptrdiff_t >(l * size + start));
+                    start += steps;
+                    continue;
+                }
+
+                for (std::size_t l = 0; l < LANES; ++l) {
+                    forwardDifferences(coeffs,
+                                       x0 + h * static_cast< FLOAT_T >(l * size + start),
+                                       h,
+                                       std::span< const FLOAT_T >(surjections),
+                                       std::span< T >(differences),
+                                       std::span< T >(work));
+                    for (std::size_t j = 0; j < n; ++j) table[j * LANES + l] = differences[j];
+                }
+
+                const std::size_t end = start + steps;
+                for (std::size_t i = start; i < end; ++i) {
+                    for (std::size_t l = 0; l < LANES; ++l) out[l * size + i] = table[l];
+                    for (std::size_t j = 0; j + 1 < n; ++j) {
+                        T* const       dst = table.data() + j * LANES;
+                        const T* const src = dst + LANES;
+#pragma omp simd
+                        for (std::size_t l = 0; l < LANES; ++l) dst[l] += src[l];
+                    }
+                }
+                start = end;
+            }
+
+            for (std::size_t i = size * LANES; i < out.size(); ++i) out[i] = hornerEval(coeffs, x0 + h * static_cast< FLOAT_T >(i));
+        }
+
+        /**
+         * @brief Evaluates a polynomial on an equispaced grid, using the batched Horner's method.
+         *
+         * The points are generated in chunks of GRID_CHUNK on the stack, as x0 + i h rather than by accumulation,
+         * and passed to hornerBatch().
+         *
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param x0 The first point of the grid.
+         * @param h The spacing of the grid.
+         * @param out The destination for the values p(x0 + i h).
+         */
+        template< typename T >
+        void gridHorner(std::span< const T > coeffs, T x0, T h, std::span< T > out)
+        {
+            using FLOAT_T = typename FundamentalType< T >::type;
+
+            std::array< T, GRID_CHUNK > points;
+            for (std::size_t start = 0; start < out.size(); start += GRID_CHUNK) {
+                const std::size_t size = std::min(GRID_CHUNK, out.size() - start);
+                for (std::size_t i = 0; i < size; ++i) points[i] = x0 + h * static_cast< FLOAT_T >(start + i);
+                hornerBatch(coeffs, std::span< const T >(points.data(), size), out.subspan(start, size));
+            }
+        }
+    }    // namespace detail
+
+    /**
+     * @brief Evaluates a polynomial on an equispaced grid, i.e. at the points x0, x0 + h, x0 + 2h, ...
+     *
+     * For complex polynomials of low order, the values are generated from a forward difference table, with n
+     * additions per point for a polynomial of order n and no multiplications. The grid is advanced as
+     * POLY_BATCH_LANES contiguous sub-grids, so the additions run as vector operations, and the table is
+     * recomputed from the polynomial at least every detail::GRID_ANCHOR_INTERVAL steps to keep the rounding
+     * errors bounded (see detail::gridDifferences). Otherwise, where a fused multiply-add costs no more than
+     * an addition, the points are evaluated with the batched Horner's method (see detail::gridHorner); the
+     * crossover is detail::GRID_DIFFERENCE_MAX_ORDER.
+     *
+     * The results agree with Polynomial::evaluate to a few ulps of the magnitude of the terms of the polynomial,
+     * so, like Horner's method, the relative accuracy degrades close to the roots.
+     *
+     * @param poly The polynomial to evaluate.
+     * @param x0 The first point of the grid.
+     * @param h The spacing of the grid.
+     * @param out The destination for the values; out[i] is set to p(x0 + i h).
+     */
+    template< typename T >
+    void evaluateGrid(const Polynomial< T >& poly, T x0, T h, std::span< T > out)
+    {
+        const auto coeffs = std::span< const T >(poly.coefficients());
+        if constexpr (IsComplex< T >) {
+            if (poly.order() <= detail::GRID_DIFFERENCE_MAX_ORDER) {
+                detail::gridDifferences< detail::POLY_BATCH_LANES >(coeffs, x0, h, out);
+                return;
+            }
+        }
+        detail::gridHorner(coeffs, x0, h, out);
+    }
+
+    /**
+     * @brief Evaluates a polynomial on an equispaced grid, i.e. at the points x0, x0 + h, x0 + 2h, ...
+     *
+     * @param poly The polynomial to evaluate.
+     * @param x0 The first point of the grid.
+     * @param h The spacing of the grid.
+     * @param count The number of points.
+     * @return A vector holding the values p(x0 + i h), for i = 0, ..., count - 1.
+     */
+    template< typename T >
+    std::vector< T > evaluateGrid(const Polynomial< T >& poly, T x0, T h, std::size_t count)
+    {
+        std::vector< T > result(count);
+        evaluateGrid(poly, x0, h, std::span< T >(result));
+        return result;
+    }
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYGRID_HPP
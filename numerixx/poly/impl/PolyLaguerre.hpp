@@ -0,0 +1,147 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+
+#ifndef NUMERIXX_POLYLAGUERRE_HPP
+#define NUMERIXX_POLYLAGUERRE_HPP
+
+// ===== Numerixx Includes
+#include <Constants.hpp>
+
+// ===== Standard Library Includes
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace nxx::poly::detail
+{
+    /**
+     * @brief The default seed of the perturbation sequence used by Laguerre's method.
+     */
+    inline constexpr std::uint64_t LAGUERRE_DEFAULT_SEED = 0x9E3779B97F4A7C15ull;
+
+    /**
+     * @brief The SplitMix64 finaliser, mapping a 64-bit integer to a well mixed 64-bit integer.
+     */
+    constexpr std::uint64_t splitMix64(std::uint64_t value)
+    {
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+    /**
+     * @brief Returns a pseudo-random number in [0, 1] for perturbing a Laguerre iteration.
+     *
+     * The sequence is counter based: the value depends only on the arguments, so no generator state is
+     * kept, and the same arguments always give the same number, on any platform.
+     *
+     * @param seed The seed of the sequence.
+     * @param stream The index of the sequence, e.g. the index of the root being searched for.
+     * @param counter The position in the sequence.
+     * @return A number uniformly distributed in [0, 1].
+     */
+    template< typename FLOAT_T >
+    constexpr FLOAT_T laguerrePerturbation(std::uint64_t seed, std::uint64_t stream, std::uint64_t counter)
+    {
+        const std::uint64_t bits = splitMix64(seed ^ splitMix64(stream ^ splitMix64(counter)));
+        return static_cast< FLOAT_T >(static_cast< double >(bits >> 11) * 0x1.0p-53);
+    }
+
+    /**
+     * @brief Searches for a root of a polynomial using Laguerre's method, without polishing.
+     *
+     * The step is replaced by a perturbation every 10 iterations, to break out of cycles. The perturbations
+     * are drawn from the counter based sequence laguerrePerturbation(seed, stream, i), so the result is
+     * reproducible. Nothing is allocated.
+     *
+     * @param evaluate A callable returning the polynomial value and its first and second derivatives at a
+     * point, as an array-like object.
+     * @param order The order of the polynomial.
+     * @param guess The initial estimate of the root.
+     * @param tolerance The convergence criterion, applied to the polynomial value and to the step.
+     * @param max_iterations The maximum number of iterations.
+     * @param seed The seed of the perturbation sequence.
+     * @param stream The index of the perturbation sequence.
+     * @return The root, or std::nullopt if the maximum number of iterations was reached.
+     */
+    template< typename FLOAT_T, typename EVAL >
+    inline std::optional< std::complex< FLOAT_T > > laguerreIterate(EVAL&&                  evaluate,
+                                                                    std::size_t             order,
+                                                                    std::complex< FLOAT_T > guess,
+                                                                    FLOAT_T                 tolerance,
+                                                                    int                     max_iterations,
+                                                                    std::uint64_t           seed,
+                                                                    std::uint64_t           stream)
+    {
+        using COMPLEX_T  = std::complex< FLOAT_T >;
+        using OPTIONAL_T = std::optional< COMPLEX_T >;
+
+        const COMPLEX_T n = static_cast< FLOAT_T >(order);
+
+        // Define a lambda function for computing the Laguerre step.
+        auto laguerrestep = [&](COMPLEX_T g_param, COMPLEX_T h_param) -> OPTIONAL_T {
+            const COMPLEX_T arg = std::sqrt((n - COMPLEX_T(1)) * (n * h_param - g_param * g_param));
+            const COMPLEX_T den = (abs(g_param + arg) > abs(g_param - arg) ? (g_param + arg) : (g_param - arg));
+            return (abs(den) < nxx::EPS ? OPTIONAL_T(std::nullopt) : OPTIONAL_T(n / den));
+        };
+
+        COMPLEX_T root = guess;
+        for (int i = 0;; ++i) {
+            // Evaluate the polynomial and its first and second derivatives in a single pass.
+            const auto [p, dp, d2p] = evaluate(root);
+
+            // If the absolute value of the polynomial evaluated at the root is less than the tolerance, return the root.
+            if (abs(p) < tolerance) return root;
+            if (i >= max_iterations) return std::nullopt;
+
+            // Calculate G and H for the Laguerre step. If the step is invalid, use a small value.
+            const COMPLEX_T G    = dp / p;
+            const COMPLEX_T H    = G * G - d2p / p;
+            OPTIONAL_T      step = laguerrestep(G, H);
+            if (!step) step = OPTIONAL_T(root * FLOAT_T(0.1));
+
+            // If the step is below the tolerance, stop.
+            if (abs(*step) < tolerance) return root;
+
+            // Perturb the step size every 10 iterations.
+            if (i % 10 == 0) *step = laguerrePerturbation< FLOAT_T >(seed, stream, static_cast< std::uint64_t >(i));
+
+            root -= *step;
+        }
+    }
+
+}    // namespace nxx::poly::detail
+
+#endif    // NUMERIXX_POLYLAGUERRE_HPP
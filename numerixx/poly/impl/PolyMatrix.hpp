@@ -0,0 +1,189 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYMATRIX_HPP
+#define NUMERIXX_POLYMATRIX_HPP
+
+// ===== Numerixx Includes
+#include "Polynomial.hpp"
+#include "StaticPolynomial.hpp"
+#include <Concepts.hpp>
+#include <Error.hpp>
+
+// ===== Standard Library Includes
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nxx::poly
+{
+    /**
+     * @brief Concept for the matrix types that polynomials can be evaluated at, such as blaze::DynamicMatrix and
+     * blaze::StaticMatrix.
+     *
+     * The type must be a copyable matrix (not an expression template), with element access through operator(),
+     * and support for matrix products, sums and scaling by an element.
+     */
+    template< typename MATRIX >
+    concept IsMatrix = std::copyable< MATRIX > && requires(MATRIX a, const MATRIX& b, std::size_t i) {
+        { b.rows() } -> std::convertible_to< std::size_t >;
+        { b.columns() } -> std::convertible_to< std::size_t >;
+        a(i, i) = b(i, i);
+        a = b * b;
+        a = b(i, i) * b;
+        a += b(i, i) * b;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Returns the block size s for the Paterson-Stockmeyer evaluation of a polynomial of order n at a matrix.
+         *
+         * Computing A^2, ..., A^s takes s - 1 products, and the Horner scheme in A^s over the n / s blocks takes
+         * one product per block, except for a top block holding only the leading coefficient. The block size
+         * minimising the total is close to sqrt(n), for about 2 sqrt(n) products. For s = 1, the scheme is
+         * Horner's method with n - 1 products.
+         *
+         * @param order The order of the polynomial.
+         * @return The block size s.
+         */
+        inline std::size_t patersonStockmeyerBlock(std::size_t order)
+        {
+            auto products = [&](std::size_t s) { return s - 1 + order / s - (order % s == 0 ? 1 : 0); };
+
+            std::size_t best = 1;
+            for (std::size_t s = 2; (s - 1) * (s - 1) <= order; ++s)
+                if (products(s) < products(best)) best = s;
+            return best;
+        }
+
+        /**
+         * @brief Evaluates a polynomial at a square matrix, using the Paterson-Stockmeyer scheme.
+         *
+         * With the block size s (see patersonStockmeyerBlock()), the polynomial is written as
+         * p(A) = sum_j B_j(A) (A^s)^j, where B_j(A) = sum_{i<s} c_{js+i} A^i. The powers A, ..., A^s are computed
+         * once; each B_j then only takes scaled matrix additions, and the sum over j is evaluated with Horner's
+         * method in A^s. The products are written to a second buffer, which is swapped with the result, so
+         * no matrices are allocated in the loop, and the products never alias their operands.
+         *
+         * @param coeffs The polynomial coefficients, in increasing order of degree. Must not be empty.
+         * @param A The matrix; must be square.
+         * @return The matrix p(A).
+         */
+        template< typename T, typename MATRIX >
+        MATRIX patersonStockmeyer(std::span< const T > coeffs, const MATRIX& A)
+        {
+            using ELEMENT_T = std::remove_cvref_t< decltype(A(0, 0)) >;
+
+            const std::size_t order = coeffs.size() - 1;
+            const std::size_t dim   = A.rows();
+            auto coeff = [&](std::size_t k) { return static_cast< ELEMENT_T >(coeffs[k]); };
+
+            MATRIX result = A;
+            if (order == 0) {
+                for (std::size_t i = 0; i < dim; ++i)
+                    for (std::size_t j = 0; j < dim; ++j) result(i, j) = i == j ? coeff(0) : ELEMENT_T {};
+                return result;
+            }
+
+            // ===== powers[k] holds A^(k + 1).
+            const std::size_t     s = patersonStockmeyerBlock(order);
+            std::vector< MATRIX > powers(s, A);
+            for (std::size_t k = 1; k < s; ++k) powers[k] = powers[k - 1] * A;
+
+            // ===== Adds B_j(A) to the result.
+            auto addBlock = [&](std::size_t block) {
+                const std::size_t first = block * s;
+                for (std::size_t i = 1; i < s && first + i <= order; ++i)
+                    if (coeffs[first + i] != T {}) result += coeff(first + i) * powers[i - 1];
+                for (std::size_t i = 0; i < dim; ++i) result(i, i) += coeff(first);
+            };
+
+            // ===== A top block holding only the leading coefficient is a scaling of A^s rather than a product.
+            std::size_t block = order / s;
+            if (order % s == 0) {
+                result = coeff(order) * powers[s - 1];
+                addBlock(--block);
+            }
+            else {
+                for (std::size_t i = 0; i < dim; ++i)
+                    for (std::size_t j = 0; j < dim; ++j) result(i, j) = ELEMENT_T {};
+                addBlock(block);
+            }
+
+            MATRIX product = A;
+            while (block-- > 0) {
+                product = result * powers[s - 1];
+                using std::swap;
+                swap(result, product);
+                addBlock(block);
+            }
+
+            return result;
+        }
+    }    // namespace detail
+
+    /**
+     * @brief Evaluates a polynomial at a square matrix, i.e. computes p(A) = c_0 I + c_1 A + ... + c_n A^n.
+     *
+     * This is the building block for matrix functions, such as the Taylor and Padé approximations of the
+     * matrix exponential. Horner's method takes n matrix products, whereas the Paterson-Stockmeyer scheme used
+     * here takes about 2 sqrt(n) (see detail::patersonStockmeyer), at the cost of storing about sqrt(n) powers
+     * of A. The matrix products dominate the cost, so for a polynomial of order 16, this is 6 products rather
+     * than 15.
+     *
+     * The function works with any matrix type modelling IsMatrix, including blaze::DynamicMatrix and
+     * blaze::StaticMatrix; nxx::poly itself does not depend on Blaze.
+     *
+     * @param poly The polynomial to evaluate. The coefficients must be convertible to the element type of the
+     * matrix.
+     * @param A The matrix at which to evaluate the polynomial. Must be square.
+     * @return The matrix p(A), of the same type as A.
+     *
+     * @throws NumerixxError if the matrix is not square.
+     */
+    template< IsPolynomial POLY, IsMatrix MATRIX >
+        requires std::convertible_to< typename POLY::value_type, std::remove_cvref_t< decltype(std::declval< const MATRIX& >()(0, 0)) > >
+    [[nodiscard]]
+    MATRIX evaluateMatrix(const POLY& poly, const MATRIX& A)
+    {
+        if (A.rows() != A.columns()) throw NumerixxError("Matrix evaluation requires a square matrix.");
+        if (A.rows() == 0) return A;
+
+        using T = typename POLY::value_type;
+        return detail::patersonStockmeyer(std::span< const T >(poly.coefficients()), A);
+    }
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYMATRIX_HPP
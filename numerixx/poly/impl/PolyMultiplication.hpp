@@ -0,0 +1,423 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYMULTIPLICATION_HPP
+#define NUMERIXX_POLYMULTIPLICATION_HPP
+
+// ===== Numerixx Includes
+#include <Concepts.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <bit>
+#include <complex>
+#include <cstddef>
+#include <numbers>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace nxx::poly::detail
+{
+    /**
+     * @brief Gets the underlying floating point type of a real or complex type.
+     */
+    template< typename T >
+    struct FundamentalType
+    {
+        using type = T;
+    };
+
+    template< typename T >
+    struct FundamentalType< std::complex< T > >
+    {
+        using type = T;
+    };
+
+    /**
+     * @brief The length of the shorter operand below which schoolbook multiplication is used.
+     *
+     * @note The schoolbook inner loop vectorises well, so the crossover is much higher than the textbook
+     * value. The thresholds were determined with benchPolynomial (BM_PolyMultiply*).
+     */
+    inline constexpr std::size_t KARATSUBA_THRESHOLD = 192;
+
+    /**
+     * @brief The length of the shorter operand from which FFT multiplication is used (for IEEE types only).
+     */
+    inline constexpr std::size_t FFT_THRESHOLD = 512;
+
+    /**
+     * @brief Multiplies two coefficient sequences using the schoolbook algorithm, adding the product to out.
+     *
+     * @param a The coefficients of the first operand.
+     * @param b The coefficients of the second operand.
+     * @param out The destination; must hold at least a.size() + b.size() - 1 elements. The product is added
+     * to the existing values.
+     */
+    template< typename TYPE >
+    inline void multiplySchoolbook(std::span< const TYPE > a, std::span< const TYPE > b, std::span< TYPE > out)
+    {
+        // ===== The inner loop runs over the longer operand, as it is contiguous in both input and output.
+        if (a.size() < b.size()) std::swap(a, b);
+        for (std::size_t j = 0; j < b.size(); ++j) {
+            const TYPE factor = b[j];
+            TYPE*      dest   = out.data() + j;
+            for (std::size_t i = 0; i < a.size(); ++i) dest[i] += a[i] * factor;
+        }
+    }
+
+    /**
+     * @brief Multiplies two coefficient sequences of equal length n using Karatsuba's algorithm.
+     *
+     * The operands are split into a low half of length m = n / 2 and a high half of length h = n - m. The
+     * three half-size products a0*b0, a1*b1 and (a0 + a1)*(b0 + b1) are computed recursively, and the middle
+     * term is recovered by subtraction. No memory is allocated; the scratch buffer must hold at least
+     * karatsubaScratchSize(n) elements.
+     *
+     * @param a The coefficients of the first operand (length n).
+     * @param b The coefficients of the second operand (length n).
+     * @param out The destination; must hold 2n - 1 elements. It is overwritten.
+     * @param scratch The scratch buffer.
+     */
+    template< typename TYPE >
+    inline void multiplyKaratsuba(const TYPE* a, const TYPE* b, std::size_t n, TYPE* out, TYPE* scratch)
+    {
+        if (n < KARATSUBA_THRESHOLD) {
+            std::fill(out, out + 2 * n - 1, TYPE {});
+            multiplySchoolbook(std::span< const TYPE >(a, n), std::span< const TYPE >(b, n), std::span< TYPE >(out, 2 * n - 1));
+            return;
+        }
+
+        const std::size_t m = n / 2;
+        const std::size_t h = n - m;
+
+        TYPE* asum = scratch;
+        TYPE* bsum = asum + h;
+        TYPE* mid  = bsum + h;
+        TYPE* rest = mid + 2 * h - 1;
+
+        // ===== Low and high products, written directly to their final positions in the output.
+        multiplyKaratsuba(a, b, m, out, rest);
+        out[2 * m - 1] = TYPE {};
+        multiplyKaratsuba(a + m, b + m, h, out + 2 * m, rest);
+
+        // ===== Middle product: (a0 + a1) * (b0 + b1) - a0 * b0 - a1 * b1.
+        for (std::size_t i = 0; i < h; ++i) {
+            asum[i] = a[m + i] + (i < m ? a[i] : TYPE {});
+            bsum[i] = b[m + i] + (i < m ? b[i] : TYPE {});
+        }
+        multiplyKaratsuba(asum, bsum, h, mid, rest);
+        for (std::size_t i = 0; i < 2 * m - 1; ++i) mid[i] -= out[i];
+        for (std::size_t i = 0; i < 2 * h - 1; ++i) mid[i] -= out[2 * m + i];
+        for (std::size_t i = 0; i < 2 * h - 1; ++i) out[m + i] += mid[i];
+    }
+
+    /**
+     * @brief Returns the size of the scratch buffer needed by multiplyKaratsuba for operands of length n.
+     */
+    constexpr std::size_t karatsubaScratchSize(std::size_t n)
+    {
+        std::size_t size = 0;
+        while (n >= KARATSUBA_THRESHOLD) {
+            const std::size_t h = n - n / 2;
+            size += 4 * h - 1;
+            n = h;
+        }
+        return size;
+    }
+
+    /**
+     * @brief Multiplies two complex numbers using the textbook formula.
+     *
+     * @note operator* for std::complex must handle infinite and NaN parts according to Annex G of the C
+     * standard, which prevents vectorisation and adds a library call per product. The FFT only handles finite
+     * values, so the textbook formula gives the same results.
+     */
+    template< typename FLOAT_T >
+    inline std::complex< FLOAT_T > mulComplex(const std::complex< FLOAT_T >& a, const std::complex< FLOAT_T >& b)
+    {
+        return { a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real() };
+    }
+
+    /**
+     * @brief Computes the discrete Fourier transform of a sequence in place, using the iterative radix-2 algorithm.
+     *
+     * @param data The sequence to transform. The size must be a power of two.
+     * @param inverse If true, the inverse transform (including the 1/n scaling) is computed.
+     */
+    template< typename FLOAT_T >
+    inline void fft(std::span< std::complex< FLOAT_T > > data, bool inverse)
+    {
+        const std::size_t n = data.size();
+        if (n < 2) return;
+
+        // ===== Bit-reversal permutation.
+        for (std::size_t i = 1, j = 0; i < n; ++i) {
+            std::size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j) std::swap(data[i], data[j]);
+        }
+
+        // ===== The twiddle factors are not computed by recurrence, as the rounding errors would accumulate.
+        // Instead, each factor w^k is the product of a coarse factor w^(k - k % B) and a fine factor w^(k % B),
+        // both computed directly. This keeps the error within a few ulps, using only n / B + B trig calls.
+        const FLOAT_T         sign  = inverse ? FLOAT_T(2) : FLOAT_T(-2);
+        constexpr std::size_t block = 64;
+        const auto            root  = [&](std::size_t k) {
+            return std::polar(FLOAT_T(1), sign * std::numbers::pi_v< FLOAT_T > * static_cast< FLOAT_T >(k) / static_cast< FLOAT_T >(n));
+        };
+
+        std::vector< std::complex< FLOAT_T > > twiddles(n / 2);
+        for (std::size_t k = 0; k < std::min(block, n / 2); ++k) twiddles[k] = root(k);
+        for (std::size_t base = block; base < n / 2; base += block) {
+            const auto coarse = root(base);
+            for (std::size_t k = 0; k < block; ++k) twiddles[base + k] = mulComplex(coarse, twiddles[k]);
+        }
+
+        // ===== The butterflies operate on the real and imaginary parts directly (std::complex guarantees the
+        // array layout), using a contiguous copy of the twiddle factors of each stage, so the loop vectorises.
+        auto*                                  values = reinterpret_cast< FLOAT_T* >(data.data());
+        std::vector< std::complex< FLOAT_T > > stage(n / 2);
+        const auto*                            w = reinterpret_cast< const FLOAT_T* >(stage.data());
+
+        for (std::size_t len = 2; len <= n; len <<= 1) {
+            const std::size_t half = len / 2;
+            const std::size_t step = n / len;
+            for (std::size_t k = 0; k < half; ++k) stage[k] = twiddles[k * step];
+
+            for (std::size_t i = 0; i < n; i += len) {
+                FLOAT_T* lo = values + 2 * i;
+                FLOAT_T* hi = lo + 2 * half;
+                for (std::size_t k = 0; k < half; ++k) {
+                    const FLOAT_T vr  = hi[2 * k] * w[2 * k] - hi[2 * k + 1] * w[2 * k + 1];
+                    const FLOAT_T vi  = hi[2 * k] * w[2 * k + 1] + hi[2 * k + 1] * w[2 * k];
+                    const FLOAT_T ur  = lo[2 * k];
+                    const FLOAT_T ui  = lo[2 * k + 1];
+                    lo[2 * k]         = ur + vr;
+                    lo[2 * k + 1]     = ui + vi;
+                    hi[2 * k]         = ur - vr;
+                    hi[2 * k + 1]     = ui - vi;
+                }
+            }
+        }
+
+        if (inverse) {
+            const FLOAT_T scale = FLOAT_T(1) / static_cast< FLOAT_T >(n);
+            for (auto& elem : data) elem *= scale;
+        }
+    }
+
+    /**
+     * @brief Multiplies two coefficient sequences using the fast Fourier transform, adding the product to out.
+     *
+     * For real operands, both sequences are packed into a single complex transform (as the real and imaginary
+     * parts), and separated again in the frequency domain, so only two transforms are needed in total.
+     *
+     * @note The absolute error of each product coefficient is of the order of the machine epsilon times the
+     * size of the largest product coefficient. Products of polynomials whose coefficients span many orders of
+     * magnitude should therefore use Karatsuba instead.
+     */
+    template< typename TYPE >
+    inline void multiplyFFT(std::span< const TYPE > a, std::span< const TYPE > b, std::span< TYPE > out)
+    {
+        using FLOAT_T   = typename FundamentalType< TYPE >::type;
+        using COMPLEX_T = std::complex< FLOAT_T >;
+
+        const std::size_t size = a.size() + b.size() - 1;
+        std::size_t       n    = 1;
+        while (n < size) n <<= 1;
+
+        std::vector< COMPLEX_T > fa(n);
+        if constexpr (IsComplex< TYPE >) {
+            std::vector< COMPLEX_T > fb(n);
+            std::copy(a.begin(), a.end(), fa.begin());
+            std::copy(b.begin(), b.end(), fb.begin());
+            fft(std::span(fa), false);
+            fft(std::span(fb), false);
+            for (std::size_t k = 0; k < n; ++k) fa[k] = mulComplex(fa[k], fb[k]);
+            fft(std::span(fa), true);
+            for (std::size_t k = 0; k < size; ++k) out[k] += fa[k];
+        }
+        else {
+            for (std::size_t k = 0; k < a.size(); ++k) fa[k].real(a[k]);
+            for (std::size_t k = 0; k < b.size(); ++k) fa[k].imag(b[k]);
+            fft(std::span(fa), false);
+
+            // ===== Unpack A = (C_k + conj(C_{n-k})) / 2 and B = (C_k - conj(C_{n-k})) / 2i, and form A * B.
+            std::vector< COMPLEX_T > prod(n);
+            for (std::size_t k = 0; k < n; ++k) {
+                const COMPLEX_T ck  = fa[k];
+                const COMPLEX_T cnk = std::conj(fa[(n - k) & (n - 1)]);
+                prod[k]             = mulComplex(mulComplex(ck + cnk, ck - cnk), COMPLEX_T(0, FLOAT_T(-0.25)));
+            }
+            fft(std::span(prod), true);
+            for (std::size_t k = 0; k < size; ++k) out[k] += prod[k].real();
+        }
+    }
+
+    /**
+     * @brief Multiplies two coefficient sequences, dispatching to the fastest algorithm for their sizes.
+     *
+     * Schoolbook multiplication is used if the shorter operand has fewer than KARATSUBA_THRESHOLD
+     * coefficients, and FFT multiplication if it has FFT_THRESHOLD or more (for float, double and
+     * long double based types only). Otherwise, Karatsuba's algorithm is used; if the operands differ in
+     * length, the longer one is cut into pieces of the length of the shorter one.
+     *
+     * @param a The coefficients of the first operand. Must not be empty.
+     * @param b The coefficients of the second operand. Must not be empty.
+     * @param out The destination; must hold a.size() + b.size() - 1 elements. It is overwritten.
+     */
+    template< typename TYPE >
+    inline void multiply(std::span< const TYPE > a, std::span< const TYPE > b, std::span< TYPE > out)
+    {
+        using FLOAT_T = typename FundamentalType< TYPE >::type;
+
+        std::fill(out.begin(), out.end(), TYPE {});
+        if (a.size() < b.size()) std::swap(a, b);
+        const std::size_t n = b.size();
+
+        if (n < KARATSUBA_THRESHOLD) {
+            multiplySchoolbook(a, b, out);
+            return;
+        }
+
+        if constexpr (std::is_floating_point_v< FLOAT_T >) {
+            if (n >= FFT_THRESHOLD) {
+                multiplyFFT(a, b, out);
+                return;
+            }
+        }
+
+        std::vector< TYPE > scratch(karatsubaScratchSize(n) + 3 * n);
+        TYPE*               piece  = scratch.data() + karatsubaScratchSize(n);
+        TYPE*               padded = piece + 2 * n - 1;
+
+        for (std::size_t pos = 0; pos < a.size(); pos += n) {
+            const std::size_t len = std::min(n, a.size() - pos);
+
+            // ===== The last piece may be shorter than b; it is zero-padded to the length of b.
+            const TYPE* chunk = a.data() + pos;
+            if (len < n) {
+                std::fill(padded, padded + n, TYPE {});
+                std::copy(chunk, chunk + len, padded);
+                chunk = padded;
+            }
+
+            multiplyKaratsuba(chunk, b.data(), n, piece, scratch.data());
+            const std::size_t count = std::min(2 * n - 1, out.size() - pos);
+            for (std::size_t i = 0; i < count; ++i) out[pos + i] += piece[i];
+        }
+    }
+
+    /**
+     * @brief Orders points so that every run of consecutive points is spread over the whole set.
+     *
+     * The points are sorted (by value, or by argument for complex points), and taken in bit-reversed
+     * order. Products of linear factors over such runs are much better conditioned than over clustered
+     * points, which matters for product trees, subproduct trees and Newton's divided differences alike.
+     *
+     * @param points The points.
+     * @return The indices of the points, in the interleaved order.
+     */
+    template< typename TYPE >
+    inline std::vector< std::size_t > interleavedOrder(std::span< const TYPE > points)
+    {
+        std::vector< std::size_t > sorted(points.size());
+        std::iota(sorted.begin(), sorted.end(), std::size_t { 0 });
+        std::ranges::stable_sort(sorted, [&](std::size_t a, std::size_t b) {
+            if constexpr (IsComplex< TYPE >)
+                return std::arg(points[a]) < std::arg(points[b]);
+            else
+                return points[a] < points[b];
+        });
+
+        std::vector< std::size_t > order;
+        order.reserve(points.size());
+        const std::size_t total = std::bit_ceil(points.size());
+        const auto        bits  = std::countr_zero(total);
+        for (std::size_t i = 0; i < total; ++i) {
+            std::size_t reversed = 0;
+            for (int bit = 0; bit < bits; ++bit) reversed |= ((i >> bit) & 1u) << (bits - 1 - bit);
+            if (reversed < points.size()) order.push_back(sorted[reversed]);
+        }
+        return order;
+    }
+
+    /**
+     * @brief The number of roots below which productOfLinearFactors() multiplies the factors in one at a time.
+     *
+     * @note The threshold was determined with benchPolynomial (BM_PolyFromRoots).
+     */
+    inline constexpr std::size_t ROOT_PRODUCT_THRESHOLD = 16;
+
+    /**
+     * @brief Computes the monic polynomial (x - r_0)(x - r_1)...(x - r_{n-1}) with the given roots.
+     *
+     * Few roots are multiplied in one at a time, in place in the destination. Otherwise, the roots are
+     * split in halves, whose products are computed recursively and combined with multiply(). Each level of
+     * this product tree costs about one multiplication of size n, so with the FFT kernel, the total cost is
+     * O(n log^2 n) rather than O(n^2). The roots are used in the given order; see interleavedOrder() for an
+     * order which keeps the partial products well conditioned.
+     *
+     * @param roots The roots of the polynomial.
+     * @param out The destination for the coefficients; must hold roots.size() + 1 elements.
+     */
+    template< typename TYPE >
+    inline void productOfLinearFactors(std::span< const TYPE > roots, std::span< TYPE > out)
+    {
+        const std::size_t n = roots.size();
+
+        if (n < ROOT_PRODUCT_THRESHOLD) {
+            std::fill(out.begin(), out.end(), TYPE {});
+            out[0] = TYPE { 1 };
+            for (std::size_t k = 0; k < n; ++k) {
+                // ===== out[0..k] holds a polynomial of degree k, which is multiplied by (x - root).
+                const TYPE root = roots[k];
+                out[k + 1]      = out[k];
+                for (std::size_t j = k; j > 0; --j) out[j] = out[j - 1] - root * out[j];
+                out[0] = -root * out[0];
+            }
+            return;
+        }
+
+        const std::size_t   half = n / 2;
+        std::vector< TYPE > low(half + 1);
+        std::vector< TYPE > high(n - half + 1);
+        productOfLinearFactors(roots.first(half), std::span< TYPE >(low));
+        productOfLinearFactors(roots.subspan(half), std::span< TYPE >(high));
+        multiply(std::span< const TYPE >(low), std::span< const TYPE >(high), out);
+    }
+
+}    // namespace nxx::poly::detail
+
+#endif    // NUMERIXX_POLYMULTIPLICATION_HPP
@@ -0,0 +1,538 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYORTHOGONAL_HPP
+#define NUMERIXX_POLYORTHOGONAL_HPP
+
+// ===== Numerixx Includes
+#include <Error.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nxx::poly
+{
+    /**
+     * @brief The Legendre polynomials P_k, orthogonal on [-1, 1] with weight 1.
+     *
+     * An orthogonal family describes its polynomials by the three-term recurrence
+     * p_(k+1)(x) = (A_k x + B_k) p_k(x) - C_k p_(k-1)(x), with p_0 = 1 and p_(-1) = 0, and by the
+     * integral of its weight function, which is needed for Gauss quadrature.
+     *
+     * @tparam T The floating point type of the coefficients.
+     */
+    template< std::floating_point T = double >
+    struct LegendreFamily
+    {
+        using value_type = T;
+
+        static constexpr bool IsOrthogonalFamily = true;
+
+        /**
+         * @brief Returns the recurrence coefficients {A_k, B_k, C_k} for the step from p_k to p_(k+1).
+         */
+        std::array< T, 3 > recurrence(std::size_t k) const
+        {
+            const auto n = static_cast< T >(k);
+            return { (2 * n + 1) / (n + 1), T(0), n / (n + 1) };
+        }
+
+        /**
+         * @brief Returns the integral of the weight function over the interval of orthogonality.
+         */
+        T weightIntegral() const { return 2; }
+    };
+
+    /**
+     * @brief The Chebyshev polynomials of the first kind T_k, orthogonal on [-1, 1] with weight 1 / sqrt(1 - x^2).
+     *
+     * @tparam T The floating point type of the coefficients.
+     */
+    template< std::floating_point T = double >
+    struct ChebyshevFamily
+    {
+        using value_type = T;
+
+        static constexpr bool IsOrthogonalFamily = true;
+
+        std::array< T, 3 > recurrence(std::size_t k) const { return { k == 0 ? T(1) : T(2), T(0), T(1) }; }
+
+        T weightIntegral() const { return std::numbers::pi_v< T >; }
+    };
+
+    /**
+     * @brief The (physicists') Hermite polynomials H_k, orthogonal on the real line with weight exp(-x^2).
+     *
+     * @tparam T The floating point type of the coefficients.
+     */
+    template< std::floating_point T = double >
+    struct HermiteFamily
+    {
+        using value_type = T;
+
+        static constexpr bool IsOrthogonalFamily = true;
+
+        std::array< T, 3 > recurrence(std::size_t k) const { return { T(2), T(0), 2 * static_cast< T >(k) }; }
+
+        T weightIntegral() const { return std::sqrt(std::numbers::pi_v< T >); }
+    };
+
+    /**
+     * @brief The generalized Laguerre polynomials L_k^(alpha), orthogonal on [0, inf) with weight x^alpha exp(-x).
+     *
+     * @tparam T The floating point type of the coefficients.
+     */
+    template< std::floating_point T = double >
+    struct LaguerreFamily
+    {
+        using value_type = T;
+
+        static constexpr bool IsOrthogonalFamily = true;
+
+        T alpha { 0 }; /**< The exponent of the weight function; must be greater than -1. */
+
+        LaguerreFamily() = default;
+
+        /**
+         * @brief Constructs the family for the weight x^alpha exp(-x).
+         *
+         * @throws NumerixxError if alpha is not greater than -1.
+         */
+        explicit LaguerreFamily(T exponent)
+            : alpha(exponent)
+        {
+            if (!(alpha > -1)) throw NumerixxError("The Laguerre parameter must be greater than -1.");
+        }
+
+        std::array< T, 3 > recurrence(std::size_t k) const
+        {
+            const auto n = static_cast< T >(k);
+            return { -1 / (n + 1), (2 * n + 1 + alpha) / (n + 1), (n + alpha) / (n + 1) };
+        }
+
+        T weightIntegral() const { return std::tgamma(alpha + 1); }
+    };
+
+    /**
+     * @brief The Jacobi polynomials P_k^(alpha, beta), orthogonal on [-1, 1] with weight (1 - x)^alpha (1 + x)^beta.
+     *
+     * The Legendre polynomials are the case alpha = beta = 0, and the Chebyshev polynomials are, up to
+     * normalization, the case alpha = beta = -1/2.
+     *
+     * @tparam T The floating point type of the coefficients.
+     */
+    template< std::floating_point T = double >
+    struct JacobiFamily
+    {
+        using value_type = T;
+
+        static constexpr bool IsOrthogonalFamily = true;
+
+        T alpha { 0 }; /**< The exponent of (1 - x) in the weight function; must be greater than -1. */
+        T beta { 0 };  /**< The exponent of (1 + x) in the weight function; must be greater than -1. */
+
+        JacobiFamily() = default;
+
+        /**
+         * @brief Constructs the family for the weight (1 - x)^alpha (1 + x)^beta.
+         *
+         * @throws NumerixxError if alpha or beta is not greater than -1.
+         */
+        JacobiFamily(T exponentA, T exponentB)
+            : alpha(exponentA),
+              beta(exponentB)
+        {
+            if (!(alpha > -1) || !(beta > -1)) throw NumerixxError("The Jacobi parameters must be greater than -1.");
+        }
+
+        std::array< T, 3 > recurrence(std::size_t k) const
+        {
+            if (k == 0) return { (alpha + beta + 2) / 2, (alpha - beta) / 2, T(0) };
+
+            const auto n     = static_cast< T >(k);
+            const T    s     = 2 * n + alpha + beta;
+            const T    denom = 2 * (n + 1) * (n + alpha + beta + 1) * s;
+            return { (s + 1) * (s + 2) * s / denom,
+                     (alpha * alpha - beta * beta) * (s + 1) / denom,
+                     2 * (n + alpha) * (n + beta) * (s + 2) / denom };
+        }
+
+        T weightIntegral() const
+        {
+            return std::exp((alpha + beta + 1) * std::numbers::ln2_v< T > + std::lgamma(alpha + 1) + std::lgamma(beta + 1) -
+                            std::lgamma(alpha + beta + 2));
+        }
+    };
+
+    /**
+     * @brief Concept checking whether a type is a family of orthogonal polynomials.
+     */
+    template< typename FAMILY >
+    concept IsOrthogonalFamily = FAMILY::IsOrthogonalFamily;
+
+    /**
+     * @brief A Gauss quadrature rule, integrating polynomials of order up to 2n - 1 exactly against the weight
+     * function of a family of orthogonal polynomials with n nodes.
+     */
+    template< std::floating_point T >
+    struct GaussRule
+    {
+        std::vector< T > nodes;   /**< The nodes, in increasing order. */
+        std::vector< T > weights; /**< The weights, one per node. */
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief The number of points per block in orthogonalRecurrence().
+         *
+         * @note The three rows of the recurrence for a block stay in the L1 cache while the degree is
+         * advanced. The value was determined with benchPolynomial (BM_OrthogonalTable).
+         */
+        inline constexpr std::size_t ORTHOGONAL_BLOCK = 256;
+
+        /**
+         * @brief Fills the tables of the values and the first K derivatives of p_0, ..., p_degree at a set of points.
+         *
+         * The derivatives follow from differentiating the recurrence d times:
+         * p_(k+1)^(d) = (A_k x + B_k) p_k^(d) + d A_k p_k^(d-1) - C_k p_(k-1)^(d). Each row is computed from the
+         * two previous rows of the same block of points, as one vectorised loop over the points.
+         *
+         * @param family The family of orthogonal polynomials.
+         * @param degree The highest degree.
+         * @param x The points.
+         * @param out The destinations for the values and the derivatives; the entry for p_k at x[m] is at
+         * k * x.size() + m, and each must hold (degree + 1) * x.size() elements.
+         */
+        template< std::size_t K, typename FAMILY, typename T >
+        void orthogonalRecurrence(const FAMILY& family, std::size_t degree, std::span< const T > x, const std::array< std::span< T >, K + 1 >& out)
+        {
+            const std::size_t size = x.size();
+
+            for (std::size_t first = 0; first < size; first += ORTHOGONAL_BLOCK) {
+                const std::size_t last = std::min(size, first + ORTHOGONAL_BLOCK);
+                for (std::size_t d = 0; d <= K; ++d)
+                    std::fill(out[d].begin() + static_cast< std::ptrdiff_t >(first),
+                              out[d].begin() + static_cast< std::ptrdiff_t >(last),
+                              d == 0 ? T(1) : T(0));
+
+                for (std::size_t k = 0; k < degree; ++k) {
+                    const auto [a, b, c] = family.recurrence(k);
+                    for (std::size_t d = 0; d <= K; ++d) {
+                        // ===== The terms that do not exist for k == 0 or d == 0 are multiplied by zero instead.
+                        T* const       next  = out[d].data() + (k + 1) * size;
+                        const T* const curr  = out[d].data() + k * size;
+                        const T* const prev  = k > 0 ? curr - size : curr;
+                        const T* const lower = d > 0 ? out[d - 1].data() + k * size : curr;
+                        const T        cc    = k > 0 ? c : T(0);
+                        const T        da    = a * static_cast< T >(d);
+#pragma omp simd
+                        for (std::size_t m = first; m < last; ++m) next[m] = (a * x[m] + b) * curr[m] + da * lower[m] - cc * prev[m];
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Computes the eigenvalues of a symmetric tridiagonal matrix, using the implicit QL method with
+         * Wilkinson shifts.
+         *
+         * @param diag The diagonal; replaced by the eigenvalues, in no particular order.
+         * @param offdiag The off-diagonal, with offdiag[i] coupling rows i and i + 1; must hold as many elements as
+         * diag (the last is ignored). Destroyed on exit.
+         *
+         * @throws NumerixxError if an eigenvalue does not converge within 60 iterations.
+         */
+        template< std::floating_point T >
+        void tridiagonalEigenvalues(std::vector< T >& diag, std::vector< T >& offdiag)
+        {
+            const auto n = static_cast< std::ptrdiff_t >(diag.size());
+            if (n == 0) return;
+            offdiag[static_cast< std::size_t >(n - 1)] = 0;
+
+            auto d = [&](std::ptrdiff_t i) -> T& { return diag[static_cast< std::size_t >(i)]; };
+            auto e = [&](std::ptrdiff_t i) -> T& { return offdiag[static_cast< std::size_t >(i)]; };
+
+            for (std::ptrdiff_t l = 0; l < n; ++l) {
+                for (int iter = 0;; ++iter) {
+                    std::ptrdiff_t m = l;
+                    for (; m < n - 1; ++m)
+                        if (std::abs(e(m)) <= std::numeric_limits< T >::epsilon() * (std::abs(d(m)) + std::abs(d(m + 1)))) break;
+                    if (m == l) break;
+                    if (iter == 60) throw NumerixxError("Tridiagonal eigenvalues did not converge.");
+
+                    // ===== The entries of the Jacobi matrices are moderate, so the sums of squares cannot
+                    // overflow; std::hypot is several times slower.
+                    T g = (d(l + 1) - d(l)) / (2 * e(l));
+                    T r = std::sqrt(g * g + 1);
+                    g   = d(m) - d(l) + e(l) / (g + std::copysign(r, g));
+
+                    T              s = 1;
+                    T              c = 1;
+                    T              p = 0;
+                    std::ptrdiff_t i = m - 1;
+                    for (; i >= l; --i) {
+                        const T f = s * e(i);
+                        const T b = c * e(i);
+                        r         = std::sqrt(f * f + g * g);
+                        e(i + 1)  = r;
+                        if (r == 0) {
+                            d(i + 1) -= p;
+                            e(m) = 0;
+                            break;
+                        }
+                        s        = f / r;
+                        c        = g / r;
+                        g        = d(i + 1) - p;
+                        r        = (d(i) - g) * s + 2 * c * b;
+                        p        = s * r;
+                        d(i + 1) = g + p;
+                        g        = c * r - b;
+                    }
+                    if (r == 0 && i >= l) continue;
+                    d(l) -= p;
+                    e(l) = g;
+                    e(m) = 0;
+                }
+            }
+        }
+
+        /**
+         * @brief Evaluates the orthonormal polynomial of degree n, its derivative, and the sum of squares of the
+         * orthonormal polynomials of lower degree at a set of points.
+         *
+         * The orthonormal polynomials follow from x q_k = s_(k+1) q_(k+1) + a_k q_k + s_k q_(k-1), with the
+         * diagonal a_k and the off-diagonal s_k of the Jacobi matrix, and q_0 = 1 / sqrt(mu_0).
+         *
+         * @param diag The diagonal of the Jacobi matrix, a_0, ..., a_(n-1).
+         * @param offdiag The off-diagonal, s_1, ..., s_n.
+         * @param q0 The constant orthonormal polynomial.
+         * @param x The points.
+         * @param q The destination for q_n(x).
+         * @param dq The destination for q_n'(x).
+         * @param sum The destination for sum_(k < n) q_k(x)^2.
+         */
+        template< std::floating_point T >
+        void orthonormalSweep(std::span< const T > diag,
+                              std::span< const T > offdiag,
+                              T                    q0,
+                              std::span< const T > x,
+                              std::vector< T >&    q,
+                              std::vector< T >&    dq,
+                              std::vector< T >&    sum)
+        {
+            const std::size_t size = x.size();
+            std::vector< T >  qPrev(size, T(0));
+            std::vector< T >  dqPrev(size, T(0));
+            std::fill(q.begin(), q.end(), q0);
+            std::fill(dq.begin(), dq.end(), T(0));
+            std::fill(sum.begin(), sum.end(), T(0));
+
+            for (std::size_t k = 0; k < diag.size(); ++k) {
+                const T a    = diag[k];
+                const T prev = k > 0 ? offdiag[k - 1] : T(0);
+                const T inv  = 1 / offdiag[k];
+#pragma omp simd
+                for (std::size_t i = 0; i < size; ++i) {
+                    sum[i] += q[i] * q[i];
+                    const T qNext  = ((x[i] - a) * q[i] - prev * qPrev[i]) * inv;
+                    const T dqNext = ((x[i] - a) * dq[i] + q[i] - prev * dqPrev[i]) * inv;
+                    qPrev[i]       = q[i];
+                    q[i]           = qNext;
+                    dqPrev[i]      = dq[i];
+                    dq[i]          = dqNext;
+                }
+            }
+        }
+    }    // namespace detail
+
+    /**
+     * @brief Evaluates the polynomials p_0, ..., p_degree of an orthogonal family and their first K derivatives at
+     * a set of points.
+     *
+     * The polynomials are generated by their three-term recurrence, which is both much faster and much more stable
+     * than evaluating each of them from its monomial coefficients. All degrees are produced in one pass, with the
+     * loop over the points vectorised.
+     *
+     * @tparam K The number of derivatives to compute.
+     * @param family The family of orthogonal polynomials, e.g. LegendreFamily.
+     * @param degree The highest degree.
+     * @param x The points.
+     * @param out The destinations for the values and the derivatives, in increasing order of the derivative. Each
+     * is an (degree + 1) x x.size() table stored by rows: the entry for p_k at x[m] is at k * x.size() + m.
+     *
+     * @throws NumerixxError if the size of any of the output ranges is not (degree + 1) * x.size().
+     */
+    template< std::size_t K, IsOrthogonalFamily FAMILY, typename T = typename FAMILY::value_type >
+    void evaluateOrthogonalWithDerivatives(const FAMILY&                                family,
+                                           std::size_t                                  degree,
+                                           std::type_identity_t< std::span< const T > > x,
+                                           const std::array< std::span< T >, K + 1 >&   out)
+    {
+        if (std::ranges::any_of(out, [&](const auto& range) { return range.size() != (degree + 1) * x.size(); }))
+            throw NumerixxError("The output ranges must have (degree + 1) * x.size() elements.");
+
+        detail::orthogonalRecurrence< K >(family, degree, x, out);
+    }
+
+    /**
+     * @brief Evaluates the polynomials p_0, ..., p_degree of an orthogonal family and their first K derivatives at
+     * a set of points.
+     *
+     * @tparam K The number of derivatives to compute.
+     * @param family The family of orthogonal polynomials.
+     * @param degree The highest degree.
+     * @param x The points.
+     * @return An array holding the tables of the values, the first derivatives, ..., the K'th derivatives, with
+     * the entry for p_k at x[m] at k * x.size() + m.
+     */
+    template< std::size_t K, IsOrthogonalFamily FAMILY, typename T = typename FAMILY::value_type >
+    std::array< std::vector< T >, K + 1 > evaluateOrthogonalWithDerivatives(const FAMILY& family, std::size_t degree, std::type_identity_t< std::span< const T > > x)
+    {
+        std::array< std::vector< T >, K + 1 > result;
+        std::array< std::span< T >, K + 1 >   spans;
+        for (std::size_t j = 0; j <= K; ++j) {
+            result[j].resize((degree + 1) * x.size());
+            spans[j] = std::span< T >(result[j]);
+        }
+        detail::orthogonalRecurrence< K >(family, degree, x, spans);
+        return result;
+    }
+
+    /**
+     * @brief Evaluates the polynomials p_0, ..., p_degree of an orthogonal family at a set of points.
+     *
+     * @param family The family of orthogonal polynomials.
+     * @param degree The highest degree.
+     * @param x The points.
+     * @param out The destination for the (degree + 1) x x.size() table of values, stored by rows.
+     *
+     * @throws NumerixxError if the size of `out` is not (degree + 1) * x.size().
+     */
+    template< IsOrthogonalFamily FAMILY, typename T = typename FAMILY::value_type >
+    void evaluateOrthogonal(const FAMILY& family, std::size_t degree, std::type_identity_t< std::span< const T > > x, std::type_identity_t< std::span< T > > out)
+    {
+        evaluateOrthogonalWithDerivatives< 0 >(family, degree, x, { out });
+    }
+
+    /**
+     * @brief Evaluates the polynomials p_0, ..., p_degree of an orthogonal family at a set of points.
+     *
+     * @param family The family of orthogonal polynomials.
+     * @param degree The highest degree.
+     * @param x The points.
+     * @return The (degree + 1) x x.size() table of values, with the entry for p_k at x[m] at k * x.size() + m.
+     */
+    template< IsOrthogonalFamily FAMILY, typename T = typename FAMILY::value_type >
+    std::vector< T > evaluateOrthogonal(const FAMILY& family, std::size_t degree, std::type_identity_t< std::span< const T > > x)
+    {
+        return std::move(evaluateOrthogonalWithDerivatives< 0 >(family, degree, x)[0]);
+    }
+
+    /**
+     * @brief Computes the n-point Gauss quadrature rule for the weight function of an orthogonal family.
+     *
+     * The nodes are the eigenvalues of the symmetric tridiagonal Jacobi matrix of the orthonormal recurrence
+     * (Golub-Welsch), computed with the implicit QL method in O(n^2), and then polished with Newton's method on
+     * the orthonormal polynomial of degree n, which restores full relative accuracy to the nodes close to zero.
+     * The weights are computed from the Christoffel numbers, w_i = 1 / sum_(k < n) q_k(x_i)^2, rather than
+     * from the eigenvectors.
+     *
+     * @note For the Hermite and Laguerre weights, the orthonormal polynomials grow like the inverse square root of
+     * the weight function, so for several hundred nodes the outermost weights underflow to zero, and the outermost
+     * nodes, where the polynomials overflow, keep the accuracy of the eigenvalues.
+     *
+     * @param family The family of orthogonal polynomials.
+     * @param n The number of nodes.
+     * @return The nodes, in increasing order, and the weights.
+     *
+     * @throws NumerixxError if n is zero.
+     */
+    template< IsOrthogonalFamily FAMILY, typename T = typename FAMILY::value_type >
+    GaussRule< T > gaussRule(const FAMILY& family, std::size_t n)
+    {
+        if (n == 0) throw NumerixxError("A Gauss rule needs at least one node.");
+
+        // ===== The monic recurrence p_(k+1) = (x - a_k) p_k - b_k p_(k-1), with the off-diagonal sqrt(b_k).
+        std::vector< T > diag(n);
+        std::vector< T > offdiag(n);    // offdiag[k] = sqrt(b_(k+1)).
+        T                previous = 1;
+        for (std::size_t k = 0; k <= n; ++k) {
+            const auto [a, b, c] = family.recurrence(k);
+            if (k < n) diag[k] = -b / a;
+            if (k > 0) offdiag[k - 1] = std::sqrt(c / (a * previous));
+            previous = a;
+        }
+
+        GaussRule< T > rule;
+        rule.nodes = diag;
+        std::vector< T > work = offdiag;
+        detail::tridiagonalEigenvalues(rule.nodes, work);
+        std::ranges::sort(rule.nodes);
+
+        // ===== Two Newton steps on q_n, from the accuracy of the eigenvalues, and the Christoffel numbers at the
+        // polished nodes. The nodes are processed together, so that the sweeps vectorise. Where the orthonormal
+        // polynomials overflow, the step is skipped, and the weight, which is below the reciprocal of the
+        // largest floating point number there, is set to zero.
+        const T          q0 = 1 / std::sqrt(family.weightIntegral());
+        std::vector< T > q(n), dq(n), sum(n);
+        const auto       sweep = [&] {
+            detail::orthonormalSweep(std::span< const T >(diag), std::span< const T >(offdiag), q0, std::span< const T >(rule.nodes), q, dq, sum);
+        };
+        for (int step = 0; step < 2; ++step) {
+            sweep();
+#pragma omp simd
+            for (std::size_t i = 0; i < n; ++i) {
+                const T newton = q[i] / dq[i];
+                rule.nodes[i] -= std::isfinite(newton) ? newton : T(0);
+            }
+        }
+        sweep();
+
+        rule.weights.resize(n);
+        for (std::size_t i = 0; i < n; ++i) rule.weights[i] = std::isfinite(sum[i]) ? 1 / sum[i] : T(0);
+
+        return rule;
+    }
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYORTHOGONAL_HPP
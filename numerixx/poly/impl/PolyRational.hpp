@@ -0,0 +1,781 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYRATIONAL_HPP
+#define NUMERIXX_POLYRATIONAL_HPP
+
+// ===== Numerixx Includes
+#include "PolyEvaluation.hpp"
+#include "PolyMultiplication.hpp"
+#include "Polynomial.hpp"
+#include "Polyroots.hpp"
+#include <Concepts.hpp>
+#include <Error.hpp>
+
+// ===== External Includes
+#include <tl/expected.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief The number of grid points per reference point on which minimaxRational() locates the extrema of
+         * the error.
+         *
+         * @note The extrema are refined by parabolic interpolation, so the grid only has to separate them; the
+         * error of the located maxima is then of the order of the squared grid spacing.
+         */
+        inline constexpr std::size_t REMEZ_GRID_FACTOR = 64;
+
+        /**
+         * @brief The number of times minimaxRational() halves an exchange of the reference that breaks down.
+         *
+         * @note A breakdown, i.e. a zero of the denominator or too few alternations of the error, comes from a
+         * reference too far from the converged one, so halving the step towards the last good reference a few
+         * times recovers from it; more halvings rarely helped in the tests.
+         */
+        inline constexpr int REMEZ_DAMPING_STEPS = 8;
+
+        /**
+         * @brief Evaluates a rational function, with the numerator and denominator in one interleaved Horner pass.
+         *
+         * The coefficients are stored interleaved, n_0, d_0, n_1, d_1, ..., with both polynomials padded to the
+         * same length L, so that the two accumulations are independent chains over one contiguous array. For
+         * |x| > 1, both polynomials are instead evaluated in z = 1 / x with the coefficients in reverse order;
+         * the common factor x^(L-1) cancels in the ratio, and this avoids overflow and keeps the leading terms
+         * from dominating the rounding errors for large arguments.
+         *
+         * @param coeffs The interleaved coefficients. Must not be empty.
+         * @param x The point at which to evaluate the function.
+         * @return The value of the rational function at x.
+         */
+        template< typename TYPE, typename T >
+        inline TYPE rationalEval(std::span< const T > coeffs, TYPE x)
+        {
+            const std::size_t length = coeffs.size() / 2;
+            TYPE              num    = 0;
+            TYPE              den    = 0;
+
+            using std::abs;
+            if (abs(x) <= 1) {
+                for (std::size_t k = length; k-- > 0;) {
+                    num = fmadd(num, x, static_cast< TYPE >(coeffs[2 * k]));
+                    den = fmadd(den, x, static_cast< TYPE >(coeffs[2 * k + 1]));
+                }
+            }
+            else {
+                const TYPE z = TYPE(1) / x;
+                for (std::size_t k = 0; k < length; ++k) {
+                    num = fmadd(num, z, static_cast< TYPE >(coeffs[2 * k]));
+                    den = fmadd(den, z, static_cast< TYPE >(coeffs[2 * k + 1]));
+                }
+            }
+
+            return num / den;
+        }
+
+        /**
+         * @brief Evaluates a rational function at one block of POLY_BATCH_LANES points, all inside or all outside
+         * the unit disc.
+         *
+         * The same operations as rationalEval(), starting from the first coefficients of the pass. The direction
+         * of the pass is a template parameter, as a run-time coefficient index keeps the accumulators from being
+         * held in registers.
+         *
+         * @tparam INSIDE true if all points satisfy |x| <= 1, false if none do.
+         * @param coeffs The interleaved coefficients. Must not be empty.
+         * @param x The first of the POLY_BATCH_LANES points.
+         * @param out The destination of the POLY_BATCH_LANES results.
+         */
+        template< bool INSIDE, typename T >
+        inline void rationalBlock(std::span< const T > coeffs, const T* x, T* out)
+        {
+            const std::size_t length = coeffs.size() / 2;
+            const std::size_t first  = INSIDE ? length - 1 : 0;
+
+            T num[POLY_BATCH_LANES];
+            T den[POLY_BATCH_LANES];
+            T arg[POLY_BATCH_LANES];
+            for (std::size_t l = 0; l < POLY_BATCH_LANES; ++l) {
+                num[l] = fmadd(T {}, T {}, coeffs[2 * first]);
+                den[l] = fmadd(T {}, T {}, coeffs[2 * first + 1]);
+                arg[l] = INSIDE ? x[l] : T(1) / x[l];
+            }
+
+            for (std::size_t j = 1; j < length; ++j) {
+                const std::size_t k  = INSIDE ? length - 1 - j : j;
+                const T           nk = coeffs[2 * k];
+                const T           dk = coeffs[2 * k + 1];
+#pragma omp simd
+                for (std::size_t l = 0; l < POLY_BATCH_LANES; ++l) {
+                    num[l] = fmadd(num[l], arg[l], nk);
+                    den[l] = fmadd(den[l], arg[l], dk);
+                }
+            }
+
+            for (std::size_t l = 0; l < POLY_BATCH_LANES; ++l) out[l] = num[l] / den[l];
+        }
+
+        /**
+         * @brief Evaluates a rational function at a range of points, across several lanes at once.
+         *
+         * Like hornerBatch(), the points are processed in blocks of POLY_BATCH_LANES, with the loop over the lanes
+         * innermost, and with two accumulators per lane; the two chains per lane need the simd pragma to be
+         * vectorised, which the automatic vectorisation does not do. A block is evaluated in x if all of its
+         * points satisfy |x| <= 1, and in 1 / x if none do (see rationalEval()); mixed blocks, and the remaining
+         * points, are evaluated one at a time, so the results are identical to those of rationalEval().
+         *
+         * @param coeffs The interleaved coefficients. Must not be empty.
+         * @param x The points at which to evaluate the function.
+         * @param out The destination of the results. Must have the same size as x.
+         */
+        template< typename T >
+        inline void rationalBatch(std::span< const T > coeffs, std::span< const T > x, std::span< T > out)
+        {
+            std::size_t i = 0;
+            for (; i + POLY_BATCH_LANES <= x.size(); i += POLY_BATCH_LANES) {
+                using std::abs;
+                bool inside  = true;
+                bool outside = true;
+                for (std::size_t l = 0; l < POLY_BATCH_LANES; ++l) {
+                    const bool in = abs(x[i + l]) <= 1;
+                    inside &= in;
+                    outside &= !in;
+                }
+
+                if (inside)
+                    rationalBlock< true >(coeffs, x.data() + i, out.data() + i);
+                else if (outside)
+                    rationalBlock< false >(coeffs, x.data() + i, out.data() + i);
+                else
+                    for (std::size_t l = 0; l < POLY_BATCH_LANES; ++l) out[i + l] = rationalEval(coeffs, x[i + l]);
+            }
+
+            for (; i < x.size(); ++i) out[i] = rationalEval(coeffs, x[i]);
+        }
+
+        /**
+         * @brief Solves a dense linear system by Gaussian elimination with partial pivoting.
+         *
+         * @param matrix The matrix, of size n x n, stored by rows. Destroyed on exit.
+         * @param rhs The right hand side, of size n; replaced by the solution.
+         * @return false if the matrix is singular to working precision, true otherwise.
+         */
+        template< typename T >
+        bool solveLinearSystem(std::vector< T >& matrix, std::vector< T >& rhs)
+        {
+            using FLOAT_T = typename FundamentalType< T >::type;
+            using std::abs;
+
+            const std::size_t n = rhs.size();
+            FLOAT_T           scale {};
+            for (const auto& entry : matrix) scale = std::max(scale, static_cast< FLOAT_T >(abs(entry)));
+
+            for (std::size_t col = 0; col < n; ++col) {
+                std::size_t pivot = col;
+                for (std::size_t row = col + 1; row < n; ++row)
+                    if (abs(matrix[row * n + col]) > abs(matrix[pivot * n + col])) pivot = row;
+                if (!(abs(matrix[pivot * n + col]) > std::numeric_limits< FLOAT_T >::epsilon() * scale)) return false;
+
+                if (pivot != col) {
+                    std::swap_ranges(matrix.begin() + static_cast< std::ptrdiff_t >(col * n),
+                                     matrix.begin() + static_cast< std::ptrdiff_t >((col + 1) * n),
+                                     matrix.begin() + static_cast< std::ptrdiff_t >(pivot * n));
+                    std::swap(rhs[col], rhs[pivot]);
+                }
+
+                for (std::size_t row = col + 1; row < n; ++row) {
+                    const T factor = matrix[row * n + col] / matrix[col * n + col];
+                    for (std::size_t k = col; k < n; ++k) matrix[row * n + k] -= factor * matrix[col * n + k];
+                    rhs[row] -= factor * rhs[col];
+                }
+            }
+
+            for (std::size_t col = n; col-- > 0;) {
+                T sum = rhs[col];
+                for (std::size_t k = col + 1; k < n; ++k) sum -= matrix[col * n + k] * rhs[k];
+                rhs[col] = sum / matrix[col * n + col];
+            }
+            return true;
+        }
+
+        /**
+         * @brief Computes the coefficients of p(a x + b) from those of p(t).
+         *
+         * @param coeffs The coefficients of p, in increasing order of degree. Must not be empty.
+         * @param a The scale of the argument.
+         * @param b The shift of the argument.
+         * @return The coefficients of p(a x + b), in increasing order of degree.
+         */
+        template< typename T >
+        std::vector< T > composeAffine(std::span< const T > coeffs, T a, T b)
+        {
+            std::vector< T > result { coeffs.back() };
+            for (std::size_t k = coeffs.size() - 1; k-- > 0;) {
+                result.push_back(T {});
+                for (std::size_t i = result.size() - 1; i > 0; --i) result[i] = a * result[i - 1] + b * result[i];
+                result[0] = b * result[0] + coeffs[k];
+            }
+            return result;
+        }
+
+        /**
+         * @brief Runs the rational Remez iteration for the [m/n] minimax approximation of a function on [-1, 1].
+         *
+         * Each iteration levels the error on the reference, and then exchanges the reference for the alternating
+         * extrema of the error (see minimaxRational()). If the levelled denominator has a zero on the interval,
+         * or the error has too few alternations, the exchange is damped instead: the reference is moved halfway
+         * back towards the last reference that levelled without breaking down, up to REMEZ_DAMPING_STEPS times
+         * in a row. An error that is below its rounding errors, those of f and of p and q in the monomial basis,
+         * cannot be levelled and is accepted as it is, with the reference left unchanged.
+         *
+         * @param value The function, on [-1, 1].
+         * @param m The order of the numerator.
+         * @param n The order of the denominator.
+         * @param reference The initial reference of m + n + 2 increasing points; on return, the last reference.
+         * @param tolerance The relative tolerance on the levelling of the error.
+         * @param max_iterations The maximum number of iterations.
+         * @param p The destination for the m + 1 coefficients of the numerator.
+         * @param q The destination for the n + 1 coefficients of the denominator, with q(0) = 1.
+         * @return Nothing, or an error if the iteration breaks down or does not converge.
+         */
+        template< typename T, typename FUNCTION >
+        tl::expected< void, NumerixxError > remez(const FUNCTION&   value,
+                                                  std::size_t       m,
+                                                  std::size_t       n,
+                                                  std::vector< T >& reference,
+                                                  T                 tolerance,
+                                                  int               max_iterations,
+                                                  std::vector< T >& p,
+                                                  std::vector< T >& q)
+        {
+            const std::size_t size  = m + n + 2;
+            auto              error = [&](T t) { return value(t) - hornerEval(std::span< const T >(p), t) / hornerEval(std::span< const T >(q), t); };
+
+            // ===== The last reference that levelled without breaking down, and the number of damped steps since.
+            std::vector< T > accepted;
+            int              damping = 0;
+            const auto       damp    = [&] {
+                if (accepted.empty() || damping == REMEZ_DAMPING_STEPS) return false;
+                for (std::size_t i = 0; i < size; ++i) reference[i] = (accepted[i] + reference[i]) / 2;
+                ++damping;
+                return true;
+            };
+
+            T level = 0;
+            for (int iter = 0; iter < max_iterations; ++iter) {
+                // ===== Level the error on the reference: p(t_i) - (f_i - s_i E) q(t_i) = 0, linear for a fixed E in
+                //       the q(t_i) factor, and solved for that E by secant steps from the level of the last reference.
+                std::vector< T > values(size);
+                for (std::size_t i = 0; i < size; ++i) values[i] = value(reference[i]);
+
+                T    previous = 0;
+                T    residual = 0;
+                bool singular = false;
+                for (int inner = 0; inner < 50; ++inner) {
+                    std::vector< T > matrix(size * size);
+                    std::vector< T > rhs(values);
+                    for (std::size_t i = 0; i < size; ++i) {
+                        const T sign  = i % 2 == 0 ? T(1) : T(-1);
+                        T       power = 1;
+                        for (std::size_t k = 0; k <= std::max(m, n); ++k) {
+                            if (k <= m) matrix[i * size + k] = power;
+                            if (k >= 1 && k <= n) matrix[i * size + m + k] = -(values[i] - sign * level) * power;
+                            power *= reference[i];
+                        }
+                        matrix[i * size + size - 1] = sign;
+                    }
+                    if (!solveLinearSystem(matrix, rhs)) {
+                        singular = true;
+                        break;
+                    }
+
+                    std::copy(rhs.begin(), rhs.begin() + static_cast< std::ptrdiff_t >(m + 1), p.begin());
+                    q[0] = 1;
+                    std::copy(rhs.begin() + static_cast< std::ptrdiff_t >(m + 1), rhs.end() - 1, q.begin() + 1);
+
+                    const T next = rhs.back() - level;
+                    if (std::abs(next) <= std::numeric_limits< T >::epsilon() * 16 * std::abs(rhs.back())) {
+                        level = rhs.back();
+                        break;
+                    }
+                    const T step = inner == 0 || next == residual ? next : next * (level - previous) / (residual - next);
+                    previous     = std::exchange(level, level + step);
+                    residual     = next;
+                }
+                if (singular) {
+                    if (damp()) continue;
+                    return tl::unexpected(NumerixxError("The Remez iteration failed; the reference system is singular."));
+                }
+
+                // ===== Sample the error, and check that the denominator has no zero on the interval. The magnitude
+                //       bounds the rounding errors of f - p / q, with p and q evaluated in the monomial basis.
+                const std::size_t points = REMEZ_GRID_FACTOR * size;
+                std::vector< T >  grid(points + 1);
+                std::vector< T >  err(points + 1);
+                std::vector< T >  pa(m + 1);
+                std::vector< T >  qa(n + 1);
+                std::transform(p.begin(), p.end(), pa.begin(), [](T c) { return std::abs(c); });
+                std::transform(q.begin(), q.end(), qa.begin(), [](T c) { return std::abs(c); });
+                T    magnitude = 0;
+                bool pole      = false;
+                for (std::size_t j = 0; j <= points && !pole; ++j) {
+                    grid[j]             = -std::cos(std::numbers::pi_v< T > * static_cast< T >(j) / static_cast< T >(points));
+                    const T f           = value(grid[j]);
+                    const T denominator = hornerEval(std::span< const T >(q), grid[j]);
+                    pole                = !(denominator > 0);
+                    err[j]              = f - hornerEval(std::span< const T >(p), grid[j]) / denominator;
+                    magnitude           = std::max(magnitude,
+                                         (hornerEval(std::span< const T >(pa), std::abs(grid[j])) +
+                                          std::abs(f) * hornerEval(std::span< const T >(qa), std::abs(grid[j]))) /
+                                             denominator);
+                }
+                if (pole) {
+                    if (damp()) continue;
+                    return tl::unexpected(NumerixxError("The Remez iteration failed; the denominator has a zero on the interval."));
+                }
+
+                // ===== The extremum of each run of equal sign, refined by parabolic interpolation.
+                std::vector< T > extrema;
+                std::vector< T > magnitudes;
+                for (std::size_t start = 0; start <= points;) {
+                    std::size_t end  = start;
+                    std::size_t best = start;
+                    while (end <= points && std::signbit(err[end]) == std::signbit(err[start])) {
+                        if (std::abs(err[end]) > std::abs(err[best])) best = end;
+                        ++end;
+                    }
+
+                    T location = grid[best];
+                    T extremum = std::abs(err[best]);
+                    if (best > 0 && best < points) {
+                        const T h0        = grid[best] - grid[best - 1];
+                        const T h1        = grid[best + 1] - grid[best];
+                        const T d0        = (err[best] - err[best - 1]) / h0;
+                        const T d1        = (err[best + 1] - err[best]) / h1;
+                        const T curvature = (d1 - d0) / (h0 + h1);
+                        if (curvature != 0) {
+                            const T candidate = std::clamp(grid[best] - (d0 * h1 + d1 * h0) / (h0 + h1) / (2 * curvature), grid[best - 1], grid[best + 1]);
+                            const T refined   = std::abs(error(candidate));
+                            if (refined > extremum) {
+                                location = candidate;
+                                extremum = refined;
+                            }
+                        }
+                    }
+                    extrema.push_back(location);
+                    magnitudes.push_back(extremum);
+                    start = end;
+                }
+
+                // ===== The errors cannot be levelled below their rounding errors, and the reference is kept.
+                const T noise = 16 * std::numeric_limits< T >::epsilon() * magnitude;
+                if (*std::max_element(magnitudes.begin(), magnitudes.end()) <= noise) return {};
+                if (extrema.size() < size) {
+                    if (damp()) continue;
+                    return tl::unexpected(NumerixxError("The Remez iteration failed; the error has too few alternations."));
+                }
+
+                // ===== Drop the smaller end extremum until the reference has the right size; the alternation is kept.
+                std::size_t first = 0;
+                std::size_t last  = extrema.size();
+                while (last - first > size) {
+                    if (magnitudes[first] < magnitudes[last - 1])
+                        ++first;
+                    else
+                        --last;
+                }
+
+                const auto [lo, hi] = std::minmax_element(magnitudes.begin() + static_cast< std::ptrdiff_t >(first),
+                                                          magnitudes.begin() + static_cast< std::ptrdiff_t >(last));
+                accepted            = reference;
+                damping             = 0;
+                std::copy(extrema.begin() + static_cast< std::ptrdiff_t >(first), extrema.begin() + static_cast< std::ptrdiff_t >(last), reference.begin());
+                if (*hi - *lo <= std::max(tolerance * *hi, noise)) return {};
+            }
+
+            return tl::unexpected(NumerixxError("The Remez iteration did not converge."));
+        }
+    }    // namespace detail
+
+    /**
+     * @brief A class representing a rational function p(x) / q(x), with polynomial numerator and denominator.
+     *
+     * Rational functions approximate many functions, in particular those with poles or asymptotes, far better
+     * than polynomials of the same total degree. The numerator and denominator are evaluated together in a single
+     * interleaved Horner pass (see detail::rationalEval), rather than as two separate evaluations, and the
+     * evaluation switches to 1 / x for |x| > 1 so that large arguments neither overflow nor lose accuracy.
+     *
+     * Rational functions are constructed from their numerator and denominator, as Padé approximants from Taylor
+     * coefficients (see pade()), or as minimax approximations on an interval (see minimaxRational()). Their zeros
+     * and poles are computed with polysolve() and poles().
+     *
+     * @note Common factors of the numerator and denominator are not cancelled.
+     *
+     * @tparam T The type of the coefficients. Must be a floating point type or a complex type.
+     */
+    template< typename T = double >
+        requires nxx::IsFloat< T > || IsComplex< T >
+    class Rational final
+    {
+    public:
+        /**
+         * @brief The type of the coefficients.
+         */
+        using value_type = T;
+
+        /**
+         * @brief The floating point type of the coefficients.
+         */
+        using fundamental_type = typename detail::FundamentalType< T >::type;
+
+    private:
+        Polynomial< T >  m_numerator;    /**< The numerator. */
+        Polynomial< T >  m_denominator;  /**< The denominator. */
+        std::vector< T > m_coefficients; /**< The interleaved coefficients, n_0, d_0, n_1, d_1, ... */
+
+        /**
+         * @brief Validates the denominator and builds the interleaved coefficients.
+         */
+        void interleave()
+        {
+            const auto& num = m_numerator.coefficients();
+            const auto& den = m_denominator.coefficients();
+            if (std::all_of(den.begin(), den.end(), [](const T& coeff) { return coeff == T {}; }))
+                throw NumerixxError("The denominator of a rational function must not be zero.");
+
+            const std::size_t length = std::max(num.size(), den.size());
+            m_coefficients.assign(2 * length, T {});
+            for (std::size_t k = 0; k < num.size(); ++k) m_coefficients[2 * k] = num[k];
+            for (std::size_t k = 0; k < den.size(); ++k) m_coefficients[2 * k + 1] = den[k];
+        }
+
+    public:
+        /**
+         * @brief Constructs the zero function, 0 / 1.
+         */
+        Rational()
+            : Rational(Polynomial< T >({ T {} }), Polynomial< T >({ T { 1 } }))
+        {}
+
+        /**
+         * @brief Constructs a rational function from its numerator and denominator.
+         *
+         * @param numerator The numerator.
+         * @param denominator The denominator.
+         *
+         * @throws NumerixxError if the denominator is the zero polynomial.
+         */
+        Rational(Polynomial< T > numerator, Polynomial< T > denominator)
+            : m_numerator(std::move(numerator)),
+              m_denominator(std::move(denominator))
+        {
+            interleave();
+        }
+
+        /**
+         * @brief Constructs a rational function with denominator one from a polynomial.
+         */
+        explicit Rational(Polynomial< T > numerator)
+            : Rational(std::move(numerator), Polynomial< T >({ T { 1 } }))
+        {}
+
+        /**
+         * @brief Returns the numerator.
+         */
+        [[nodiscard]]
+        const Polynomial< T >& numerator() const
+        {
+            return m_numerator;
+        }
+
+        /**
+         * @brief Returns the denominator.
+         */
+        [[nodiscard]]
+        const Polynomial< T >& denominator() const
+        {
+            return m_denominator;
+        }
+
+        /**
+         * @brief Evaluates the rational function at a given value.
+         *
+         * @param value The value to evaluate the function at.
+         * @return The value of the function at the specified input value.
+         */
+        inline auto operator()(auto value) const { return *evaluate(value); }
+
+        /**
+         * @brief Evaluates the rational function at a given point, in one fused pass over the numerator and the
+         * denominator.
+         *
+         * @param value The point at which to evaluate the function.
+         * @return The value of the function, or an error if the result is non-finite, e.g. at a pole.
+         */
+        template< typename U >
+            requires std::convertible_to< U, T > || nxx::IsFloat< U > || IsComplex< U >
+        [[nodiscard]]
+        inline auto evaluate(U value) const
+            -> tl::expected< std::common_type_t< T, U >, Error< detail::PolyErrorData< std::common_type_t< T, U > > > >
+        {
+            using TYPE      = std::common_type_t< T, U >;
+            using PolyError = Error< detail::PolyErrorData< TYPE > >;
+
+            const TYPE result = detail::rationalEval(std::span< const T >(m_coefficients), static_cast< TYPE >(value));
+
+            if (!detail::isFinite(result)) [[unlikely]]
+                return tl::unexpected(PolyError("Polynomial error",
+                                                nxx::NumerixxErrorType::Poly,
+                                                { .details      = "Rational function evaluation failed; non-finite result.",
+                                                  .coefficients = { m_coefficients.begin(), m_coefficients.end() },
+                                                  .arg          = value,
+                                                  .result       = result }));
+
+            return result;
+        }
+
+        /**
+         * @brief Evaluates the rational function at a range of points in a single batched pass.
+         *
+         * The fused evaluation is run across several points at once (see detail::rationalBatch). As for
+         * Polynomial::evaluate, errors are reported as one aggregate status for the whole batch.
+         *
+         * @param x The points at which to evaluate the function.
+         * @param out The destination of the results. Must have the same size as `x`.
+         * @return An empty expected on success, or an error if any of the results is non-finite.
+         *
+         * @throws NumerixxError if the sizes of `x` and `out` differ.
+         */
+        [[nodiscard]]
+        auto evaluate(std::span< const T > x, std::span< T > out) const -> tl::expected< void, Error< detail::PolyErrorData< T > > >
+        {
+            using PolyError = Error< detail::PolyErrorData< T > >;
+
+            if (x.size() != out.size())
+                throw NumerixxError("Batch evaluation requires the input and output ranges to be of equal size.");
+
+            detail::rationalBatch(std::span< const T >(m_coefficients), x, out);
+
+            const auto failures = std::count_if(out.begin(), out.end(), [](const T& val) { return !detail::isFinite(val); });
+            if (failures > 0) [[unlikely]] {
+                const auto pos = std::find_if(out.begin(), out.end(), [](const T& val) { return !detail::isFinite(val); }) - out.begin();
+                return tl::unexpected(PolyError("Polynomial error",
+                                                nxx::NumerixxErrorType::Poly,
+                                                { .details = "Batch rational function evaluation failed; " + std::to_string(failures) +
+                                                             " non-finite result(s).",
+                                                  .coefficients = { m_coefficients.begin(), m_coefficients.end() },
+                                                  .arg          = x[static_cast< std::size_t >(pos)],
+                                                  .result       = out[static_cast< std::size_t >(pos)] }));
+            }
+
+            return {};
+        }
+    };
+
+    /**
+     * @brief Computes the [m/n] Padé approximant of a function from its Taylor coefficients.
+     *
+     * The approximant p(x) / q(x), with p of order m, q of order n and q(0) = 1, matches the Taylor series up to
+     * and including the term of order m + n. The coefficients of q solve the n x n linear system
+     * sum_(j=1..n) q_j c_(k-j) = -c_k for k = m + 1, ..., m + n, and those of p follow by convolution.
+     *
+     * @param taylor The Taylor coefficients c_0, c_1, ..., in increasing order of degree; at least m + n + 1.
+     * @param m The order of the numerator.
+     * @param n The order of the denominator.
+     * @return The approximant, or an error if the linear system is singular, i.e. if the [m/n] approximant is
+     * degenerate; a neighbouring [m/n] may then be used instead.
+     *
+     * @throws NumerixxError if fewer than m + n + 1 Taylor coefficients are given.
+     */
+    template< IsCoefficientContainer CONTAINER, typename T = typename CONTAINER::value_type >
+    tl::expected< Rational< T >, NumerixxError > pade(const CONTAINER& taylor, std::size_t m, std::size_t n)
+    {
+        const std::vector< T > c(taylor.begin(), taylor.end());
+        if (c.size() < m + n + 1) throw NumerixxError("A Padé approximant [m/n] requires m + n + 1 Taylor coefficients.");
+
+        auto coeff = [&](std::size_t k, std::size_t j) { return k >= j ? c[k - j] : T {}; };
+
+        std::vector< T > q(n + 1);
+        q[0] = 1;
+        if (n > 0) {
+            std::vector< T > matrix(n * n);
+            std::vector< T > rhs(n);
+            for (std::size_t row = 0; row < n; ++row) {
+                const std::size_t k = m + 1 + row;
+                for (std::size_t j = 1; j <= n; ++j) matrix[row * n + j - 1] = coeff(k, j);
+                rhs[row] = -c[k];
+            }
+            if (!detail::solveLinearSystem(matrix, rhs))
+                return tl::unexpected(NumerixxError("The Padé approximant is degenerate; the linear system is singular."));
+            std::copy(rhs.begin(), rhs.end(), q.begin() + 1);
+        }
+
+        std::vector< T > p(m + 1);
+        for (std::size_t i = 0; i <= m; ++i)
+            for (std::size_t j = 0; j <= std::min(i, n); ++j) p[i] += q[j] * c[i - j];
+
+        return Rational< T >(Polynomial< T >(p), Polynomial< T >(q));
+    }
+
+    /**
+     * @brief Computes the [m/n] minimax rational approximation of a real function on an interval, using the
+     * rational Remez algorithm.
+     *
+     * The approximation p / q, with p of order m and q of order n, minimizes the maximum absolute error on
+     * [lower, upper]. The error of the best approximation equioscillates at m + n + 2 points; each iteration
+     * solves for the rational function that levels the error on the current reference points (by secant steps
+     * on the level), and then replaces the reference by the alternating extrema of the error, located on a grid
+     * of REMEZ_GRID_FACTOR * (m + n + 2) points and refined by parabolic interpolation. The iteration stops when
+     * the extrema are level to the relative tolerance, or to the rounding errors of the error, if those are
+     * larger. An exchange after which the denominator has a zero on the interval, or the error has too few
+     * alternations, is damped towards the previous reference (see detail::remez()).
+     *
+     * The rational problem is sensitive to the initial reference, so it is approached along the anti-diagonal of
+     * the Walsh table: the [m + n / 0] minimax polynomial is computed from the Chebyshev extreme points, and each
+     * of [m + n - 1 / 1], ..., [m / n] starts from the reference of the one before, all having m + n + 2 points.
+     *
+     * The computation is done in t = (2x - lower - upper) / (upper - lower) on [-1, 1], and the result is
+     * converted to polynomials in x, with the denominator normalized to one at the midpoint of the interval.
+     *
+     * @note Remez was preferred over AAA because it yields the numerator and denominator in the polynomial form
+     * that Rational stores; AAA yields a barycentric form, whose conversion is unstable. As for any monomial
+     * representation, intervals far from the origin relative to their width lose accuracy in the conversion,
+     * and m + n should stay below about 16. Some [m/n] are degenerate, or nearly so, e.g. many for odd or even
+     * functions on symmetric intervals: their best approximation has fewer than m + n + 2 alternations, or a pole
+     * close to the interval, and the iteration breaks down. The [m/n - 1] approximation is then returned
+     * instead, recursively, so the denominator of the result may have a lower order than n.
+     *
+     * @param function The function to approximate.
+     * @param m The order of the numerator.
+     * @param n The order of the denominator.
+     * @param lower The lower bound of the interval.
+     * @param upper The upper bound of the interval.
+     * @param tolerance The relative tolerance on the levelling of the error. Defaults to 1E-6.
+     * @param max_iterations The maximum number of Remez iterations. Defaults to 100.
+     * @return The approximation, or an error if the iteration breaks down even for the [m/0] minimax polynomial.
+     *
+     * @throws NumerixxError if lower is not less than upper.
+     */
+    template< std::floating_point T = double >
+    tl::expected< Rational< T >, NumerixxError > minimaxRational(std::invocable< T > auto function,
+                                                                 std::size_t              m,
+                                                                 std::size_t              n,
+                                                                 T                        lower,
+                                                                 T                        upper,
+                                                                 T                        tolerance      = T(1.0E-6),
+                                                                 int                      max_iterations = 100)
+    {
+        if (!(lower < upper)) throw NumerixxError("The interval of a minimax approximation must have lower < upper.");
+
+        const std::size_t size  = m + n + 2;
+        const T           mid   = (lower + upper) / 2;
+        const T           half  = (upper - lower) / 2;
+        auto              value = [&](T t) { return static_cast< T >(function(mid + half * t)); };
+
+        std::vector< T > reference(size);
+        for (std::size_t i = 0; i < size; ++i)
+            reference[i] = -std::cos(std::numbers::pi_v< T > * static_cast< T >(i) / static_cast< T >(size - 1));
+
+        // ===== Each of [m + n / 0], [m + n - 1 / 1], ... starts from the extrema of the one before; the polynomial
+        //       problem converges reliably from the Chebyshev points, and each step to the next is small.
+        for (std::size_t k = 0; k < n; ++k) {
+            std::vector< T > numerator(m + n - k + 1);
+            std::vector< T > denominator(k + 1);
+            (void)detail::remez(value, m + n - k, k, reference, tolerance, max_iterations, numerator, denominator);
+        }
+
+        // ===== A breakdown usually comes from an [m/n] that is degenerate, or nearly so, and close to [m/n - 1].
+        std::vector< T > p(m + 1);
+        std::vector< T > q(n + 1);
+        if (const auto status = detail::remez(value, m, n, reference, tolerance, max_iterations, p, q); !status) {
+            if (n == 0) return tl::unexpected(status.error());
+            return minimaxRational< T >(function, m, n - 1, lower, upper, tolerance, max_iterations);
+        }
+
+        const T scale = 1 / half;
+        const T shift = -mid / half;
+        return Rational< T >(Polynomial< T >(detail::composeAffine(std::span< const T >(p), scale, shift)),
+                             Polynomial< T >(detail::composeAffine(std::span< const T >(q), scale, shift)));
+    }
+
+    /**
+     * @brief Finds the zeros of a rational function, as the roots of its numerator.
+     *
+     * See polysolve() for polynomials for details; zeros that are cancelled by poles are also returned.
+     *
+     * @tparam RT The desired return type for the roots. Defaults to void, which will return the same type as
+     * the coefficients.
+     * @param func The rational function.
+     * @param tolerance The convergence tolerance. Defaults to nxx::EPS.
+     * @param max_iterations The maximum number of iterations. Defaults to nxx::MAXITER.
+     * @return A vector containing the zeros, or an error.
+     *
+     * @throws NumerixxError if the order of the numerator is less than one.
+     */
+    template< typename RT = void, typename T >
+    inline auto polysolve(const Rational< T >& func, typename Rational< T >::fundamental_type tolerance = nxx::EPS, int max_iterations = nxx::MAXITER)
+    {
+        return polysolve< RT >(func.numerator(), tolerance, max_iterations);
+    }
+
+    /**
+     * @brief Finds the poles of a rational function, as the roots of its denominator.
+     *
+     * @tparam RT The desired return type for the poles. Defaults to void, which will return the same type as
+     * the coefficients.
+     * @param func The rational function.
+     * @param tolerance The convergence tolerance. Defaults to nxx::EPS.
+     * @param max_iterations The maximum number of iterations. Defaults to nxx::MAXITER.
+     * @return A vector containing the poles, or an error.
+     *
+     * @throws NumerixxError if the order of the denominator is less than one.
+     */
+    template< typename RT = void, typename T >
+    inline auto poles(const Rational< T >& func, typename Rational< T >::fundamental_type tolerance = nxx::EPS, int max_iterations = nxx::MAXITER)
+    {
+        return polysolve< RT >(func.denominator(), tolerance, max_iterations);
+    }
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYRATIONAL_HPP
@@ -0,0 +1,433 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYREALROOTS_HPP
+#define NUMERIXX_POLYREALROOTS_HPP
+
+// ===== Numerixx Includes
+#include "PolyDivision.hpp"
+#include "PolyEvaluation.hpp"
+#include <Roots.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace nxx::poly::detail
+{
+    /**
+     * @brief The polynomial order from which the positive and negative roots are isolated in parallel (with OpenMP).
+     *
+     * @note The two searches are often unbalanced, as the roots of typical polynomials are not spread evenly
+     * over both halves, so this only pays off for high orders. The threshold was determined with
+     * benchPolynomial (BM_PolysolveReal).
+     */
+    inline constexpr std::size_t REAL_ROOT_ISOLATION_PARALLEL_ORDER = 512;
+
+    /**
+     * @brief The number of isolating intervals from which the roots are refined in parallel (with OpenMP).
+     */
+    inline constexpr std::size_t REAL_ROOT_PARALLEL_THRESHOLD = 64;
+
+    /**
+     * @brief An interval of the real line holding one or more real roots of a polynomial.
+     *
+     * If lower equals upper, the interval is a root of the given multiplicity: either an exact root, or the
+     * midpoint of a cluster narrower than the tolerance, which holds a multiple root or several roots close
+     * together. Otherwise, the interval isolates a single simple root, and neither bound is a root.
+     */
+    template< typename FLOAT_T >
+    struct RealRootInterval
+    {
+        FLOAT_T     lower;        /**< The lower bound of the interval. */
+        FLOAT_T     upper;        /**< The upper bound of the interval. */
+        std::size_t multiplicity; /**< The number of roots in the interval. */
+    };
+
+    /**
+     * @brief Shifts a polynomial by one in place, i.e. replaces p(x) by p(x + 1), using Horner's scheme.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree.
+     */
+    template< typename FLOAT_T >
+    inline void taylorShiftUnit(std::span< FLOAT_T > coeffs)
+    {
+        const std::size_t n = coeffs.size() - 1;
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = n; j-- > i;) coeffs[j] += coeffs[j + 1];
+    }
+
+    /**
+     * @brief Scales the coefficients of a polynomial in place by a power of two, so that the largest has unit
+     * exponent. The scaling is exact, and keeps the coefficients from overflowing during the bisection.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree.
+     */
+    template< typename FLOAT_T >
+    inline void normalizeExponent(std::span< FLOAT_T > coeffs)
+    {
+        FLOAT_T largest = 0;
+        for (const auto& c : coeffs) largest = std::max(largest, std::abs(c));
+        if (largest == 0 || !std::isfinite(largest)) return;
+        const int exponent = std::ilogb(largest);
+        for (auto& c : coeffs) c = std::ldexp(c, -exponent);
+    }
+
+    /**
+     * @brief Checks if the value of a polynomial at a point is within the rounding error of Horner's method.
+     *
+     * The sign of such a value is not reliable, so the point is a root as far as floating point evaluation
+     * can tell. The error bound is 2n * eps * sum |a_i| |x|^i.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree.
+     * @param x The point at which the polynomial is evaluated.
+     * @param value The value of the polynomial at x.
+     * @return true if |value| does not exceed the rounding error bound.
+     */
+    template< typename FLOAT_T >
+    inline bool isRoundingZero(std::span< const FLOAT_T > coeffs, FLOAT_T x, FLOAT_T value)
+    {
+        FLOAT_T bound = 0;
+        for (std::size_t i = coeffs.size(); i-- > 0;) bound = bound * std::abs(x) + std::abs(coeffs[i]);
+        return std::abs(value) <= static_cast< FLOAT_T >(2 * coeffs.size()) * std::numeric_limits< FLOAT_T >::epsilon() * bound;
+    }
+
+    /**
+     * @brief Bounds the number of roots of a polynomial in the open interval (0, 1), using Descartes' rule of signs.
+     *
+     * The roots in (0, 1) are mapped to the positive roots of (x + 1)^n p(1 / (x + 1)), whose coefficients
+     * are the reversed coefficients of p, shifted by one. The number of sign variations of these coefficients
+     * exceeds the number of roots by an even number, so 0 and 1 are exact counts.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree.
+     * @param work The workspace for the transformed coefficients; must have the same size as coeffs.
+     * @return The number of sign variations.
+     */
+    template< typename FLOAT_T >
+    inline std::size_t descartesBound(std::span< const FLOAT_T > coeffs, std::span< FLOAT_T > work)
+    {
+        std::reverse_copy(coeffs.begin(), coeffs.end(), work.begin());
+        taylorShiftUnit(work);
+
+        std::size_t variations = 0;
+        int         sign       = 0;
+        for (const auto& c : work) {
+            if (c == 0) continue;
+            const int current = c < 0 ? -1 : 1;
+            if (sign != 0 && current != sign) ++variations;
+            sign = current;
+        }
+        return variations;
+    }
+
+    /**
+     * @brief Isolates the positive (or negative) real roots of a polynomial, using the Vincent–Collins–Akritas
+     * bisection method.
+     *
+     * The roots are first scaled into (0, 1) by the power of two B above the Fujiwara bound, i.e. q(t) = p(Bt),
+     * or p(-Bt) for the negative roots. An interval is discarded if Descartes' rule of signs finds no root in
+     * it, and reported if it finds one; otherwise it is bisected, using q(t / 2) for the left half and
+     * q((t + 1) / 2) for the right half. All scalings are by powers of two, so an exact root at the
+     * midpoint is detected as a zero constant coefficient of the right half, and divided out of both halves
+     * with its multiplicity. So is a midpoint where the original polynomial is within rounding error of zero
+     * (see isRoundingZero()), as the rounding errors of the shifts may otherwise count such a root in both
+     * halves, or in neither; its multiplicity is then the number of derivatives that are within rounding error
+     * of zero too. An interval bounded by such a root is bisected further, until the bounds of the isolating
+     * interval are not roots. Intervals narrower than the tolerance, where Descartes' rule still finds several
+     * roots, are reported as clusters. So are the roots that Descartes' rule stops counting when an interval
+     * narrower than about (n + 2) times the square root of the tolerance is bisected, i.e. complex roots close
+     * to the real axis, into which rounding errors may have split a multiple root.
+     *
+     * The pending intervals are kept on a stack, and their coefficients in a single arena, so the workspace
+     * is only allocated while the stack grows. Only real arithmetic is used.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree. Both the constant and the
+     * leading coefficient must be non-zero.
+     * @param negative Whether to isolate the negative roots instead of the positive roots.
+     * @param tolerance The width below which an interval is no longer bisected.
+     * @param intervals The destination of the isolating intervals, in the original variable.
+     */
+    template< typename FLOAT_T >
+    inline void isolateRealRoots(std::span< const FLOAT_T >                  coeffs,
+                                 bool                                        negative,
+                                 FLOAT_T                                     tolerance,
+                                 std::vector< RealRootInterval< FLOAT_T > >& intervals)
+    {
+        const std::size_t n = coeffs.size() - 1;
+
+        // ===== Fujiwara bound 2 * max |a_i / a_n|^(1 / (n - i)), rounded up to a power of two B = 2^k.
+        const FLOAT_T logLead = std::log2(std::abs(coeffs[n]));
+        FLOAT_T       logMax  = std::numeric_limits< FLOAT_T >::lowest();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (coeffs[i] == 0) continue;
+            const FLOAT_T logRatio = std::log2(std::abs(coeffs[i])) - logLead - (i == 0 ? 1 : 0);
+            logMax                 = std::max(logMax, logRatio / static_cast< FLOAT_T >(n - i));
+        }
+        const int     k     = static_cast< int >(std::floor(logMax)) + 2;
+        const FLOAT_T scale = std::ldexp(FLOAT_T(1), k);
+        const auto    toX   = [&](FLOAT_T t) { return negative ? -scale * t : scale * t; };
+
+        // ===== Interval [lower, lower + width] of the scaled variable t, with its coefficients at arena[offset],
+        // and whether its bounds are exact roots (which have been divided out of the coefficients).
+        struct Node
+        {
+            std::size_t offset;
+            std::size_t order;
+            FLOAT_T     lower;
+            FLOAT_T     width;
+            bool        rootAtLower;
+            bool        rootAtUpper;
+        };
+
+        // ===== Coefficients of q(t) = p(Bt), scaled by a power of two so that the largest has unit exponent.
+        int shift = std::numeric_limits< int >::lowest();
+        for (std::size_t i = 0; i <= n; ++i)
+            if (coeffs[i] != 0) shift = std::max(shift, std::ilogb(coeffs[i]) + k * static_cast< int >(i));
+
+        std::vector< FLOAT_T > arena(coeffs.begin(), coeffs.end());
+        for (std::size_t i = 0; i <= n; ++i) {
+            arena[i] = std::ldexp(arena[i], k * static_cast< int >(i) - shift);
+            if (negative && i % 2 == 1) arena[i] = -arena[i];
+        }
+
+        std::vector< Node >    stack { Node { 0, n, FLOAT_T(0), FLOAT_T(1), false, false } };
+        std::vector< FLOAT_T > left;
+        std::vector< FLOAT_T > work;
+        std::vector< FLOAT_T > scratch;
+        std::vector< FLOAT_T > derivative;
+        const FLOAT_T          scaledTolerance    = tolerance / scale;
+        const FLOAT_T          scaledClusterWidth = std::sqrt(tolerance) / scale;
+
+        while (!stack.empty()) {
+            const Node node = stack.back();
+            stack.pop_back();
+            left.assign(arena.begin() + static_cast< std::ptrdiff_t >(node.offset),
+                        arena.begin() + static_cast< std::ptrdiff_t >(node.offset + node.order + 1));
+            arena.resize(node.offset);
+            work.resize(node.order + 1);
+
+            const std::size_t count = descartesBound(std::span< const FLOAT_T >(left), std::span< FLOAT_T >(work));
+            if (count == 0) continue;
+
+            if (count == 1 && !node.rootAtLower && !node.rootAtUpper) {
+                const FLOAT_T lower = std::min(toX(node.lower), toX(node.lower + node.width));
+                const FLOAT_T upper = std::max(toX(node.lower), toX(node.lower + node.width));
+                intervals.push_back({ lower, upper, 1 });
+                continue;
+            }
+
+            const FLOAT_T half = node.width / 2;
+            if (node.width < scaledTolerance || node.lower + half == node.lower) {
+                intervals.push_back({ toX(node.lower + half), toX(node.lower + half), count });
+                continue;
+            }
+
+            // ===== Left half q(t / 2), and right half q((t + 1) / 2), i.e. the left half shifted by one.
+            for (std::size_t i = 1; i < left.size(); ++i) left[i] = std::ldexp(left[i], -static_cast< int >(i));
+            normalizeExponent(std::span< FLOAT_T >(left));
+            auto right = std::span< FLOAT_T >(work);
+            std::copy(left.begin(), left.end(), right.begin());
+            taylorShiftUnit(right);
+
+            // ===== An exact root at the midpoint is a zero constant coefficient of the right half. The coefficients
+            // carry the rounding errors of all shifts so far, which may move a root lying at the midpoint into both
+            // halves or out of both, so the midpoint is also checked on the original polynomial.
+            // The multiplicity of such a root is the number of successive derivatives that vanish there as well.
+            std::size_t zeros = 0;
+            while (zeros < node.order && right[zeros] == 0) ++zeros;
+            const FLOAT_T mid = toX(node.lower + half);
+            if (zeros == 0 && isRoundingZero(coeffs, mid, hornerEval(coeffs, mid))) {
+                zeros = 1;
+                derivative.assign(coeffs.begin(), coeffs.end());
+                while (zeros < std::min(count, node.order)) {
+                    for (std::size_t i = 1; i < derivative.size(); ++i) derivative[i - 1] = derivative[i] * static_cast< FLOAT_T >(i);
+                    derivative.pop_back();
+                    const auto slope = std::span< const FLOAT_T >(derivative);
+                    if (!isRoundingZero(slope, mid, hornerEval(slope, mid))) break;
+                    ++zeros;
+                }
+            }
+
+            // ===== A root at the midpoint is divided out of both halves.
+            if (zeros > 0) {
+                intervals.push_back({ mid, mid, zeros });
+                right = right.subspan(zeros);
+                for (std::size_t i = 0; i < zeros; ++i)
+                    deflateLinear(std::span< FLOAT_T >(left).first(left.size() - i), FLOAT_T(1));
+                left.resize(left.size() - zeros);
+            }
+
+            // ===== Rounding errors may turn a multiple root into complex roots very close to the real axis, which
+            // Descartes' rule stops counting once the halves no longer reach them. As the Obreshkoff lens of a half,
+            // where roots are always counted, is about (n + 2) times narrower than the half, roots lost this way in
+            // an interval narrower than (n + 2) times the square root of the tolerance are reported as a cluster,
+            // like filtering complex roots by their imaginary part would keep them.
+            if (count >= 2 && node.width < static_cast< FLOAT_T >(node.order + 2) * scaledClusterWidth) {
+                scratch.resize(left.size());
+                const std::size_t found = zeros + descartesBound(std::span< const FLOAT_T >(left), std::span< FLOAT_T >(scratch))
+                                          + descartesBound(std::span< const FLOAT_T >(right), std::span< FLOAT_T >(scratch));
+                if (found < count) intervals.push_back({ mid, mid, count - found });
+            }
+
+            if (right.size() > 1) {
+                stack.push_back({ arena.size(), right.size() - 1, node.lower + half, half, zeros > 0, node.rootAtUpper });
+                arena.insert(arena.end(), right.begin(), right.end());
+            }
+            if (left.size() > 1) {
+                stack.push_back({ arena.size(), left.size() - 1, node.lower, half, node.rootAtLower, zeros > 0 });
+                arena.insert(arena.end(), left.begin(), left.end());
+            }
+        }
+    }
+
+    /**
+     * @brief Refines a simple real root of a polynomial in an isolating interval, using Ridder's method.
+     *
+     * A bound at which the polynomial is within rounding error of zero (see isRoundingZero()) is first moved
+     * inward, or returned if the isolated root is within rounding error of it. The iteration stops when the
+     * bracket is narrower than the tolerance, or when the polynomial is exactly zero at one of its bounds. If
+     * the polynomial has the same sign at both bounds, which may happen due to rounding errors close to a
+     * root, the midpoint of the interval is returned.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree.
+     * @param lower The lower bound of the isolating interval.
+     * @param upper The upper bound of the isolating interval.
+     * @param tolerance The width of the final bracket.
+     * @param max_iterations The maximum number of iterations.
+     * @return The root, or std::nullopt if the maximum number of iterations was reached.
+     */
+    template< typename FLOAT_T >
+    inline std::optional< FLOAT_T >
+        refineRealRoot(std::span< const FLOAT_T > coeffs, FLOAT_T lower, FLOAT_T upper, FLOAT_T tolerance, int max_iterations)
+    {
+        const auto function = [coeffs](FLOAT_T x) { return hornerEval(coeffs, x); };
+
+        // ===== A bound may be a root itself, i.e. within rounding error of one, so that the sign of the polynomial
+        // there is not reliable. The bound is then moved inward, until the signs bracket the isolated root.
+        // If no point does, the isolated root is the one at the bound.
+        const auto moveInward = [&function, coeffs](FLOAT_T& bound, FLOAT_T other) {
+            const FLOAT_T f_other = function(other);
+            if (!isRoundingZero(coeffs, bound, function(bound)) || isRoundingZero(coeffs, other, f_other)) return true;
+            for (FLOAT_T step = (other - bound) / 2; bound + step != bound; step /= 2) {
+                const FLOAT_T f_inner = function(bound + step);
+                if (!isRoundingZero(coeffs, bound + step, f_inner) && (f_inner < 0) != (f_other < 0)) {
+                    bound += step;
+                    return true;
+                }
+            }
+            return false;
+        };
+        if (!moveInward(lower, upper)) return lower;
+        if (!moveInward(upper, lower)) return upper;
+
+        auto solver = nxx::roots::Ridder< decltype(function), FLOAT_T >(function, std::pair { lower, upper });
+        for (int i = 0;; ++i) {
+            const auto [lo, hi] = solver.current();
+            const FLOAT_T f_lo  = solver.evaluate(lo);
+            const FLOAT_T f_hi  = solver.evaluate(hi);
+
+            if (f_lo == 0) return lo;
+            if (f_hi == 0) return hi;
+            if ((f_lo < 0) == (f_hi < 0)) return (lo + hi) / 2;
+            if (hi - lo < tolerance) return std::abs(f_lo) < std::abs(f_hi) ? lo : hi;
+            if (i >= max_iterations) return std::nullopt;
+            solver.iterate();
+        }
+    }
+
+    /**
+     * @brief Finds the real roots of a polynomial with real coefficients, without complex arithmetic.
+     *
+     * Zero roots are divided out first. The positive and the negative roots are then isolated independently
+     * (see isolateRealRoots()), and each isolated root is refined independently (see refineRealRoot()); both
+     * steps run in parallel when OpenMP is enabled and there is enough work. Clusters are reported as a
+     * root at their midpoint, repeated by the number of roots found in them.
+     *
+     * @param coeffs The polynomial coefficients, in increasing order of degree. The leading coefficient
+     * must be non-zero.
+     * @param tolerance The accuracy of the roots.
+     * @param max_iterations The maximum number of iterations for refining each root.
+     * @return The real roots in ascending order, repeated by multiplicity, or std::nullopt if a root could
+     * not be refined within the maximum number of iterations.
+     */
+    template< typename FLOAT_T >
+    inline std::optional< std::vector< FLOAT_T > > realRoots(std::span< const FLOAT_T > coeffs, FLOAT_T tolerance, int max_iterations)
+    {
+        std::size_t zeros = 0;
+        while (zeros + 1 < coeffs.size() && coeffs[zeros] == 0) ++zeros;
+        const auto reduced = coeffs.subspan(zeros);
+
+        // ===== Isolate the negative and the positive roots; the two searches are independent.
+        std::array< std::vector< RealRootInterval< FLOAT_T > >, 2 > found;
+        if (reduced.size() > 1) {
+#pragma omp parallel for if (reduced.size() > REAL_ROOT_ISOLATION_PARALLEL_ORDER)
+            for (int side = 0; side < 2; ++side)
+                isolateRealRoots(reduced, side == 0, tolerance, found[static_cast< std::size_t >(side)]);
+        }
+
+        auto& intervals = found[0];
+        intervals.insert(intervals.end(), found[1].begin(), found[1].end());
+        if (zeros > 0) intervals.push_back({ FLOAT_T(0), FLOAT_T(0), zeros });
+
+        // ===== Refine the isolated roots; the intervals are disjoint, so the refinements are independent.
+        std::vector< FLOAT_T > estimates(intervals.size());
+        const auto             count    = static_cast< std::ptrdiff_t >(intervals.size());
+        std::size_t            failures = 0;
+
+#pragma omp parallel for if (intervals.size() >= REAL_ROOT_PARALLEL_THRESHOLD) reduction(+ : failures)
+        for (std::ptrdiff_t s = 0; s < count; ++s) {
+            const auto  i        = static_cast< std::size_t >(s);
+            const auto& interval = intervals[i];
+            if (interval.lower == interval.upper) {
+                estimates[i] = interval.lower;
+                continue;
+            }
+            const auto root = refineRealRoot(reduced, interval.lower, interval.upper, tolerance, max_iterations);
+            if (root)
+                estimates[i] = *root;
+            else
+                ++failures;
+        }
+        if (failures > 0) return std::nullopt;
+
+        std::vector< FLOAT_T > roots;
+        for (std::size_t i = 0; i < intervals.size(); ++i) roots.insert(roots.end(), intervals[i].multiplicity, estimates[i]);
+        std::sort(roots.begin(), roots.end());
+        return roots;
+    }
+}    // namespace nxx::poly::detail
+
+#endif    // NUMERIXX_POLYREALROOTS_HPP
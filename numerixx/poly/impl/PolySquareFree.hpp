@@ -0,0 +1,826 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYSQUAREFREE_HPP
+#define NUMERIXX_POLYSQUAREFREE_HPP
+
+// ===== Numerixx Includes
+#include "PolyDivision.hpp"
+#include "PolyEvaluation.hpp"
+#include "PolyMultiplication.hpp"
+#include "Polyroots.hpp"
+#include <Constants.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief The number of Gauss-Newton steps for refining an approximate GCD.
+         *
+         * @note The Gauss-Newton iteration converges quadratically from the GCD computed from the null vector
+         * of the Sylvester subresultant (see approximateGcd()), and three steps reach the accuracy permitted by
+         * the conditioning of the GCD for the test cases in testPolynomials.
+         */
+        inline constexpr int GCD_REFINEMENT_STEPS = 3;
+
+        /**
+         * @brief The number of steps of inverse iteration for the smallest singular value of a Sylvester
+         * subresultant (see subresultantCofactor()).
+         *
+         * @note Each step reduces the error of the singular vector by the squared ratio of the two smallest
+         * singular values. When a common divisor of the order exists, the smallest is at the rounding level and
+         * the next is not, so the vector is accurate to working precision after two steps; four leave a margin.
+         */
+        inline constexpr int GCD_INVERSE_ITERATIONS = 4;
+
+        /**
+         * @brief The largest number of orders tried for an approximate GCD, from the order estimated from the
+         * Sylvester subresultants down (see approximateGcd()).
+         *
+         * @note The estimated order is accepted for all test cases in testPolynomials; the lower orders are a
+         * safeguard for refinements that fail to converge, as any divisor of the GCD is a common divisor too.
+         */
+        inline constexpr std::size_t GCD_MAX_CANDIDATES = 3;
+
+        /**
+         * @brief The number of times a square-free decomposition that fails the verification is retried with
+         * a looser tolerance for the GCDs (see squareFreeFactors()).
+         *
+         * @note The tolerance is raised geometrically from the given one to its square root, which is the
+         * accuracy the verification allows for. For (x + 0.3)^8 (x - 0.4)^8 (x - 1.1)^8 (x - 1.8)^8, the
+         * quotients of Yun's algorithm are only accurate to about 1e-8, so with a tolerance of 1e-15, only the
+         * last attempt succeeds.
+         */
+        inline constexpr int SQUAREFREE_RETRIES = 3;
+
+        /**
+         * @brief Returns the largest magnitude of the coefficients of a polynomial.
+         */
+        template< typename TYPE >
+        inline auto maxNorm(std::span< const TYPE > coeffs)
+        {
+            using std::abs;
+            decltype(abs(TYPE {})) result {};
+            for (const auto& coeff : coeffs) result = std::max(result, abs(coeff));
+            return result;
+        }
+
+        /**
+         * @brief Removes the trailing coefficients whose magnitude is at most the threshold, keeping at least one.
+         */
+        template< typename TYPE, typename FLOAT_T >
+        inline void trimCoefficients(std::vector< TYPE >& coeffs, FLOAT_T threshold)
+        {
+            using std::abs;
+            while (coeffs.size() > 1 && abs(coeffs.back()) <= threshold) coeffs.pop_back();
+        }
+
+        /**
+         * @brief Divides the coefficients of a polynomial by its leading coefficient, unless the polynomial is zero.
+         */
+        template< typename TYPE >
+        inline void makeMonic(std::vector< TYPE >& coeffs)
+        {
+            const TYPE lead = coeffs.back();
+            if (lead == TYPE {}) return;
+            for (auto& coeff : coeffs) coeff /= lead;
+        }
+
+        /**
+         * @brief Computes the coefficients of the derivative of a polynomial.
+         */
+        template< typename TYPE >
+        inline std::vector< TYPE > differentiate(std::span< const TYPE > coeffs)
+        {
+            using FLOAT_T = decltype(std::abs(TYPE {}));
+            if (coeffs.size() < 2) return { TYPE {} };
+            std::vector< TYPE > result(coeffs.size() - 1);
+            for (std::size_t k = 1; k < coeffs.size(); ++k) result[k - 1] = coeffs[k] * static_cast< FLOAT_T >(k);
+            return result;
+        }
+
+        /**
+         * @brief Divides two polynomials which are known to divide exactly, discarding the (rounding) remainder.
+         *
+         * @param dividend The coefficients of the dividend.
+         * @param divisor The coefficients of the divisor. The leading coefficient must be non-zero.
+         * @return The coefficients of the quotient; zero if the divisor has a higher order than the dividend.
+         */
+        template< typename TYPE >
+        inline std::vector< TYPE > exactQuotient(std::span< const TYPE > dividend, std::span< const TYPE > divisor)
+        {
+            if (dividend.size() < divisor.size()) return { TYPE {} };
+            std::vector< TYPE > remainder(dividend.begin(), dividend.end());
+            std::vector< TYPE > quotient(dividend.size() - divisor.size() + 1);
+            divideSchoolbook(std::span< TYPE >(remainder), divisor, std::span< TYPE >(quotient));
+            return quotient;
+        }
+
+        /**
+         * @brief Returns the complex conjugate of a value, or the value itself if it is real.
+         */
+        template< typename TYPE >
+        inline TYPE conjugate(const TYPE& value)
+        {
+            if constexpr (IsComplex< TYPE >)
+                return std::conj(value);
+            else
+                return value;
+        }
+
+        /**
+         * @brief Reduces the leading columns of a matrix to upper triangular form, using Householder reflections.
+         *
+         * The reflections are applied to all columns, so any further columns (e.g. right-hand sides of a least
+         * squares problem) are multiplied by Q^H as well.
+         *
+         * @param matrix The matrix in column-major order. On return, the leading columns hold R.
+         * @param rows The number of rows of the matrix.
+         * @param pivots The number of leading columns to reduce.
+         */
+        template< typename TYPE >
+        inline void householderReduce(std::span< TYPE > matrix, std::size_t rows, std::size_t pivots)
+        {
+            using FLOAT_T = decltype(std::abs(TYPE {}));
+            using std::abs;
+            using std::sqrt;
+
+            const std::size_t   cols = matrix.size() / rows;
+            std::vector< TYPE > reflector(rows);
+            for (std::size_t col = 0; col < pivots && col + 1 < rows; ++col) {
+                TYPE* column = matrix.data() + col * rows;
+
+                FLOAT_T norm2 = 0;
+                for (std::size_t r = col; r < rows; ++r) norm2 += std::norm(column[r]);
+                if (norm2 == 0) continue;
+
+                // The reflection maps the column to alpha * e_col, with alpha of opposite phase to avoid cancellation.
+                const FLOAT_T norm  = sqrt(norm2);
+                const FLOAT_T pivot = abs(column[col]);
+                const TYPE    alpha = pivot == 0 ? TYPE(-norm) : -column[col] / pivot * norm;
+                for (std::size_t r = col; r < rows; ++r) reflector[r] = column[r];
+                reflector[col] -= alpha;
+
+                FLOAT_T reflectorNorm2 = 0;
+                for (std::size_t r = col; r < rows; ++r) reflectorNorm2 += std::norm(reflector[r]);
+                for (std::size_t j = col; j < cols; ++j) {
+                    TYPE* target = matrix.data() + j * rows;
+                    TYPE  dot {};
+                    for (std::size_t r = col; r < rows; ++r) dot += conjugate(reflector[r]) * target[r];
+                    dot *= 2 / reflectorNorm2;
+                    for (std::size_t r = col; r < rows; ++r) target[r] -= dot * reflector[r];
+                }
+            }
+        }
+
+        /**
+         * @brief Adds the convolution matrix of a polynomial a to a block of a column-major matrix.
+         *
+         * Column colOffset + j receives the coefficients of a, starting at row rowOffset + j, so that the block
+         * times the coefficients of x gives the coefficients of a * x.
+         */
+        template< typename TYPE >
+        inline void addConvolution(std::span< TYPE >       matrix,
+                                   std::size_t             rows,
+                                   std::size_t             rowOffset,
+                                   std::size_t             colOffset,
+                                   std::span< const TYPE > a,
+                                   std::size_t             cols)
+        {
+            for (std::size_t j = 0; j < cols; ++j)
+                std::copy(a.begin(), a.end(), matrix.begin() + static_cast< std::ptrdiff_t >((colOffset + j) * rows + rowOffset + j));
+        }
+
+        /**
+         * @brief Solves a linear least squares problem, given as an augmented matrix [A | b].
+         *
+         * @param matrix The augmented matrix, in column-major order; it is overwritten.
+         * @param rows The number of rows of the matrix.
+         * @return The solution x minimizing ||A x - b||.
+         */
+        template< typename TYPE >
+        inline std::vector< TYPE > solveLeastSquares(std::span< TYPE > matrix, std::size_t rows)
+        {
+            const std::size_t size = matrix.size() / rows - 1;
+            householderReduce(matrix, rows, size);
+
+            // ===== Back substitution on R x = (Q^H b).
+            std::vector< TYPE > result(size);
+            const TYPE*         rhs = matrix.data() + size * rows;
+            for (std::size_t i = size; i-- > 0;) {
+                TYPE sum = rhs[i];
+                for (std::size_t j = i + 1; j < size; ++j) sum -= matrix[j * rows + i] * result[j];
+                result[i] = sum / matrix[i * rows + i];
+            }
+            return result;
+        }
+
+        /**
+         * @brief Finds the polynomial x minimizing ||a * x - b||.
+         */
+        template< typename TYPE >
+        inline std::vector< TYPE > convolutionLeastSquares(std::span< const TYPE > a, std::span< const TYPE > b)
+        {
+            const std::size_t   rows = b.size();
+            const std::size_t   size = b.size() - a.size() + 1;
+            std::vector< TYPE > matrix(rows * (size + 1));
+            addConvolution(std::span< TYPE >(matrix), rows, 0, 0, a, size);
+            std::copy(b.begin(), b.end(), matrix.begin() + static_cast< std::ptrdiff_t >(size * rows));
+            return solveLeastSquares(std::span< TYPE >(matrix), rows);
+        }
+
+        /**
+         * @brief Refines an approximate GCD d of two polynomials f and g, using Gauss-Newton iteration.
+         *
+         * The unknowns are the coefficients of d and of the cofactors u and v, and the equations are d*u = f,
+         * d*v = g and r^H d = 1, where r fixes the scaling of d (Zeng, 2005). The iteration converges
+         * quadratically if d is close to a GCD of polynomials near f and g.
+         *
+         * @param f The coefficients of the first polynomial.
+         * @param g The coefficients of the second polynomial.
+         * @param gcd On entry, the approximate GCD; on return, the refined, monic GCD.
+         * @return The residual max(||d*u - f||, ||d*v - g||), in the max-norm.
+         */
+        template< typename TYPE >
+        inline auto refineGcd(std::span< const TYPE > f, std::span< const TYPE > g, std::vector< TYPE >& gcd)
+        {
+            using FLOAT_T = decltype(std::abs(TYPE {}));
+            using SPAN_T  = std::span< const TYPE >;
+
+            auto u = convolutionLeastSquares(SPAN_T(gcd), f);
+            auto v = convolutionLeastSquares(SPAN_T(gcd), g);
+
+            FLOAT_T gcdNorm2 = 0;
+            for (const auto& coeff : gcd) gcdNorm2 += std::norm(coeff);
+            std::vector< TYPE > scaling(gcd.size());
+            for (std::size_t i = 0; i < gcd.size(); ++i) scaling[i] = conjugate(gcd[i]) / gcdNorm2;
+
+            const std::size_t   rows = f.size() + g.size() + 1;
+            const std::size_t   cols = gcd.size() + u.size() + v.size();
+            std::vector< TYPE > jacobian(rows * (cols + 1));
+            std::vector< TYPE > product(std::max(f.size(), g.size()));
+            TYPE*               residual = jacobian.data() + cols * rows;
+
+            // ===== The residual, which is also the right-hand side of the Gauss-Newton step.
+            const auto computeResidual = [&] {
+                multiply(SPAN_T(gcd), SPAN_T(u), std::span< TYPE >(product).first(f.size()));
+                for (std::size_t i = 0; i < f.size(); ++i) residual[i] = product[i] - f[i];
+                multiply(SPAN_T(gcd), SPAN_T(v), std::span< TYPE >(product).first(g.size()));
+                for (std::size_t i = 0; i < g.size(); ++i) residual[f.size() + i] = product[i] - g[i];
+                residual[rows - 1] = TYPE { -1 };
+                for (std::size_t i = 0; i < gcd.size(); ++i) residual[rows - 1] += scaling[i] * gcd[i];
+                return maxNorm(SPAN_T(residual, rows - 1));
+            };
+
+            for (int step = 0; step < GCD_REFINEMENT_STEPS; ++step) {
+                std::fill(jacobian.begin(), jacobian.end() - static_cast< std::ptrdiff_t >(rows), TYPE {});
+                const auto matrix = std::span< TYPE >(jacobian);
+                addConvolution(matrix, rows, 0, 0, SPAN_T(u), gcd.size());
+                addConvolution(matrix, rows, 0, gcd.size(), SPAN_T(gcd), u.size());
+                addConvolution(matrix, rows, f.size(), 0, SPAN_T(v), gcd.size());
+                addConvolution(matrix, rows, f.size(), gcd.size() + u.size(), SPAN_T(gcd), v.size());
+                for (std::size_t i = 0; i < gcd.size(); ++i) jacobian[i * rows + rows - 1] = scaling[i];
+                computeResidual();
+
+                const auto correction = solveLeastSquares(matrix, rows);
+                if (!std::all_of(correction.begin(), correction.end(), [](const TYPE& c) { return isFinite(c); })) break;
+                for (std::size_t i = 0; i < gcd.size(); ++i) gcd[i] -= correction[i];
+                for (std::size_t i = 0; i < u.size(); ++i) u[i] -= correction[gcd.size() + i];
+                for (std::size_t i = 0; i < v.size(); ++i) v[i] -= correction[gcd.size() + u.size() + i];
+                if (maxNorm(SPAN_T(correction)) <= 4 * std::numeric_limits< FLOAT_T >::epsilon() * maxNorm(SPAN_T(gcd))) break;
+            }
+
+            const FLOAT_T result = computeResidual();
+            makeMonic(gcd);
+            return result;
+        }
+
+        /**
+         * @brief Computes the cofactor of f for a common divisor of order k of two polynomials f and g, using
+         * the Sylvester subresultant S_k.
+         *
+         * The columns of S_k are the coefficients of x^i * f for i <= n - k, and of x^j * g for j <= m - k, where
+         * m >= n are the orders of f and g. If f = d * u and g = d * v with d of order k, then f * v - g * u = 0,
+         * so S_k is singular, with (v, -u) spanning its null space. With rounded coefficients, the smallest
+         * singular value of S_k is small rather than zero; it and its right singular vector are computed by
+         * inverse iteration with the R factor of S_k.
+         *
+         * @param f The coefficients of the polynomial of higher order.
+         * @param g The coefficients of the other polynomial.
+         * @param order The order k of the common divisor; at least 1, and at most the order of g.
+         * @param cofactor On return, the coefficients of u, up to a scaling.
+         * @return The smallest singular value of S_k, relative to the Frobenius norm of S_k.
+         */
+        template< typename TYPE >
+        inline auto subresultantCofactor(std::span< const TYPE > f, std::span< const TYPE > g, std::size_t order, std::vector< TYPE >& cofactor)
+        {
+            using FLOAT_T = decltype(std::abs(TYPE {}));
+            using std::sqrt;
+
+            const std::size_t   fcols = g.size() - order;
+            const std::size_t   cols  = fcols + f.size() - order;
+            const std::size_t   rows  = f.size() + g.size() - order - 1;
+            std::vector< TYPE > matrix(rows * cols);
+            addConvolution(std::span< TYPE >(matrix), rows, 0, 0, f, fcols);
+            addConvolution(std::span< TYPE >(matrix), rows, 0, fcols, g, cols - fcols);
+
+            FLOAT_T norm2 = 0;
+            for (const auto& entry : matrix) norm2 += std::norm(entry);
+            const FLOAT_T norm = sqrt(norm2);
+
+            // ===== A zero pivot means that S_k is singular to working precision; as usual for inverse
+            // ===== iteration, it is replaced by a pivot at the rounding level.
+            householderReduce(std::span< TYPE >(matrix), rows, cols);
+            for (std::size_t i = 0; i < cols; ++i)
+                if (matrix[i * rows + i] == TYPE {}) matrix[i * rows + i] = TYPE(std::numeric_limits< FLOAT_T >::epsilon() * norm);
+
+            // ===== Each step solves R^H y = x and R x = y, and normalizes x.
+            std::vector< TYPE > x(cols);
+            std::vector< TYPE > y(cols);
+            for (std::size_t i = 0; i < cols; ++i) x[i] = TYPE(1) / static_cast< FLOAT_T >(i + 1);
+            for (int step = 0; step < GCD_INVERSE_ITERATIONS; ++step) {
+                for (std::size_t i = 0; i < cols; ++i) {
+                    TYPE sum = x[i];
+                    for (std::size_t j = 0; j < i; ++j) sum -= conjugate(matrix[i * rows + j]) * y[j];
+                    y[i] = sum / conjugate(matrix[i * rows + i]);
+                }
+                for (std::size_t i = cols; i-- > 0;) {
+                    TYPE sum = y[i];
+                    for (std::size_t j = i + 1; j < cols; ++j) sum -= matrix[j * rows + i] * x[j];
+                    x[i] = sum / matrix[i * rows + i];
+                }
+
+                FLOAT_T xnorm2 = 0;
+                for (const auto& value : x) xnorm2 += std::norm(value);
+                const FLOAT_T xnorm = sqrt(xnorm2);
+                for (auto& value : x) value /= xnorm;
+            }
+
+            // ===== The singular value is ||R x||.
+            FLOAT_T sigma2 = 0;
+            for (std::size_t i = 0; i < cols; ++i) {
+                TYPE sum {};
+                for (std::size_t j = i; j < cols; ++j) sum += matrix[j * rows + i] * x[j];
+                sigma2 += std::norm(sum);
+            }
+
+            cofactor.assign(x.begin() + static_cast< std::ptrdiff_t >(fcols), x.end());
+            return sqrt(sigma2) / norm;
+        }
+
+        /**
+         * @brief Computes an approximate greatest common divisor of two polynomials, using the Sylvester
+         * subresultants and Gauss-Newton refinement.
+         *
+         * Two polynomials f and g of orders m >= n have a common divisor of order k exactly if the subresultant
+         * S_k (see subresultantCofactor()) is singular, so the order of the GCD is the largest k for which S_k
+         * is singular to within the tolerance. As the smallest singular value of S_k only grows with k, the
+         * order is found by bisection. The null vector of S_k gives the cofactor u = f / gcd, from which the
+         * GCD is computed by least squares and refined by refineGcd() (Zeng, 2005). Unlike the Euclidean
+         * algorithm, whose remainders lose accuracy with every division, this finds the GCD of polynomials
+         * with clustered multiple roots to the accuracy permitted by its conditioning.
+         *
+         * The estimated order is accepted if f and g are within the tolerance of multiples of the refined GCD;
+         * otherwise, up to GCD_MAX_CANDIDATES lower orders are tried. The cost is O((m + n)^3 log n).
+         *
+         * @param lhs The coefficients of the first polynomial.
+         * @param rhs The coefficients of the second polynomial.
+         * @param tolerance The relative distance from f and g, within which a common divisor is accepted. It is
+         * raised to the rounding level of the computations if it is smaller.
+         * @return The coefficients of the monic GCD, or zero if both polynomials are zero.
+         */
+        template< typename TYPE, typename FLOAT_T >
+        inline std::vector< TYPE > approximateGcd(std::span< const TYPE > lhs, std::span< const TYPE > rhs, FLOAT_T tolerance)
+        {
+            using SPAN_T = std::span< const TYPE >;
+
+            const auto normalize = [tolerance](SPAN_T coeffs) {
+                std::vector< TYPE > result(coeffs.begin(), coeffs.end());
+                const FLOAT_T       norm = maxNorm(coeffs);
+                if (norm > 0)
+                    for (auto& coeff : result) coeff /= norm;
+                trimCoefficients(result, tolerance);
+                return result;
+            };
+
+            auto f = normalize(lhs);
+            auto g = normalize(rhs);
+            if (f.size() < g.size()) std::swap(f, g);
+            if (maxNorm(SPAN_T(g)) <= tolerance) {
+                makeMonic(f);
+                return f;
+            }
+            if (g.size() == 1) return { TYPE { 1 } };
+
+            // ===== The largest order k <= n for which S_k is singular, where order 0 stands for coprime polynomials.
+            const FLOAT_T       threshold = std::max(tolerance, static_cast< FLOAT_T >(f.size() + g.size()) * std::numeric_limits< FLOAT_T >::epsilon());
+            std::vector< TYPE > cofactor;
+            std::size_t         lower = 0;
+            std::size_t         upper = g.size() - 1;
+            while (lower < upper) {
+                const std::size_t order = (lower + upper + 1) / 2;
+                if (subresultantCofactor(SPAN_T(f), SPAN_T(g), order, cofactor) <= threshold)
+                    lower = order;
+                else
+                    upper = order - 1;
+            }
+
+            for (std::size_t order = lower; order > 0 && lower - order < GCD_MAX_CANDIDATES; --order) {
+                subresultantCofactor(SPAN_T(f), SPAN_T(g), order, cofactor);
+                auto gcd = convolutionLeastSquares(SPAN_T(cofactor), SPAN_T(f));
+                if (refineGcd(SPAN_T(f), SPAN_T(g), gcd) <= threshold) return gcd;
+            }
+            return { TYPE { 1 } };
+        }
+
+        /**
+         * @brief Computes the square-free factors of a monic polynomial, using Yun's algorithm with approximate GCDs.
+         *
+         * With f monic, a_0 = gcd(f, f'), b_1 = f / a_0, and d_1 = f' / a_0 - b_1', the factor of multiplicity i
+         * is a_i = gcd(b_i, d_i), followed by b_(i+1) = b_i / a_i and d_(i+1) = d_i / a_i - b_(i+1)', until b_i is
+         * constant. All GCDs are computed by approximateGcd().
+         *
+         * @param poly The coefficients of the monic polynomial, of order at least 1.
+         * @param deriv The coefficients of its derivative.
+         * @param tolerance The relative tolerance for the GCDs, and for d_i to be taken as zero.
+         * @return The monic factors, where element i has multiplicity i + 1 (constant 1 if there is no such
+         * factor), or std::nullopt if a factor is left over, as a GCD was misjudged.
+         */
+        template< typename TYPE, typename FLOAT_T >
+        inline std::optional< std::vector< std::vector< TYPE > > > yunFactors(std::span< const TYPE > poly, std::span< const TYPE > deriv, FLOAT_T tolerance)
+        {
+            // ===== a_0 = gcd(f, f'); a square-free polynomial is its own (only) factor.
+            std::vector< std::vector< TYPE > > factors;
+            auto                               gcd = approximateGcd(poly, deriv, tolerance);
+            if (gcd.size() == 1) {
+                factors.emplace_back(poly.begin(), poly.end());
+                return factors;
+            }
+
+            auto b = exactQuotient(poly, std::span< const TYPE >(gcd));
+            auto c = exactQuotient(deriv, std::span< const TYPE >(gcd));
+
+            // ===== No multiplicity exceeds the order; a factor left over means that a GCD was misjudged.
+            while (b.size() > 1 && factors.size() < poly.size() - 1) {
+                // ===== d_i = c_i - b_i', which is zero (to within rounding) once only the last factor remains.
+                const auto          bderiv = differentiate(std::span< const TYPE >(b));
+                std::vector< TYPE > d(std::max(c.size(), bderiv.size()));
+                for (std::size_t k = 0; k < c.size(); ++k) d[k] += c[k];
+                for (std::size_t k = 0; k < bderiv.size(); ++k) d[k] -= bderiv[k];
+                const FLOAT_T threshold = tolerance * std::max(maxNorm(std::span< const TYPE >(c)), maxNorm(std::span< const TYPE >(bderiv)));
+                trimCoefficients(d, threshold);
+                if (maxNorm(std::span< const TYPE >(d)) <= threshold) d = { TYPE {} };
+
+                gcd = approximateGcd(std::span< const TYPE >(b), std::span< const TYPE >(d), tolerance);
+                b   = exactQuotient(std::span< const TYPE >(b), std::span< const TYPE >(gcd));
+                c   = exactQuotient(std::span< const TYPE >(d), std::span< const TYPE >(gcd));
+                factors.push_back(std::move(gcd));
+            }
+
+            if (b.size() > 1) return std::nullopt;
+            return factors;
+        }
+
+        /**
+         * @brief Computes the square-free factors of a polynomial, and verifies them by multiplying them back
+         * together.
+         *
+         * The factors are computed by yunFactors(). The GCDs of polynomials with multiple roots are badly
+         * conditioned, so the quotients in Yun's algorithm may be much less accurate than the tolerance, and
+         * the last d_i is not recognized as zero, or a common factor is missed. If the factors can not be
+         * verified, they are therefore computed again with a looser tolerance, raised geometrically to the
+         * square root of the given tolerance in SQUAREFREE_RETRIES steps.
+         *
+         * @param coeffs The coefficients of the polynomial. The order must be at least 1, and the leading
+         * coefficient must be non-zero.
+         * @param tolerance The relative tolerance for the GCDs. The verification allows a relative error of its
+         * square root, as the coefficients of the factors are only that accurate for ill-conditioned GCDs.
+         * @return The monic factors, where element i has multiplicity i + 1 (constant 1 if there is no such
+         * factor), or std::nullopt if the factorization could not be verified.
+         */
+        template< typename TYPE, typename FLOAT_T >
+        inline std::optional< std::vector< std::vector< TYPE > > > squareFreeFactors(std::span< const TYPE > coeffs, FLOAT_T tolerance)
+        {
+            using std::pow;
+            using std::sqrt;
+
+            std::vector< TYPE > poly(coeffs.begin(), coeffs.end());
+            makeMonic(poly);
+            const auto deriv = differentiate(std::span< const TYPE >(poly));
+
+            // ===== Verify that the product of the factors, raised to their multiplicities, is the polynomial.
+            const auto verify = [&](const std::vector< std::vector< TYPE > >& factors) {
+                std::vector< TYPE > product { TYPE { 1 } };
+                std::vector< TYPE > buffer;
+                for (std::size_t i = 0; i < factors.size(); ++i)
+                    for (std::size_t m = 0; m <= i && factors[i].size() > 1; ++m) {
+                        buffer.resize(product.size() + factors[i].size() - 1);
+                        multiply(std::span< const TYPE >(product), std::span< const TYPE >(factors[i]), std::span< TYPE >(buffer));
+                        std::swap(product, buffer);
+                    }
+                if (product.size() != poly.size()) return false;
+                for (std::size_t k = 0; k < poly.size(); ++k) product[k] -= poly[k];
+                if (!std::all_of(product.begin(), product.end(), [](const TYPE& coeff) { return isFinite(coeff); })) return false;
+                return maxNorm(std::span< const TYPE >(product)) <= sqrt(tolerance) * maxNorm(std::span< const TYPE >(poly));
+            };
+
+            const FLOAT_T growth       = pow(tolerance, FLOAT_T(-1) / (2 * SQUAREFREE_RETRIES));
+            FLOAT_T       gcdTolerance = tolerance;
+            for (int attempt = 0; attempt <= SQUAREFREE_RETRIES; ++attempt, gcdTolerance *= growth) {
+                auto factors = yunFactors(std::span< const TYPE >(poly), std::span< const TYPE >(deriv), gcdTolerance);
+                if (factors && verify(*factors)) return factors;
+            }
+            return std::nullopt;
+        }
+    }    // namespace detail
+
+    /**
+     * @brief Computes the approximate greatest common divisor of two polynomials.
+     *
+     * The GCD is the common divisor of highest order of two polynomials within the tolerance of the given
+     * ones. Its order is found from the smallest singular values of the Sylvester subresultants, and the GCD
+     * is refined by Gauss-Newton iteration. For polynomials with rounded coefficients, this finds the common
+     * factor that the exact GCD would miss. The cost is O((m + n)^3 log n) for polynomials of orders m and n.
+     *
+     * @param lhs The first polynomial, which should satisfy the poly::IsPolynomial concept.
+     * @param rhs The second polynomial, which should satisfy the poly::IsPolynomial concept.
+     * @param tolerance The relative distance from the polynomials within which a common divisor is accepted.
+     * Defaults to nxx::EPS.
+     *
+     * @return The monic GCD of the two polynomials, with the common coefficient type of the operands.
+     *
+     * @throws NumerixxError if the tolerance is not positive.
+     */
+    template< typename POLY1, typename POLY2 >
+    requires IsPolynomial< POLY1 > && IsPolynomial< POLY2 >
+    inline auto polygcd(const POLY1&                                         lhs,
+                        const POLY2&                                         rhs,
+                        typename PolynomialTraits< POLY1 >::fundamental_type tolerance = nxx::EPS)
+    {
+        impl::validateTolerance(tolerance);
+
+        using TYPE = std::common_type_t< typename PolynomialTraits< POLY1 >::value_type, typename PolynomialTraits< POLY2 >::value_type >;
+        const std::vector< TYPE > a(lhs.begin(), lhs.end());
+        const std::vector< TYPE > b(rhs.begin(), rhs.end());
+        return Polynomial< TYPE >(detail::approximateGcd(std::span< const TYPE >(a), std::span< const TYPE >(b), tolerance));
+    }
+
+    /**
+     * @brief A factor of a square-free decomposition, and its multiplicity.
+     */
+    template< typename T >
+    struct SquareFreeFactor
+    {
+        Polynomial< T > factor;       /**< The monic, square-free factor. */
+        std::size_t     multiplicity; /**< The multiplicity of the roots of the factor. */
+    };
+
+    /**
+     * @brief Computes the square-free decomposition of a polynomial.
+     *
+     * The polynomial is written as p = c * f_1 * f_2^2 * ... * f_k^k, where c is the leading coefficient,
+     * and the monic factors f_i are square-free and pairwise coprime, so the roots of f_i are exactly the
+     * roots of p with multiplicity i. The factors are computed using Yun's algorithm, with approximate GCDs
+     * (see polygcd()), and the decomposition is verified by multiplying the factors back together.
+     *
+     * @param poly A polynomial, which should satisfy the poly::IsPolynomial concept.
+     * @param tolerance The relative tolerance for the GCDs. Defaults to nxx::EPS.
+     *
+     * @return A tl::expected holding the non-constant factors f_i with their multiplicities i, in increasing
+     * order of multiplicity, or a NumerixxError if the decomposition could not be verified, even with the
+     * looser tolerances tried by detail::squareFreeFactors(). A constant polynomial has no factors.
+     *
+     * @throws NumerixxError if the tolerance is not positive.
+     *
+     * @note The tolerance decides what counts as a multiple root: roots closer together than roughly the
+     * square root of the tolerance (relative to the size of the roots) are merged into a multiple root.
+     */
+    template< typename POLY >
+    requires IsPolynomial< POLY >
+    inline auto squarefree(const POLY& poly, typename PolynomialTraits< POLY >::fundamental_type tolerance = nxx::EPS)
+    {
+        impl::validateTolerance(tolerance);
+
+        using VALUE_T    = typename PolynomialTraits< POLY >::value_type;
+        using EXPECTED_T = tl::expected< std::vector< SquareFreeFactor< VALUE_T > >, NumerixxError >;
+        std::vector< SquareFreeFactor< VALUE_T > > result;
+
+        // The leading coefficient must be non-zero.
+        std::vector< VALUE_T > coeffs(poly.begin(), poly.end());
+        while (coeffs.size() > 1 && coeffs.back() == VALUE_T {}) coeffs.pop_back();
+        if (coeffs.size() == 1) return EXPECTED_T(std::move(result));
+
+        auto factors = detail::squareFreeFactors(std::span< const VALUE_T >(coeffs), tolerance);
+        if (!factors) [[unlikely]]
+            return EXPECTED_T(tl::unexpected(NumerixxError("The square-free decomposition could not be verified; the multiple roots are too badly conditioned for the tolerance.")));
+
+        for (std::size_t i = 0; i < factors->size(); ++i)
+            if ((*factors)[i].size() > 1) result.push_back({ Polynomial< VALUE_T >(std::move((*factors)[i])), i + 1 });
+        return EXPECTED_T(std::move(result));
+    }
+
+    /**
+     * @brief Root finding strategy for polysolve, solving each factor of the square-free decomposition separately.
+     *
+     * At a root of multiplicity m, Laguerre's and Newton's methods converge only linearly, and the root is
+     * only determined to about the m-th root of the machine precision. The polynomial is therefore first
+     * decomposed into square-free factors (see squarefree()), whose roots are all simple, and each factor is
+     * solved using the SOLVER strategy. The roots are repeated by multiplicity, so the result can be used in
+     * place of that of SOLVER. When the decomposition can not be verified, the polynomial is solved as is.
+     *
+     * @tparam SOLVER The root finding strategy for the square-free factors.
+     */
+    template< IsPolySolver SOLVER = AutoSolver<> >
+    struct SquareFreeSolver
+    {
+        static constexpr bool IsPolySolver = true;
+
+        SOLVER solver {}; /**< The solver for the square-free factors. */
+
+        template< typename FLOAT_T >
+        auto solve(const Polynomial< std::complex< FLOAT_T > >& original, FLOAT_T tolerance, int max_iterations)
+            -> tl::expected< std::vector< std::complex< FLOAT_T > >, NumerixxError >
+        {
+            using COMPLEX_T        = std::complex< FLOAT_T >;
+            const auto solveFactor = [&](const Polynomial< COMPLEX_T >& factor) { return solver.solve(factor, tolerance, max_iterations); };
+
+            // Real coefficients (as passed on by polysolve) are decomposed in real arithmetic, which is four times cheaper.
+            if (std::all_of(original.begin(), original.end(), [](const COMPLEX_T& coeff) { return coeff.imag() == 0; })) {
+                std::vector< FLOAT_T > coeffs(original.order() + 1);
+                std::transform(original.begin(), original.end(), coeffs.begin(), [](const COMPLEX_T& coeff) { return coeff.real(); });
+                const auto factors = squarefree(Polynomial< FLOAT_T >(std::move(coeffs)), tolerance);
+                if (!factors) [[unlikely]]
+                    return solveFactor(original);
+                return solveFactors(*factors, [&](const auto& factor) {
+                    return solveFactor(Polynomial< COMPLEX_T >(std::vector< COMPLEX_T >(factor.begin(), factor.end())));
+                });
+            }
+
+            const auto factors = squarefree(original, tolerance);
+            if (!factors) [[unlikely]]
+                return solveFactor(original);
+            return solveFactors(*factors, solveFactor);
+        }
+
+        template< typename FLOAT_T >
+        requires requires(SOLVER& s, const Polynomial< FLOAT_T >& p, FLOAT_T t, int n) { s.solveReal(p, t, n); }
+        auto solveReal(const Polynomial< FLOAT_T >& original, FLOAT_T tolerance, int max_iterations)
+            -> tl::expected< std::vector< FLOAT_T >, NumerixxError >
+        {
+            const auto solveFactor = [&](const Polynomial< FLOAT_T >& factor) { return solver.solveReal(factor, tolerance, max_iterations); };
+
+            const auto factors = squarefree(original, tolerance);
+            auto       roots   = factors ? solveFactors(*factors, solveFactor) : solveFactor(original);
+            if (roots) std::sort(roots->begin(), roots->end());
+            return roots;
+        }
+
+    private:
+        /**
+         * @brief Solves each factor using the given function, and repeats its roots by multiplicity.
+         */
+        template< typename FACTORS, typename FUNC >
+        static auto solveFactors(const FACTORS& factors, FUNC&& func) -> decltype(func(factors.front().factor))
+        {
+            using EXPECTED_T = decltype(func(factors.front().factor));
+
+            typename EXPECTED_T::value_type roots;
+            for (const auto& [factor, multiplicity] : factors) {
+                const auto factorRoots = func(factor);
+                if (!factorRoots) [[unlikely]]
+                    return EXPECTED_T(tl::unexpected(factorRoots.error()));
+                for (const auto& root : *factorRoots) roots.insert(roots.end(), multiplicity, root);
+            }
+            return EXPECTED_T(std::move(roots));
+        }
+    };
+
+    /**
+     * @brief A root of a polynomial, and its multiplicity.
+     */
+    template< typename T >
+    struct MultipleRoot
+    {
+        T           root;         /**< The root. */
+        std::size_t multiplicity; /**< The multiplicity of the root. */
+    };
+
+    /**
+     * @brief Solves a polynomial equation, returning each distinct root once, with its multiplicity.
+     *
+     * The polynomial is decomposed into square-free factors (see squarefree()), and the roots of the factor
+     * of multiplicity m are found by polysolve with the given solver; they are all simple, so the solver
+     * converges quickly and accurately. The roots are returned in the same order as by polysolve.
+     *
+     * @tparam RT The desired type of the roots; see polysolve().
+     * @tparam SOLVER The root finding strategy for the square-free factors.
+     * @param poly A polynomial, which should satisfy the IsPolynomial concept.
+     * @param solver The solver object.
+     * @param tolerance The tolerance for the decomposition and the convergence tolerance. Defaults to nxx::EPS.
+     * @param max_iterations The maximum number of iterations. Defaults to nxx::MAXITER.
+     *
+     * @return A tl::expected holding the distinct roots with their multiplicities, or a NumerixxError if the
+     * square-free decomposition could not be verified, or solving a factor failed.
+     *
+     * @note As for squarefree(), roots closer together than roughly the square root of the tolerance are
+     * reported as a single multiple root.
+     */
+    template< typename RT = void, IsPolySolver SOLVER >
+    inline auto squarefreesolve(IsPolynomial auto                                             poly,
+                                SOLVER&                                                       solver,
+                                typename PolynomialTraits< decltype(poly) >::fundamental_type tolerance      = nxx::EPS,
+                                int                                                           max_iterations = nxx::MAXITER)
+    {
+        impl::validateTolerance(tolerance);
+        impl::validateMaxIterations(max_iterations);
+        impl::validatePolynomialOrder(poly.order(), 1ull);
+
+        using VALUE_T    = typename PolynomialTraits< decltype(poly) >::value_type;
+        using RETURN_T   = std::conditional_t< std::same_as< RT, void >, VALUE_T, RT >;
+        using EXPECTED_T = tl::expected< std::vector< MultipleRoot< RETURN_T > >, NumerixxError >;
+
+        const auto factors = squarefree(poly, tolerance);
+        if (!factors) [[unlikely]]
+            return EXPECTED_T(tl::unexpected(factors.error()));
+
+        std::vector< MultipleRoot< RETURN_T > > result;
+        for (const auto& [factor, multiplicity] : *factors) {
+            const auto roots = polysolve< RETURN_T >(factor, solver, tolerance, max_iterations);
+            if (!roots) [[unlikely]]
+                return EXPECTED_T(tl::unexpected(roots.error()));
+            for (const auto& root : *roots) result.push_back({ root, multiplicity });
+        }
+
+        // Merge the roots of the factors, in the order used by polysolve.
+        if constexpr (IsComplex< RETURN_T >) {
+            const auto toleranceSqrt = std::sqrt(tolerance);
+            std::sort(result.begin(), result.end(), [toleranceSqrt](const auto& lhs, const auto& rhs) {
+                return std::abs(rhs.root.real() - lhs.root.real()) < toleranceSqrt ? lhs.root.imag() < rhs.root.imag()
+                                                                                    : lhs.root.real() < rhs.root.real();
+            });
+        }
+        else
+            std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) { return lhs.root < rhs.root; });
+
+        return EXPECTED_T(std::move(result));
+    }
+
+    /**
+     * @brief Solves a polynomial equation with multiplicities, using a default constructed solver of type SOLVER.
+     *
+     * See the overload taking a solver object for details.
+     */
+    template< typename RT = void, IsPolySolver SOLVER = AutoSolver<> >
+    inline auto squarefreesolve(IsPolynomial auto                                             poly,
+                                typename PolynomialTraits< decltype(poly) >::fundamental_type tolerance      = nxx::EPS,
+                                int                                                           max_iterations = nxx::MAXITER)
+    {
+        auto solver = SOLVER {};
+        return squarefreesolve< RT >(std::move(poly), solver, tolerance, max_iterations);
+    }
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYSQUAREFREE_HPP
@@ -0,0 +1,619 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_POLYSUBPRODUCTTREE_HPP
+#define NUMERIXX_POLYSUBPRODUCTTREE_HPP
+
+// ===== Numerixx Includes
+#include "PolyDivision.hpp"
+#include "PolyEvaluation.hpp"
+#include "PolyMultiplication.hpp"
+#include "Polynomial.hpp"
+#include <Concepts.hpp>
+#include <Error.hpp>
+
+// ===== External Includes
+#include <tl/expected.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace nxx::poly
+{
+    namespace detail
+    {
+        /**
+         * @brief The number of points in each leaf of a SubproductTree.
+         *
+         * The leaves are built with productOfLinearFactors(), and polynomials are evaluated at the points of a
+         * leaf with Horner's method, which is faster than descending further for small nodes.
+         */
+        inline constexpr std::size_t SUBPRODUCT_LEAF_SIZE = 32;
+
+        /**
+         * @brief The number of points per node from which a SubproductTree stores the inverses of the reversed
+         * nodes, so that the remainders are computed with two multiplications rather than by long division.
+         *
+         * @note Computing the inverses costs more than building the tree itself, and only pays off once the
+         * multiplications run on the FFT kernel. The threshold was determined with benchPolynomial
+         * (BM_MultipointEvaluateTree).
+         */
+        inline constexpr std::size_t SUBPRODUCT_INVERSE_THRESHOLD = 512;
+
+        /**
+         * @brief The order and the number of points from which multipointEvaluate() uses a SubproductTree,
+         * for complex points near the unit circle.
+         *
+         * @note The batched Horner evaluation vectorises very well, so the crossover is high, and it includes
+         * building the tree. The threshold was determined with benchPolynomial (BM_MultipointEvaluate*).
+         */
+        inline constexpr std::size_t MULTIPOINT_EVALUATION_THRESHOLD = 8192;
+
+        /**
+         * @brief The number of points from which interpolatePolynomial() uses a SubproductTree, for complex
+         * points near the unit circle.
+         *
+         * @note The threshold was determined with benchPolynomial (BM_Interpolate*).
+         */
+        inline constexpr std::size_t INTERPOLATION_THRESHOLD = 2048;
+
+        /**
+         * @brief The number of points at which a result computed with a SubproductTree is checked against
+         * Horner's method (see agreesWithHorner()).
+         *
+         * @note The check costs this many evaluations of the polynomial, which is small next to the tree
+         * above the thresholds.
+         */
+        inline constexpr std::size_t SUBPRODUCT_VERIFICATION_SAMPLES = 64;
+
+        /**
+         * @brief Computes the remainder of the division of a by b.
+         *
+         * @param a The coefficients of the dividend.
+         * @param b The coefficients of the divisor. The leading coefficient must be non-zero.
+         * @param out The destination for the remainder; must hold b.size() - 1 elements.
+         */
+        template< typename TYPE >
+        inline void reduceModulo(std::span< const TYPE > a, std::span< const TYPE > b, std::span< TYPE > out)
+        {
+            const std::size_t m = b.size() - 1;
+            if (a.size() <= m) {
+                std::copy(a.begin(), a.end(), out.begin());
+                std::fill(out.begin() + static_cast< std::ptrdiff_t >(a.size()), out.end(), TYPE {});
+                return;
+            }
+
+            std::vector< TYPE > quotient(a.size() - m);
+            if (std::min(m, quotient.size()) >= NEWTON_DIVISION_THRESHOLD) {
+                divideNewton(a, b, std::span< TYPE >(quotient), out);
+                return;
+            }
+
+            std::vector< TYPE > remainder(a.begin(), a.end());
+            divideSchoolbook(std::span< TYPE >(remainder), b, std::span< TYPE >(quotient));
+            std::copy(remainder.begin(), remainder.begin() + static_cast< std::ptrdiff_t >(m), out.begin());
+        }
+
+        /**
+         * @brief Computes the remainder of the division of a by b, given the inverse of the reversed divisor.
+         *
+         * As in divideNewton(), the reversed quotient is rev(a) * rev(b)^-1 mod x^(n - m + 1); with the inverse
+         * computed in advance, the division costs two multiplications.
+         *
+         * @param a The coefficients of the dividend.
+         * @param b The coefficients of the divisor. The leading coefficient must be non-zero.
+         * @param inverse The power series inverse of the reversed divisor, with at least a.size() - b.size() + 1
+         * coefficients.
+         * @param out The destination for the remainder; must hold b.size() - 1 elements.
+         */
+        template< typename TYPE >
+        inline void reduceModulo(std::span< const TYPE > a, std::span< const TYPE > b, std::span< const TYPE > inverse, std::span< TYPE > out)
+        {
+            const std::size_t m = b.size() - 1;
+            if (a.size() <= m) {
+                std::copy(a.begin(), a.end(), out.begin());
+                std::fill(out.begin() + static_cast< std::ptrdiff_t >(a.size()), out.end(), TYPE {});
+                return;
+            }
+
+            const std::size_t   qlen = a.size() - m;
+            std::vector< TYPE > reversed(a.rbegin(), a.rbegin() + static_cast< std::ptrdiff_t >(qlen));
+            std::vector< TYPE > product(std::max(2 * qlen - 1, a.size()));
+            multiply(std::span< const TYPE >(reversed), inverse.first(qlen), std::span< TYPE >(product).first(2 * qlen - 1));
+            std::reverse_copy(product.begin(), product.begin() + static_cast< std::ptrdiff_t >(qlen), reversed.begin());
+
+            multiply(b, std::span< const TYPE >(reversed), std::span< TYPE >(product).first(a.size()));
+            for (std::size_t i = 0; i < m; ++i) out[i] = a[i] - product[i];
+        }
+
+        /**
+         * @brief Computes the interpolating polynomial with Newton's divided differences, at a cost of O(n^2).
+         *
+         * @param points The abscissae. Must be distinct.
+         * @param values The values at the abscissae; must have the same size as the points.
+         * @param out The destination for the coefficients; must have the same size as the points.
+         *
+         * @throws NumerixxError if the points are not distinct.
+         */
+        template< typename TYPE >
+        inline void interpolateNewton(std::span< const TYPE > points, std::span< const TYPE > values, std::span< TYPE > out)
+        {
+            const std::size_t n = points.size();
+
+            // ===== The divided differences, computed in place.
+            std::vector< TYPE > diffs(values.begin(), values.end());
+            for (std::size_t k = 1; k < n; ++k) {
+                for (std::size_t i = n - 1; i >= k; --i) {
+                    const TYPE denom = points[i] - points[i - k];
+                    if (denom == TYPE {}) throw NumerixxError("Interpolation requires distinct points.");
+                    diffs[i] = (diffs[i] - diffs[i - 1]) / denom;
+                }
+            }
+
+            // ===== Horner's scheme on the Newton form: p = d_{n-1}, then p = p * (x - x_k) + d_k.
+            out[0] = diffs[n - 1];
+            for (std::size_t k = n - 1; k-- > 0;) {
+                const std::size_t deg = n - 2 - k;    // The degree of p before the multiplication.
+                out[deg + 1]          = out[deg];
+                for (std::size_t j = deg; j > 0; --j) out[j] = out[j - 1] - points[k] * out[j];
+                out[0] = diffs[k] - points[k] * out[0];
+            }
+        }
+
+        /**
+         * @brief Checks whether all the points lie within 1/n of the unit circle, where n is the number of points.
+         *
+         * The nodes of a SubproductTree have coefficients of the order of the product of the moduli of their
+         * points, so for points off the unit circle, they over- or underflow long before n reaches the
+         * thresholds. Within 1/n of the unit circle, the products stay within a factor of e of one.
+         *
+         * @param points The points. Must not be empty.
+         * @return true if all the points are within 1/n of the unit circle.
+         */
+        template< typename TYPE >
+        inline bool isNearUnitCircle(std::span< const TYPE > points)
+        {
+            using FLOAT_T           = typename FundamentalType< TYPE >::type;
+            const FLOAT_T tolerance = FLOAT_T(1) / static_cast< FLOAT_T >(points.size());
+            return std::ranges::all_of(points, [&](const TYPE& x) { return std::abs(std::abs(x) - FLOAT_T(1)) <= tolerance; });
+        }
+
+        /**
+         * @brief Checks the values of a polynomial at a sample of the points against Horner's method.
+         *
+         * The accuracy of a SubproductTree depends on how the points are spread, and not only on their moduli
+         * (the n-th roots of unity are evaluated accurately when n is a power of two, but not for every n), so
+         * the results computed with the tree are checked before they are used. At SUBPRODUCT_VERIFICATION_SAMPLES
+         * points spread over the set, the values must be within sqrt(epsilon) times the sum of |c_k| |x|^k,
+         * which bounds the rounding errors of Horner's method.
+         *
+         * @param coeffs The coefficients of the polynomial, in increasing order of degree.
+         * @param points The points.
+         * @param values The values to check, one per point.
+         * @return true if the values agree at all the sampled points.
+         */
+        template< typename TYPE >
+        inline bool agreesWithHorner(std::span< const TYPE > coeffs, std::span< const TYPE > points, std::span< const TYPE > values)
+        {
+            using FLOAT_T            = typename FundamentalType< TYPE >::type;
+            const FLOAT_T     limit  = std::sqrt(std::numeric_limits< FLOAT_T >::epsilon());
+            const std::size_t stride = std::max< std::size_t >(1, points.size() / SUBPRODUCT_VERIFICATION_SAMPLES);
+
+            for (std::size_t i = 0; i < points.size(); i += stride) {
+                const FLOAT_T modulus = std::abs(points[i]);
+                TYPE          value {};
+                FLOAT_T       bound {};
+                for (auto coeff = coeffs.rbegin(); coeff != coeffs.rend(); ++coeff) {
+                    value = value * points[i] + *coeff;
+                    bound = bound * modulus + std::abs(*coeff);
+                }
+                if (!(std::abs(values[i] - value) <= limit * bound)) return false;
+            }
+            return true;
+        }
+
+    }    // namespace detail
+
+    /**
+     * @brief A subproduct tree over a set of points x_0, ..., x_{n-1}, for fast multipoint evaluation and interpolation.
+     *
+     * The leaves of the tree hold the products of (x - x_i) over blocks of SUBPRODUCT_LEAF_SIZE points, and
+     * each node above holds the product of its two children, so that the root holds the polynomial M(x)
+     * with all the points as roots. With the FFT based multiplication, the tree is built in O(n log^2 n).
+     *
+     * The products of linear factors with clustered roots have huge coefficients, which the remainders
+     * cannot be computed accurately from. The points are therefore sorted (by value, or by argument for
+     * complex points) and assigned to the leaves in bit-reversed order (see detail::interleavedOrder), so
+     * that each node holds points spread over the whole set. For the n-th roots of unity with n a power of two, the nodes are then
+     * of the form x^m - c, and the remainder tree is the FFT.
+     *
+     * - A polynomial p is evaluated at all the points by reducing it modulo the nodes, from the root down to
+     *   the leaves (the remainder tree), where the remainders are evaluated with Horner's method.
+     * - The polynomial interpolating values y_i at the points is computed as the sum of y_i / M'(x_i) times
+     *   M(x) / (x - x_i), which is formed from the leaves up.
+     *
+     * Both cost O(n log^2 n), against O(n^2) for the direct methods. The tree can be reused for any number
+     * of polynomials and value sets at the same points.
+     *
+     * @note Even with the interleaving, the nodes are badly conditioned unless the points lie close to the
+     * unit circle and are evenly spread over it, and for real points, the results over- or underflow to
+     * NaN long before the thresholds. multipointEvaluate() and interpolatePolynomial() therefore only use the
+     * tree for complex points near the unit circle, and check the results against the direct methods.
+     *
+     * @tparam T The type of the points. Must be a floating point type or a complex type.
+     */
+    template< typename T >
+        requires nxx::IsFloat< T > || IsComplex< T >
+    class SubproductTree final
+    {
+        std::vector< T >                m_points;      /**< The points, in the order of the leaves. */
+        std::vector< std::size_t >      m_permutation; /**< The position of each point of m_points in the given points. */
+        std::vector< std::vector< T > > m_levels;      /**< The nodes per level, from the leaves up. Node j of level k is stored at offset j * (width + 1), where width is the number of points per node. */
+        std::vector< std::vector< T > > m_inverses;    /**< The inverses of the reversed nodes, with width coefficients each, stored at offset j * width. Empty for levels below SUBPRODUCT_INVERSE_THRESHOLD and for the root. */
+
+        /**
+         * @brief Returns the number of points in the nodes of a level (except possibly the last node).
+         */
+        [[nodiscard]]
+        static std::size_t width(std::size_t level)
+        {
+            return detail::SUBPRODUCT_LEAF_SIZE << level;
+        }
+
+        /**
+         * @brief Returns the number of nodes in a level.
+         */
+        [[nodiscard]]
+        std::size_t nodeCount(std::size_t level) const
+        {
+            return (m_points.size() + width(level) - 1) / width(level);
+        }
+
+        /**
+         * @brief Returns the number of points in a node.
+         */
+        [[nodiscard]]
+        std::size_t pointCount(std::size_t level, std::size_t index) const
+        {
+            return std::min(width(level), m_points.size() - index * width(level));
+        }
+
+        /**
+         * @brief Returns the coefficients of a node.
+         */
+        [[nodiscard]]
+        std::span< const T > node(std::size_t level, std::size_t index) const
+        {
+            return std::span< const T >(m_levels[level]).subspan(index * (width(level) + 1), pointCount(level, index) + 1);
+        }
+
+    public:
+        /**
+         * @brief Builds the subproduct tree over a set of points.
+         *
+         * @param points The points. The same point may occur more than once, but interpolation requires
+         * distinct points.
+         *
+         * @throws NumerixxError if there are no points.
+         */
+        explicit SubproductTree(const IsCoefficientContainer auto& points)
+        {
+            const std::vector< T > given(std::begin(points), std::end(points));
+            if (given.empty()) throw NumerixxError("A subproduct tree requires at least one point.");
+
+            m_permutation = detail::interleavedOrder(std::span< const T >(given));
+            for (const auto index : m_permutation) m_points.push_back(given[index]);
+
+            // ===== The leaves are built directly from the points.
+            m_levels.emplace_back((width(0) + 1) * nodeCount(0));
+            for (std::size_t j = 0; j < nodeCount(0); ++j) {
+                const std::size_t count = pointCount(0, j);
+                detail::productOfLinearFactors(std::span< const T >(m_points).subspan(j * width(0), count),
+                                               std::span< T >(m_levels[0]).subspan(j * (width(0) + 1), count + 1));
+            }
+
+            // ===== Each node above is the product of its children; a single child is copied.
+            for (std::size_t level = 0; nodeCount(level) > 1; ++level) {
+                std::vector< T > next((width(level + 1) + 1) * nodeCount(level + 1));
+                for (std::size_t j = 0; j < nodeCount(level + 1); ++j) {
+                    const auto dest = std::span< T >(next).subspan(j * (width(level + 1) + 1), pointCount(level + 1, j) + 1);
+                    if (2 * j + 1 < nodeCount(level))
+                        detail::multiply(node(level, 2 * j), node(level, 2 * j + 1), dest);
+                    else
+                        std::ranges::copy(node(level, 2 * j), dest.begin());
+                }
+                m_levels.push_back(std::move(next));
+            }
+
+            // ===== The remainders modulo a node of level k have a quotient of at most width(k) coefficients.
+            m_inverses.resize(m_levels.size());
+            for (std::size_t level = 0; level + 1 < m_levels.size(); ++level) {
+                if (width(level) < detail::SUBPRODUCT_INVERSE_THRESHOLD) continue;
+                m_inverses[level].resize(width(level) * nodeCount(level));
+                for (std::size_t j = 0; j < nodeCount(level); ++j) {
+                    const auto       coeffs = node(level, j);
+                    std::vector< T > reversed(coeffs.rbegin(), coeffs.rend());
+                    detail::seriesInverse(std::span< const T >(reversed), std::span< T >(m_inverses[level]).subspan(j * width(level), width(level)));
+                }
+            }
+        }
+
+        /**
+         * @brief Returns the number of points.
+         */
+        [[nodiscard]]
+        std::size_t size() const
+        {
+            return m_points.size();
+        }
+
+        /**
+         * @brief Returns the monic polynomial with all the points as roots, i.e. the root of the tree.
+         */
+        [[nodiscard]]
+        Polynomial< T > product() const
+        {
+            const auto root = node(m_levels.size() - 1, 0);
+            return Polynomial< T >(std::vector< T >(root.begin(), root.end()));
+        }
+
+        /**
+         * @brief Evaluates a polynomial at all the points, using the remainder tree.
+         *
+         * @param coeffs The coefficients of the polynomial, in increasing order of degree. Must not be empty.
+         * @param out The destination for the values, in the order the points were given in; must have the same
+         * size as the points.
+         *
+         * @throws NumerixxError if the size of `out` differs from the number of points.
+         */
+        void evaluate(std::span< const T > coeffs, std::span< T > out) const
+        {
+            if (out.size() != m_points.size()) throw NumerixxError("The output range must have one element per point.");
+
+            // ===== The remainders of a level fit in n elements: the remainder for node j has
+            // ===== pointCount(level, j) coefficients, and is stored at offset j * width(level).
+            std::vector< T > current(m_points.size());
+            std::vector< T > next(m_points.size());
+            const std::size_t top = m_levels.size() - 1;
+            detail::reduceModulo(coeffs, node(top, 0), std::span< T >(current));
+
+            for (std::size_t level = top; level-- > 0;) {
+                for (std::size_t j = 0; j < nodeCount(level); ++j) {
+                    const auto parent = std::span< const T >(current).subspan((j / 2) * width(level + 1), pointCount(level + 1, j / 2));
+                    const auto dest   = std::span< T >(next).subspan(j * width(level), pointCount(level, j));
+                    if (m_inverses[level].empty())
+                        detail::reduceModulo(parent, node(level, j), dest);
+                    else
+                        detail::reduceModulo(parent, node(level, j), std::span< const T >(m_inverses[level]).subspan(j * width(level), width(level)), dest);
+                }
+                std::swap(current, next);
+            }
+
+            for (std::size_t j = 0; j < nodeCount(0); ++j) {
+                const std::size_t offset = j * width(0);
+                const std::size_t count  = pointCount(0, j);
+                detail::hornerBatch(std::span< const T >(current).subspan(offset, count),
+                                    std::span< const T >(m_points).subspan(offset, count),
+                                    std::span< T >(next).subspan(offset, count));
+            }
+            for (std::size_t i = 0; i < m_points.size(); ++i) out[m_permutation[i]] = next[i];
+        }
+
+        /**
+         * @brief Evaluates a polynomial at all the points, using the remainder tree.
+         *
+         * @param poly The polynomial to evaluate.
+         * @return A vector holding the values of the polynomial at the points.
+         */
+        [[nodiscard]]
+        std::vector< T > evaluate(const Polynomial< T >& poly) const
+        {
+            std::vector< T > result(m_points.size());
+            evaluate(std::span< const T >(poly.coefficients()), std::span< T >(result));
+            return result;
+        }
+
+        /**
+         * @brief Computes the polynomial of least degree that takes the given values at the points.
+         *
+         * @param values The values at the points, in the order the points were given in; must have the same size
+         * as the points.
+         * @return The interpolating polynomial, of order at most size() - 1.
+         *
+         * @throws NumerixxError if the number of values differs from the number of points, or if the points
+         * are not distinct.
+         */
+        [[nodiscard]]
+        Polynomial< T > interpolate(std::span< const T > values) const
+        {
+            const std::size_t n = m_points.size();
+            if (values.size() != n) throw NumerixxError("Interpolation requires one value per point.");
+
+            // ===== The weights are y_i / M'(x_i), with M' evaluated through the tree itself, in the order of the leaves.
+            using FLOAT_T = typename detail::FundamentalType< T >::type;
+
+            const auto       root = node(m_levels.size() - 1, 0);
+            std::vector< T > derivative(n);
+            std::vector< T > weights(n);
+            for (std::size_t k = 1; k <= n; ++k) derivative[k - 1] = root[k] * static_cast< FLOAT_T >(k);
+            evaluate(std::span< const T >(derivative), std::span< T >(weights));
+            for (std::size_t i = 0; i < n; ++i) derivative[i] = weights[m_permutation[i]];
+            std::swap(derivative, weights);
+            for (std::size_t i = 0; i < n; ++i) {
+                if (weights[i] == T {}) throw NumerixxError("Interpolation requires distinct points.");
+                weights[i] = values[m_permutation[i]] / weights[i];
+            }
+
+            // ===== At the leaves, sum the weights times the leaf polynomial divided by (x - x_i). The sums
+            // ===== are stored like the remainders in evaluate(): node j of a level at offset j * width(level).
+            std::vector< T > current(n);
+            std::vector< T > quotient(width(0) + 1);
+            for (std::size_t j = 0; j < nodeCount(0); ++j) {
+                const std::size_t offset = j * width(0);
+                const std::size_t count  = pointCount(0, j);
+                const auto        leaf   = node(0, j);
+                for (std::size_t i = 0; i < count; ++i) {
+                    std::copy(leaf.begin(), leaf.end(), quotient.begin());
+                    detail::deflateLinear(std::span< T >(quotient).first(count + 1), m_points[offset + i]);
+                    for (std::size_t k = 0; k < count; ++k) current[offset + k] += weights[offset + i] * quotient[k];
+                }
+            }
+
+            // ===== Going up, the sum for a node is left * M_right + right * M_left.
+            std::vector< T > next(n);
+            std::vector< T > product(n);
+            for (std::size_t level = 0; level + 1 < m_levels.size(); ++level) {
+                for (std::size_t j = 0; j < nodeCount(level + 1); ++j) {
+                    const std::size_t offset = j * width(level + 1);
+                    const std::size_t count  = pointCount(level + 1, j);
+                    const auto        dest   = std::span< T >(next).subspan(offset, count);
+                    const std::size_t left   = pointCount(level, 2 * j);
+                    if (2 * j + 1 >= nodeCount(level)) {
+                        std::copy_n(current.begin() + static_cast< std::ptrdiff_t >(offset), count, dest.begin());
+                        continue;
+                    }
+
+                    const std::size_t right = pointCount(level, 2 * j + 1);
+                    const auto        lhs   = std::span< const T >(current).subspan(offset, left);
+                    const auto        rhs   = std::span< const T >(current).subspan(offset + left, right);
+                    detail::multiply(lhs, node(level, 2 * j + 1), dest);
+                    detail::multiply(rhs, node(level, 2 * j), std::span< T >(product).first(count));
+                    for (std::size_t k = 0; k < count; ++k) dest[k] += product[k];
+                }
+                std::swap(current, next);
+            }
+
+            return Polynomial< T >(std::move(current));
+        }
+    };
+
+    /*
+     * Deduction guide.
+     */
+    template< typename CONTAINER >
+        requires IsCoefficientContainer< CONTAINER >
+    SubproductTree(CONTAINER) -> SubproductTree< typename CONTAINER::value_type >;
+
+    /**
+     * @brief Evaluates a polynomial at many points.
+     *
+     * For high orders and many complex points near the unit circle, the points are put in a SubproductTree,
+     * and the polynomial is evaluated with the remainder tree in O(n log^2 n). The values are checked
+     * against Horner's method at a sample of the points (see detail::agreesWithHorner), and if they do not
+     * agree, or for other points, the polynomial is evaluated with the batched Horner's method (see
+     * Polynomial::evaluate).
+     *
+     * @param poly The polynomial to evaluate.
+     * @param points The points at which to evaluate the polynomial.
+     * @return tl::expected<std::vector<T>, Error<detail::PolyErrorData<T>>>
+     *         The values of the polynomial at the points, or an error if any of them is non-finite.
+     */
+    template< typename T >
+    auto multipointEvaluate(const Polynomial< T >& poly, std::span< const T > points)
+        -> tl::expected< std::vector< T >, Error< detail::PolyErrorData< T > > >
+    {
+        std::vector< T > result(points.size());
+        if (points.empty()) return result;
+
+        if constexpr (IsComplex< T >) {
+            const auto coeffs = std::span< const T >(poly.coefficients());
+            if (std::min(poly.order() + 1, points.size()) >= detail::MULTIPOINT_EVALUATION_THRESHOLD && detail::isNearUnitCircle(points)) {
+                SubproductTree< T >(points).evaluate(coeffs, std::span< T >(result));
+                if (detail::agreesWithHorner(coeffs, points, std::span< const T >(result)) &&
+                    std::ranges::all_of(result, [](const T& val) { return detail::isFinite(val); }))
+                    return result;
+            }
+        }
+
+        if (auto status = poly.evaluate(points, std::span< T >(result)); !status) return tl::unexpected(status.error());
+        return result;
+    }
+
+    /**
+     * @brief Computes the polynomial of least degree through a set of points.
+     *
+     * For many complex points near the unit circle, the polynomial is computed with a SubproductTree in
+     * O(n log^2 n), and checked against the values at a sample of the points. Otherwise, it is computed with
+     * Newton's divided differences, which are converted to the monomial basis in O(n^2).
+     *
+     * @note Interpolation in the monomial basis is badly conditioned for real points: the coefficients lose
+     * accuracy beyond a few dozen points, and over- or underflow for a few hundred. Rather than returning
+     * non-finite coefficients, the function then returns an error.
+     *
+     * @param points The abscissae. Must be distinct.
+     * @param values The values at the abscissae; must have the same size as the points.
+     * @return tl::expected<Polynomial<T>, NumerixxError>
+     *         The interpolating polynomial, of order at most points.size() - 1, or an error if any of its
+     *         coefficients is non-finite.
+     *
+     * @throws NumerixxError if the sizes differ, if there are no points, or if the points are not distinct.
+     */
+    template< typename T >
+        requires nxx::IsFloat< T > || IsComplex< T >
+    tl::expected< Polynomial< T >, NumerixxError > interpolatePolynomial(std::span< const T > points, std::span< const T > values)
+    {
+        const std::size_t n = points.size();
+        if (values.size() != n) throw NumerixxError("Interpolation requires one value per point.");
+        if (n == 0) throw NumerixxError("Interpolation requires at least one point.");
+
+        if constexpr (IsComplex< T >) {
+            if (n >= detail::INTERPOLATION_THRESHOLD && detail::isNearUnitCircle(points)) {
+                auto       poly   = SubproductTree< T >(points).interpolate(values);
+                const auto coeffs = std::span< const T >(poly.coefficients());
+                if (std::ranges::all_of(coeffs, [](const T& val) { return detail::isFinite(val); }) &&
+                    detail::agreesWithHorner(coeffs, points, values))
+                    return poly;
+            }
+        }
+
+        // ===== The divided differences are computed over the points in interleaved order, for stability.
+        const auto       order = detail::interleavedOrder(points);
+        std::vector< T > x(n);
+        std::vector< T > y(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = points[order[i]];
+            y[i] = values[order[i]];
+        }
+
+        std::vector< T > coeffs(n);
+        detail::interpolateNewton(std::span< const T >(x), std::span< const T >(y), std::span< T >(coeffs));
+        if (!std::ranges::all_of(coeffs, [](const T& val) { return detail::isFinite(val); }))
+            return tl::unexpected(NumerixxError("Interpolation failed; the coefficients are not finite, as the problem is too badly conditioned."));
+        return Polynomial< T >(std::move(coeffs));
+    }
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_POLYSUBPRODUCTTREE_HPP
@@ -32,6 +32,9 @@
 #define NUMERIXX_POLYNOMIAL_HPP
 
 // ===== Numerixx Includes
+#include "PolyDivision.hpp"
+#include "PolyEvaluation.hpp"
+#include "PolyMultiplication.hpp"
 #include <Concepts.hpp>
 #include <Error.hpp>
 
@@ -40,12 +43,14 @@
 
 // ===== Standard Library Includes
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <complex>
 #include <functional>
 #include <iterator>
 #include <numeric>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <type_traits>
 #include <vector>
@@ -160,6 +165,38 @@ namespace nxx::poly
     {
         std::vector< T > m_coefficients; /**< The internal store of polynomial coefficients. */
 
+        /**
+         * @brief Determines if a coefficient is near zero, considering both floating-point and complex numbers.
+         */
+        static bool isNearZero(auto val)
+        {
+            // Use a different epsilon value based on whether the type is complex or not.
+            if constexpr (IsComplex< decltype(val) >) {
+                // Calculate epsilon for complex numbers.
+                constexpr auto epsilon = std::numeric_limits< typename decltype(val)::value_type >::epsilon();
+                // Check if the norm of the complex number is within the tolerance defined by epsilon.
+                return std::norm(val) <= epsilon * epsilon;
+            }
+            else {
+                // Calculate epsilon for floating-point numbers.
+                constexpr auto epsilon = std::numeric_limits< decltype(val) >::epsilon();
+                // Check if the value is within the tolerance defined by epsilon.
+                return std::norm(val) <= epsilon * epsilon;
+            }
+        }
+
+        /**
+         * @brief Removes trailing near-zero coefficients in place, keeping at least one coefficient.
+         */
+        void trim()
+        {
+            while (m_coefficients.size() > 1 && isNearZero(m_coefficients.back())) m_coefficients.pop_back();
+            if (m_coefficients.empty())
+                m_coefficients.push_back(T {});
+            else if (m_coefficients.size() == 1 && isNearZero(m_coefficients.front()))
+                m_coefficients.front() = T {};
+        }
+
     public:
         /**
          * @brief The type of the polynomial coefficients.
@@ -198,25 +235,8 @@ namespace nxx::poly
          */
         explicit Polynomial(const IsCoefficientContainer auto& coefficients)
         {
-            // Lambda function to determine if a coefficient is near zero, considering both floating-point and complex numbers.
-            auto is_near_zero = [&](auto val) -> bool {
-                // Use a different epsilon value based on whether the type is complex or not.
-                if constexpr (IsComplex< decltype(val) >) {
-                    // Calculate epsilon for complex numbers.
-                    constexpr auto epsilon = std::numeric_limits< typename decltype(val)::value_type >::epsilon();
-                    // Check if the norm of the complex number is within the tolerance defined by epsilon.
-                    return std::norm(val) <= epsilon * epsilon;
-                }
-                else {
-                    // Calculate epsilon for floating-point numbers.
-                    constexpr auto epsilon = std::numeric_limits< decltype(val) >::epsilon();
-                    // Check if the value is within the tolerance defined by epsilon.
-                    return std::norm(val) <= epsilon * epsilon;
-                }
-            };
-
             // Find the iterator to the first non-zero coefficient when traversing the container in reverse.
-            auto rev_it = std::find_if_not(coefficients.crbegin(), coefficients.crend(), is_near_zero);
+            auto rev_it = std::find_if_not(coefficients.crbegin(), coefficients.crend(), [](auto val) { return isNearZero(val); });
 
             // If all coefficients are near zero, initialize the polynomial as a zero polynomial.
             if (rev_it == coefficients.crend()) {
@@ -228,6 +248,25 @@ namespace nxx::poly
             }
         }
 
+        /**
+         * @brief Constructs a polynomial by taking ownership of a vector of coefficients.
+         *
+         * This constructor works like the container constructor, but moves the coefficients in place of
+         * copying them, and trims the trailing zeros in place. It is used by the arithmetic operators to
+         * avoid a second allocation for the result.
+         *
+         * @param coefficients A vector of coefficients in increasing order of degree.
+         *
+         * @note The constructor is a template, so that it does not take part in brace-initialization.
+         */
+        template< typename VECTOR >
+            requires std::same_as< VECTOR, std::vector< T > >
+        explicit Polynomial(VECTOR&& coefficients)
+            : m_coefficients(std::move(coefficients))
+        {
+            trim();
+        }
+
         /**
          * @brief Constructs a polynomial from an initializer list of coefficients.
          *
@@ -303,6 +342,12 @@ namespace nxx::poly
          * non-finite arguments or results. Horner's method is used for the evaluation
          * which is efficient and numerically stable.
          *
+         * The evaluation scheme is selected by the `STRATEGY` template parameter, which may be Horner,
+         * Horner2 (second-order Horner) or Estrin. By default, AutoEvaluation picks one of these based
+         * on the order of the polynomial, as the split schemes shorten the dependency chain of
+         * multiply-adds for high-degree polynomials.
+         *
+         * @tparam STRATEGY The evaluation strategy. Defaults to AutoEvaluation.
          * @tparam U The type of the value at which the polynomial is evaluated. It must
          *           be convertible to `T` or be a floating-point or complex type.
          * @param value The point at which to evaluate the polynomial.
@@ -314,14 +359,11 @@ namespace nxx::poly
          *         If an error occurs during the evaluation, `tl::unexpected` is returned with
          *         an instance of `nxx::NumerixxError` containing the error details.
          *
-         * @note This function uses `std::accumulate` for its implementation. The
-         *       accumulation starts from the second to last coefficient to the first,
-         *       ensuring that the iterator does not surpass the bounds.
          *
          * @exception nxx::NumerixxError Thrown if the polynomial has no coefficients, or if
          *            the argument or result of the evaluation is non-finite.
          */
-        template<typename U>
+        template<IsEvaluationStrategy STRATEGY = AutoEvaluation, typename U>
             requires std::convertible_to< U, T > || nxx::IsFloat< U > || IsComplex< U >
         [[nodiscard]]
         inline auto evaluate(U value) const
@@ -343,10 +385,7 @@ namespace nxx::poly
                                                 { .details      = "Polynomial evaluation failed; no coefficients.",
                                                   .coefficients = { m_coefficients.begin(), m_coefficients.end() } }));
 
-            // ===== Horner's method implemented in terms of std::accummulate.
-            TYPE result = std::accumulate(begin + 1, end, static_cast< TYPE >(m_coefficients.back()), [value](TYPE curr, TYPE coeff) {
-                return curr * static_cast< TYPE >(value) + coeff;
-            });
+            TYPE result = STRATEGY::evaluate(std::span< const T >(m_coefficients), static_cast< TYPE >(value));
 
             if (!std::isfinite(std::abs(result))) [[unlikely]]
                 return tl::unexpected(PolyError("Polynomial error",
@@ -359,6 +398,79 @@ namespace nxx::poly
             return result;
         }
 
+        /**
+         * @brief Evaluates the polynomial and its first K derivatives at a given point, in a single pass.
+         *
+         * The values are computed with the extended Horner scheme (see detail::hornerDerivatives), which
+         * costs roughly K + 1 Horner passes worth of arithmetic, but makes only one sweep over the coefficients
+         * and does not construct any derivative polynomials. This is the preferred way of getting the values
+         * needed by Newton and Laguerre iterations. With the CompensatedHorner strategy, the value is
+         * computed with the compensated Horner scheme, which keeps it accurate close to clustered roots.
+         *
+         * @tparam K The number of derivatives to compute.
+         * @tparam STRATEGY The evaluation strategy; Horner (the default) or CompensatedHorner.
+         * @tparam U The type of the value at which the polynomial is evaluated.
+         * @param value The point at which to evaluate the polynomial.
+         *
+         * @return A std::array holding p(x), p'(x), ..., p^(K)(x). Derivatives of an order higher than the
+         *         order of the polynomial are zero.
+         *
+         * @note Unlike evaluate(), this function does not check the result for non-finite values.
+         */
+        template< std::size_t K, IsEvaluationStrategy STRATEGY = Horner, typename U >
+            requires std::convertible_to< U, T > || nxx::IsFloat< U > || IsComplex< U >
+        [[nodiscard]]
+        inline auto evaluateWithDerivatives(U value) const
+        {
+            using TYPE = std::common_type_t< T, U >;
+            return STRATEGY::template evaluateWithDerivatives< K >(std::span< const T >(m_coefficients), static_cast< TYPE >(value));
+        }
+
+        /**
+         * @brief Evaluates the polynomial at a range of points in a single batched pass.
+         *
+         * This function evaluates the polynomial at every point in `x` and writes the results to the
+         * corresponding positions in `out`. The evaluation uses Horner's method run across several points
+         * at once (see detail::hornerBatch), with fused multiply-adds where the hardware supports them, so
+         * the throughput is much higher than calling evaluate() for each point.
+         *
+         * Unlike the scalar overload, errors are reported as one aggregate status for the whole batch: all
+         * results are written to `out` regardless, and if any of them is non-finite, the returned error holds
+         * the number of failed points along with the first offending argument and result.
+         *
+         * @param x The points at which to evaluate the polynomial.
+         * @param out The destination of the results. Must have the same size as `x`.
+         *
+         * @return tl::expected<void, Error<detail::PolyErrorData<T>>>
+         *         An empty expected on success, or an error if any of the results is non-finite.
+         *
+         * @throws NumerixxError if the sizes of `x` and `out` differ.
+         */
+        [[nodiscard]]
+        auto evaluate(std::span< const T > x, std::span< T > out) const -> tl::expected< void, Error< detail::PolyErrorData< T > > >
+        {
+            using PolyError = Error< detail::PolyErrorData< T > >;
+
+            if (x.size() != out.size())
+                throw NumerixxError("Batch evaluation requires the input and output ranges to be of equal size.");
+
+            detail::hornerBatch(std::span< const T >(m_coefficients), x, out);
+
+            const auto failures = std::count_if(out.begin(), out.end(), [](const T& val) { return !detail::isFinite(val); });
+            if (failures > 0) [[unlikely]] {
+                const auto pos = std::find_if(out.begin(), out.end(), [](const T& val) { return !detail::isFinite(val); }) - out.begin();
+                return tl::unexpected(PolyError("Polynomial error",
+                                                nxx::NumerixxErrorType::Poly,
+                                                { .details = "Batch polynomial evaluation failed; " + std::to_string(failures) +
+                                                             " non-finite result(s).",
+                                                  .coefficients = { m_coefficients.begin(), m_coefficients.end() },
+                                                  .arg          = x[static_cast< std::size_t >(pos)],
+                                                  .result       = out[static_cast< std::size_t >(pos)] }));
+            }
+
+            return {};
+        }
+
         /**
          * @brief Gets the coefficients of the polynomial.
          *
@@ -504,38 +616,67 @@ namespace nxx::poly
         /**
          * @brief Adds another polynomial to this polynomial.
          *
-         * This operator adds the given polynomial to this polynomial and returns
-         * the result as a new polynomial. The degree of the result will be equal
+         * The sum is computed in place: the coefficient vector is only grown if the other polynomial has a
+         * higher degree, and no temporary polynomial is created. The degree of the result will be equal
          * to the maximum degree of the two polynomials.
          *
          * @param rhs The polynomial to add to this polynomial.
-         * @return The sum of the two polynomials.
+         * @return A reference to the modified polynomial object.
          */
         template<typename U>
             requires nxx::IsFloat< U > || (IsComplex< T > && IsComplex< U >)
         Polynomial< T >& operator+=(Polynomial< U > const& rhs)
         {
-            auto temp = *this + rhs;
-            std::swap(*this, temp);
+            const auto& b = rhs.coefficients();
+            if (b.size() > m_coefficients.size()) m_coefficients.resize(b.size());
+            for (std::size_t k = 0; k < b.size(); ++k) m_coefficients[k] += static_cast< T >(b[k]);
+            trim();
             return *this;
         }
 
         /**
          * @brief Subtracts another polynomial from this polynomial.
          *
-         * This operator subtracts the given polynomial from this polynomial and returns
-         * the result as a new polynomial. The degree of the result will be equal
+         * The difference is computed in place, like operator+=(). The degree of the result will be equal
          * to the maximum degree of the two polynomials.
          *
          * @param rhs The polynomial to subtract from this polynomial.
-         * @return The difference between the two polynomials.
+         * @return A reference to the modified polynomial object.
          */
         template<typename U>
             requires nxx::IsFloat< U > || (IsComplex< T > && IsComplex< U >)
         Polynomial< T >& operator-=(Polynomial< U > const& rhs)
         {
-            auto temp = *this - rhs;
-            std::swap(*this, temp);
+            const auto& b = rhs.coefficients();
+            if (b.size() > m_coefficients.size()) m_coefficients.resize(b.size());
+            for (std::size_t k = 0; k < b.size(); ++k) m_coefficients[k] -= static_cast< T >(b[k]);
+            trim();
+            return *this;
+        }
+
+        /**
+         * @brief Multiplies all coefficients of the polynomial by a scalar, in place.
+         *
+         * @param scalar The scalar to multiply by.
+         * @return A reference to the modified polynomial object.
+         */
+        Polynomial< T >& operator*=(const T& scalar)
+        {
+            for (auto& coeff : m_coefficients) coeff *= scalar;
+            trim();
+            return *this;
+        }
+
+        /**
+         * @brief Divides all coefficients of the polynomial by a scalar, in place.
+         *
+         * @param scalar The scalar to divide by.
+         * @return A reference to the modified polynomial object.
+         */
+        Polynomial< T >& operator/=(const T& scalar)
+        {
+            for (auto& coeff : m_coefficients) coeff /= scalar;
+            trim();
             return *this;
         }
 
@@ -543,8 +684,10 @@ namespace nxx::poly
          * @brief Multiplies the polynomial by another polynomial and returns the result.
          *
          * This operator multiplies the polynomial by another polynomial and assigns the resulting polynomial
-         * to the current polynomial object. The function uses the free operator*() function to perform
-         * the multiplication.
+         * to the current polynomial object. For small right hand sides, the product is computed in place:
+         * the coefficient vector is grown to the order of the product, and the product coefficients are
+         * computed from the highest degree down, so that each one only overwrites coefficients that are no
+         * longer needed. Larger products use the same kernels as operator*(), and the result is moved in.
          *
          * @param rhs The other polynomial to multiply by.
          * @return A reference to the modified polynomial object.
@@ -553,8 +696,29 @@ namespace nxx::poly
             requires nxx::IsFloat< U > || (IsComplex< T > && IsComplex< U >)
         Polynomial< T >& operator*=(Polynomial< U > const& rhs)
         {
+            const std::size_t n = m_coefficients.size();
+            const std::size_t m = rhs.coefficients().size();
+
+            // ===== In-place schoolbook product. Not used for self-multiplication, as rhs would be overwritten.
+            if (std::min(n, m) < detail::KARATSUBA_THRESHOLD && static_cast< const void* >(&rhs) != static_cast< const void* >(this)) {
+                const auto& b = rhs.coefficients();
+                m_coefficients.resize(n + m - 1);
+                for (std::size_t k = n + m - 1; k-- > 0;) {
+                    const std::size_t jmin = k >= n ? k - n + 1 : 0;
+                    const std::size_t jmax = std::min(k, m - 1);
+                    T                 sum  = m_coefficients[k - jmin] * static_cast< T >(b[jmin]);
+                    for (std::size_t j = jmin + 1; j <= jmax; ++j) sum += m_coefficients[k - j] * static_cast< T >(b[j]);
+                    m_coefficients[k] = sum;
+                }
+                trim();
+                return *this;
+            }
+
             auto temp = *this * rhs;
-            std::swap(*this, temp);
+            if constexpr (std::same_as< decltype(temp), Polynomial< T > >)
+                std::swap(*this, temp);
+            else
+                *this = Polynomial< T >(temp.coefficients());
             return *this;
         }
 
@@ -562,7 +726,8 @@ namespace nxx::poly
          * @brief Divides the polynomial by another polynomial and returns the result.
          *
          * This operator divides the polynomial by another polynomial and assigns the resulting polynomial
-         * to the current polynomial object. The function uses the operator/() function to perform the division.
+         * to the current polynomial object. Linear and quadratic divisors are handled in place by synthetic
+         * division (see deflate() and deflateQuadratic()); other divisors use the operator/() function.
          *
          * @param rhs The other polynomial to divide by.
          * @return A reference to the modified polynomial object.
@@ -571,11 +736,68 @@ namespace nxx::poly
             requires nxx::IsFloat< U > || (IsComplex< T > && IsComplex< U >)
         Polynomial< T >& operator/=(Polynomial< U > const& rhs)
         {
+            // ===== Division by a linear or quadratic factor is done in place, using synthetic division.
+            const auto& b = rhs.coefficients();
+            if (rhs.order() <= 2 && rhs.order() >= 1 && rhs.order() <= order() && !isNearZero(b.back())) {
+                const T lead = static_cast< T >(b.back());
+                if (rhs.order() == 1)
+                    deflate(-static_cast< T >(b[0]) / lead);
+                else
+                    deflateQuadratic(static_cast< T >(b[1]) / lead, static_cast< T >(b[0]) / lead);
+                if (lead != T { 1 })
+                    for (auto& coeff : m_coefficients) coeff /= lead;
+                return *this;
+            }
+
             auto temp = *this / rhs;
-            std::swap(*this, temp);
+            if constexpr (std::same_as< decltype(temp), Polynomial< T > >)
+                std::swap(*this, temp);
+            else
+                *this = Polynomial< T >(temp.coefficients());
             return *this;
         }
 
+        /**
+         * @brief Divides the polynomial in place by the linear factor (x - root).
+         *
+         * The quotient is computed by synthetic division (Horner's scheme), overwriting the coefficients.
+         * No memory is allocated, and the cost is O(n). This is the operation used by the root finders to
+         * remove a root that has been found.
+         *
+         * @param root The root of the linear factor.
+         * @return The remainder of the division, i.e. the value of the polynomial at root.
+         *
+         * @throws NumerixxError if the polynomial is a constant.
+         */
+        T deflate(T root)
+        {
+            if (order() < 1) throw NumerixxError("Cannot deflate a polynomial of order zero.");
+            const T remainder = detail::deflateLinear(std::span< T >(m_coefficients), root);
+            m_coefficients.pop_back();
+            return remainder;
+        }
+
+        /**
+         * @brief Divides the polynomial in place by the monic quadratic factor (x^2 + p*x + q).
+         *
+         * This is used to remove a pair of complex conjugate roots z and conj(z) from a real polynomial
+         * without leaving real arithmetic, with p = -2*Re(z) and q = |z|^2. No memory is allocated, and the
+         * cost is O(n).
+         *
+         * @param p The linear coefficient of the quadratic factor.
+         * @param q The constant coefficient of the quadratic factor.
+         * @return The coefficients {r0, r1} of the remainder r0 + r1*x.
+         *
+         * @throws NumerixxError if the order of the polynomial is less than two.
+         */
+        std::array< T, 2 > deflateQuadratic(T p, T q)
+        {
+            if (order() < 2) throw NumerixxError("Cannot deflate a polynomial of order less than two by a quadratic factor.");
+            const auto remainder = detail::deflateQuadratic(std::span< T >(m_coefficients), p, q);
+            m_coefficients.resize(m_coefficients.size() - 2);
+            return remainder;
+        }
+
         /**
          * @brief Equality operator for polynomials.
          *
@@ -660,32 +882,20 @@ namespace nxx::poly
     requires IsCoefficientContainer< CONTAINER >
     Polynomial< typename CONTAINER::value_type > createPolynomialFromRoots(const CONTAINER& roots)
     {
-        using ValueType             = typename CONTAINER::value_type;
-        using CoefficientsContainer = std::vector< ValueType >;
-
-        // Start with a constant polynomial p(x) = 1
-        CoefficientsContainer coefficients = { ValueType { 1 } };
-
-        // Iterate over each root to construct the polynomial
-        for (const auto& root : roots) {
-            // Initialize a new vector for the new coefficients with one extra degree
-            CoefficientsContainer newCoefficients(coefficients.size() + 1, ValueType { 0 });
-
-            // Compute the new coefficients
-            for (size_t i = 0; i < coefficients.size(); ++i) {
-                // No out-of-bounds access should occur here, but we'll add an assert as a sanity check
-                assert(i < newCoefficients.size() - 1);    // Ensure we do not go out of bounds
-
-                newCoefficients[i + 1] += coefficients[i];       // x * coefficient
-                newCoefficients[i] -= root * coefficients[i];    // -root * coefficient
-            }
-
-            // Update the coefficients for the next iteration
-            coefficients.swap(newCoefficients);
-        }
+        using ValueType = typename CONTAINER::value_type;
+
+        // The roots are copied to contiguous storage in interleaved order, which keeps the partial products
+        // well conditioned; the coefficients are computed in a single vector, using a product tree for many
+        // roots (see detail::productOfLinearFactors).
+        const std::vector< ValueType > given(std::begin(roots), std::end(roots));
+        std::vector< ValueType >       rootsVector;
+        rootsVector.reserve(given.size());
+        for (const auto index : detail::interleavedOrder(std::span< const ValueType >(given))) rootsVector.push_back(given[index]);
+        std::vector< ValueType > coefficients(rootsVector.size() + 1);
+        detail::productOfLinearFactors(std::span< const ValueType >(rootsVector), std::span< ValueType >(coefficients));
 
         // Construct and return the Polynomial with the final coefficients
-        return Polynomial< ValueType >(coefficients);
+        return Polynomial< ValueType >(std::move(coefficients));
     }
 
     /**
@@ -733,7 +943,7 @@ namespace nxx::poly
      * @return A polynomial function, which is the derivative of the input function.
      * @throws error::PolynomialError if the input polynomial is constant.
      */
-    inline auto derivativeOf(IsPolynomial auto func)
+    inline auto derivativeOf(IsDynamicPolynomial auto func)
     {
         // Throw an error if the order of the polynomial function is 0 (i.e., the function is constant).
         if (func.order() == 0) throw std::runtime_error("Cannot differentiate a constant polynomial.");
@@ -776,47 +986,95 @@ namespace nxx::poly
         return ss.str();
     }
 
+    namespace detail
+    {
+        /**
+         * @brief Adds or subtracts two polynomials, reusing the storage of an operand that is an rvalue.
+         *
+         * If one of the operands is a temporary with the coefficient type of the result, the result is
+         * computed in place in its coefficient vector, and moved out. A chained expression such as
+         * p1 * p2 + p3 - p4 therefore allocates only for the product. Otherwise, the result is computed into
+         * a single new coefficient vector, which is moved into the returned polynomial.
+         *
+         * @tparam SUBTRACT If true, computes lhs - rhs, otherwise lhs + rhs.
+         */
+        template< bool SUBTRACT, typename LHS, typename RHS >
+        auto addPolynomials(LHS&& lhs, RHS&& rhs)
+        {
+            using T    = typename std::remove_cvref_t< LHS >::value_type;
+            using U    = typename std::remove_cvref_t< RHS >::value_type;
+            using TYPE = std::common_type_t< T, U >;
+
+            constexpr bool reuseLhs = !std::is_lvalue_reference_v< LHS > && std::same_as< T, TYPE >;
+            constexpr bool reuseRhs = !std::is_lvalue_reference_v< RHS > && std::same_as< U, TYPE >;
+
+            // ===== lhs - rhs, in the coefficient vector of rhs. Both operands may refer to the same polynomial.
+            auto subtractFromRhs = [](auto& result, const auto& other) {
+                if (static_cast< const void* >(&result) == static_cast< const void* >(&other))
+                    result *= TYPE(0);
+                else {
+                    result *= TYPE(-1);
+                    result += other;
+                }
+            };
+
+            // ===== The operation is done before the move, in case both operands refer to the same polynomial.
+            if constexpr (reuseLhs && reuseRhs) {
+                if (rhs.order() > lhs.order()) {
+                    if constexpr (SUBTRACT)
+                        subtractFromRhs(rhs, lhs);
+                    else
+                        rhs += lhs;
+                    return Polynomial< TYPE >(std::move(rhs));
+                }
+            }
+            if constexpr (reuseLhs) {
+                if constexpr (SUBTRACT)
+                    lhs -= rhs;
+                else
+                    lhs += rhs;
+                return Polynomial< TYPE >(std::move(lhs));
+            }
+            else if constexpr (reuseRhs) {
+                if constexpr (SUBTRACT)
+                    subtractFromRhs(rhs, lhs);
+                else
+                    rhs += lhs;
+                return Polynomial< TYPE >(std::move(rhs));
+            }
+            else {
+                const auto&         a = lhs.coefficients();
+                const auto&         b = rhs.coefficients();
+                std::vector< TYPE > coeffs(std::max(a.size(), b.size()));
+                std::copy(a.cbegin(), a.cend(), coeffs.begin());
+                for (std::size_t k = 0; k < b.size(); ++k) {
+                    if constexpr (SUBTRACT)
+                        coeffs[k] -= static_cast< TYPE >(b[k]);
+                    else
+                        coeffs[k] += static_cast< TYPE >(b[k]);
+                }
+                return Polynomial< TYPE >(std::move(coeffs));
+            }
+        }
+    }    // namespace detail
+
     /**
      * @brief Adds two polynomials.
      *
      * This operator adds the given two polynomials and returns the result as a new polynomial.
-     * The degree of the result will be equal to the maximum degree of the two polynomials.
+     * The degree of the result will be equal to the maximum degree of the two polynomials. If one of the
+     * operands is a temporary, its storage is reused for the result (see detail::addPolynomials).
      *
-     * @tparam T The type of the first operand. Can be any type.
-     * @tparam U The type of the second operand. Can be any type.
      * @param lhs The first operand, a Polynomial.
      * @param rhs The second operand, a Polynomial.
      *
      * @returns An object of type Polynomial that represents the sum of lhs and rhs.
      */
-    template<typename T, typename U>
-        requires(nxx::IsFloat< T > || IsComplex< T >) && (nxx::IsFloat< U > || IsComplex< U >)
-    auto operator+(Polynomial< T > const& lhs, Polynomial< U > const& rhs)
+    template< typename LHS, typename RHS >
+        requires IsDynamicPolynomial< std::remove_cvref_t< LHS > > && IsDynamicPolynomial< std::remove_cvref_t< RHS > >
+    auto operator+(LHS&& lhs, RHS&& rhs)
     {
-        // Determine the common type between T and U
-        using TYPE = std::common_type_t< T, U >;
-
-        // Check if lhs's degree is less than rhs's degree
-        if (lhs.order() < rhs.order()) {
-            // Copy rhs's coefficients to add to
-            std::vector< TYPE > coeffs(rhs.coefficients().cbegin(), rhs.coefficients().cend());
-
-            // Add lhs's coefficients to copied rhs's coefficients one by one
-            std::transform(lhs.coefficients().cbegin(), lhs.coefficients().cend(), coeffs.cbegin(), coeffs.begin(), std::plus< TYPE >());
-
-            // Return a Polynomial constructed from the resulting coefficients
-            return Polynomial< TYPE >(coeffs);
-        }
-        else {
-            // Copy lhs's coefficients to add to
-            std::vector< TYPE > coeffs(lhs.coefficients().cbegin(), lhs.coefficients().cend());
-
-            // Add rhs's coefficients to copied lhs's coefficients one by one
-            std::transform(rhs.coefficients().cbegin(), rhs.coefficients().cend(), coeffs.cbegin(), coeffs.begin(), std::plus< TYPE >());
-
-            // Return a Polynomial constructed from the resulting coefficients
-            return Polynomial< TYPE >(coeffs);
-        }
+        return detail::addPolynomials< false >(std::forward< LHS >(lhs), std::forward< RHS >(rhs));
     }
 
     /**
@@ -824,47 +1082,59 @@ namespace nxx::poly
      *
      * This operator subtracts the second polynomial from the first polynomial and returns
      * the result as a new polynomial. The degree of the result will be equal to the maximum
-     * degree of the two polynomials.
+     * degree of the two polynomials. If one of the operands is a temporary, its storage is reused for
+     * the result (see detail::addPolynomials).
      *
-     * @tparam T The type of the first operand. Can be any type.
-     * @tparam U The type of the second operand. Can be any type.
      * @param lhs The first operand, a Polynomial.
      * @param rhs The second operand, a Polynomial.
      *
      * @returns An object of type Polynomial that represents the difference of lhs and rhs.
      */
-    template<typename T, typename U>
-        requires(nxx::IsFloat< T > || IsComplex< T >) && (nxx::IsFloat< U > || IsComplex< U >)
-    auto operator-(Polynomial< T > const& lhs, Polynomial< U > const& rhs)
+    template< typename LHS, typename RHS >
+        requires IsDynamicPolynomial< std::remove_cvref_t< LHS > > && IsDynamicPolynomial< std::remove_cvref_t< RHS > >
+    auto operator-(LHS&& lhs, RHS&& rhs)
     {
-        // Determine the common type between T and U
-        using TYPE = std::common_type_t< T, U >;
-
-        // Check if lhs's degree is less than rhs's degree
-        if (lhs.order() < rhs.order()) {
-            // Copy rhs's coefficients to subtract from
-            std::vector< TYPE > coeffs(rhs.coefficients().cbegin(), rhs.coefficients().cend());
+        return detail::addPolynomials< true >(std::forward< LHS >(lhs), std::forward< RHS >(rhs));
+    }
 
-            // Subtract lhs's coefficients from copied rhs's coefficients one by one
-            std::transform(lhs.coefficients().cbegin(), lhs.coefficients().cend(), coeffs.cbegin(), coeffs.begin(), [](TYPE a, TYPE b) {
-                return a - b;
-            });
+    /**
+     * @brief Negates a polynomial. The storage of a temporary operand is reused.
+     */
+    template< typename T >
+    Polynomial< T > operator-(Polynomial< T > poly)
+    {
+        poly *= T(-1);
+        return poly;
+    }
 
-            // Return a Polynomial constructed from the resulting coefficients
-            return Polynomial(coeffs);
-        }
-        else {
-            // Copy lhs's coefficients to subtract from
-            std::vector< TYPE > coeffs(lhs.coefficients().cbegin(), lhs.coefficients().cend());
+    /**
+     * @brief Multiplies a polynomial by a scalar. The storage of a temporary operand is reused.
+     */
+    template< typename T >
+    Polynomial< T > operator*(Polynomial< T > poly, const std::type_identity_t< T >& scalar)
+    {
+        poly *= scalar;
+        return poly;
+    }
 
-            // Subtract rhs's coefficients from copied lhs's coefficients one by one
-            std::transform(rhs.coefficients().cbegin(), rhs.coefficients().cend(), coeffs.cbegin(), coeffs.begin(), [](TYPE a, TYPE b) {
-                return b - a;
-            });
+    /**
+     * @brief Multiplies a scalar by a polynomial. The storage of a temporary operand is reused.
+     */
+    template< typename T >
+    Polynomial< T > operator*(const std::type_identity_t< T >& scalar, Polynomial< T > poly)
+    {
+        poly *= scalar;
+        return poly;
+    }
 
-            // Return a Polynomial constructed from the resulting coefficients
-            return Polynomial(coeffs);
-        }
+    /**
+     * @brief Divides a polynomial by a scalar. The storage of a temporary operand is reused.
+     */
+    template< typename T >
+    Polynomial< T > operator/(Polynomial< T > poly, const std::type_identity_t< T >& scalar)
+    {
+        poly /= scalar;
+        return poly;
     }
 
     /**
@@ -890,29 +1160,22 @@ namespace nxx::poly
 
         // Initialize a structure to contain the result
         // The degree of the product is the sum of degrees of multipliers (plus one for the constant term)
-        std::vector< TYPE > result(lhs.order() + rhs.order() + 1, 0.0);
-
-        // Counter for the number of terms already processed
-        int counter = 0;
-
-        // Iterate over every term in the RHS polynomial
-        for (auto elem : rhs.coefficients()) {
-            // Get a copy of the LHS coefficients
-            std::vector< TYPE > subtractor(lhs.coefficients().cbegin(), lhs.coefficients().cend());
-
-            // Multiply each term in LHS by the current term in RHS
-            std::transform(subtractor.cbegin(), subtractor.cend(), subtractor.begin(), [=](TYPE val) { return val * elem; });
-
-            // Add the resulting terms to the result polynomial, taking into consideration their respective powers
-            // (represented by the 'counter' variable)
-            std::transform(subtractor.cbegin(), subtractor.cend(), result.begin() + counter, result.begin() + counter, std::plus< TYPE >());
-
-            // Advance the counter
-            ++counter;
-        }
+        std::vector< TYPE > result(lhs.order() + rhs.order() + 1);
+
+        // Multiply using the fastest kernel for the operand sizes (schoolbook, Karatsuba or FFT).
+        // The operands are only converted if their coefficient types differ from the common type.
+        auto asCommon = [](const auto& poly) {
+            if constexpr (std::same_as< typename std::remove_cvref_t< decltype(poly) >::value_type, TYPE >)
+                return std::span< const TYPE >(poly.coefficients());
+            else
+                return std::vector< TYPE >(poly.cbegin(), poly.cend());
+        };
+        const auto lhsCoeffs = asCommon(lhs);
+        const auto rhsCoeffs = asCommon(rhs);
+        detail::multiply(std::span< const TYPE >(lhsCoeffs), std::span< const TYPE >(rhsCoeffs), std::span< TYPE >(result));
 
         // Return a Polynomial constructed from the resulting coefficients
-        return Polynomial(result);
+        return Polynomial< TYPE >(std::move(result));
     }
 
     /**
@@ -939,41 +1202,39 @@ namespace nxx::poly
         // Determine the type of polynomial which is common between T and U
         using TYPE = std::common_type_t< T, U >;
 
-        // The coefficients of the polynomials
-        std::vector< TYPE > dividend(lhs.cbegin(), lhs.cend());
-        std::vector< TYPE > divisor(rhs.cbegin(), rhs.cend());
-
         // Handle case when divisor doesn't have coefficients or
         // when polynomial order of divisor is larger than the dividend
-        if (divisor.empty() || divisor.back() == 0.0 || rhs.order() > lhs.order())
+        if (rhs.coefficients().empty() || rhs.coefficients().back() == 0.0 || rhs.order() > lhs.order())
             throw NumerixxError("Divisor polynomial cannot be empty or have a higher degree than the dividend.");
 
-        // Initialize the quotient polynomial coefficients with 0
-        assert(lhs.order() - rhs.order() + 1 > 0);    // Ensure we do not go out of bounds
-        std::vector< TYPE > quotient(lhs.order() - rhs.order() + 1, TYPE { 0 });
-        std::vector< TYPE > remainder = dividend;
-
-        // Iteratively compute the coefficients of the quotient polynomial
-        for (std::size_t i = lhs.order(); i >= rhs.order() && i < dividend.size(); --i) {
-            assert(i < remainder.size());                 // Ensure we do not go out of bounds
-            assert(i - rhs.order() < quotient.size());    // Ensure we do not go out of bounds
-            TYPE coef                 = remainder[i] / divisor.back();
-            quotient[i - rhs.order()] = coef;
-
-            // For each coefficient in the divisor subtract coef*divisor from the dividend (remainder)
-            for (std::size_t j = 0; j <= rhs.order(); ++j) {
-                assert(i - j < remainder.size());            // Ensure we do not go out of bounds
-                assert(rhs.order() - j < divisor.size());    // Ensure we do not go out of bounds
-                remainder[i - j] -= coef * divisor[rhs.order() - j];
-            }
+        // The divisor is only converted if its coefficient type differs from the common type.
+        auto divisor = [&] {
+            if constexpr (std::same_as< U, TYPE >)
+                return std::span< const TYPE >(rhs.coefficients());
+            else
+                return std::vector< TYPE >(rhs.cbegin(), rhs.cend());
+        }();
+
+        // The quotient and remainder vectors are allocated once, and moved into the returned polynomials.
+        const std::size_t   m = rhs.order();
+        std::vector< TYPE > quotient(lhs.order() - m + 1);
+        std::vector< TYPE > remainder;
+
+        if (std::min(m, quotient.size()) >= detail::NEWTON_DIVISION_THRESHOLD) {
+            std::vector< TYPE > dividend(lhs.cbegin(), lhs.cend());
+            remainder.resize(m);
+            detail::divideNewton(std::span< const TYPE >(dividend), std::span< const TYPE >(divisor), std::span< TYPE >(quotient), std::span< TYPE >(remainder));
         }
-
-        // Trim the leading zeros in the remainder
-        remainder.erase(std::find_if(remainder.crbegin(), remainder.crend(), [](TYPE val) { return val != 0.0; }).base() + 1,
-                        remainder.end());
+        else {
+            // Schoolbook long division, working on the dividend in place; the low terms are the remainder.
+            remainder.assign(lhs.cbegin(), lhs.cend());
+            detail::divideSchoolbook(std::span< TYPE >(remainder), std::span< const TYPE >(divisor), std::span< TYPE >(quotient));
+            remainder.resize(m);
+        }
+        if (remainder.empty()) remainder.push_back(TYPE {});
 
         // Return the quotient and the remainder as a pair
-        return std::make_pair(Polynomial(quotient), Polynomial(remainder));
+        return std::make_pair(Polynomial< TYPE >(std::move(quotient)), Polynomial< TYPE >(std::move(remainder)));
     }
 
     /**
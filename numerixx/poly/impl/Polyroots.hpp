@@ -32,17 +32,26 @@
 #define NUMERIXX_POLYROOTS_HPP
 
 // ===== Numerixx Includes
+#include "PolyAberth.hpp"
+#include "PolyBatch.hpp"
+#include "PolyCompanion.hpp"
+#include "PolyLaguerre.hpp"
+#include "PolyRealRoots.hpp"
 #include "Polynomial.hpp"
+#include "StaticPolynomial.hpp"
 #include <Constants.hpp>
 #include <Roots.hpp>
 
 // ===== Standard Library Includes
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <numbers>
 #include <optional>
-#include <random>
+#include <span>
+#include <tuple>
 #include <vector>
 
 namespace nxx::poly
@@ -68,6 +77,231 @@ namespace nxx::poly
             if (order < min_order) throw NumerixxError("Polynomial must have order of at least " + std::to_string(min_order) + ".");
         }
 
+        /**
+         * @brief Polishes a root of a polynomial using Newton's method.
+         *
+         * The polynomial value and its derivative are obtained from a single extended Horner sweep per
+         * iteration (see Polynomial::evaluateWithDerivatives), so no derivative polynomial is formed. As the
+         * root is already close, the value is computed with the compensated Horner scheme (see
+         * CompensatedHorner), so the polishing is not limited by cancellation near clustered roots.
+         *
+         * @param poly The polynomial.
+         * @param root The initial estimate of the root.
+         * @param tolerance The convergence criterion, applied to the absolute value of the polynomial.
+         * @param max_iterations The maximum number of iterations.
+         * @return The polished root, or std::nullopt if the iteration diverged or did not converge.
+         */
+        template< typename POLY, typename ARG_T >
+        inline std::optional< ARG_T > newtonPolish(const POLY& poly, ARG_T root, auto tolerance, int max_iterations)
+        {
+            using std::abs;
+            for (int i = 0;; ++i) {
+                const auto [value, deriv] = poly.template evaluateWithDerivatives< 1, CompensatedHorner >(root);
+                if (!detail::isFinite(root) || !detail::isFinite(value)) return std::nullopt;
+                if (abs(value) < tolerance) return root;
+                if (i >= max_iterations) return std::nullopt;
+                root -= value / deriv;
+            }
+        }
+
+        /**
+         * @brief Computes the roots of the quadratic polynomial c + b*x + a*x^2, without allocating.
+         *
+         * @param c The constant coefficient.
+         * @param b The linear coefficient.
+         * @param a The quadratic coefficient.
+         * @param tolerance The smallest allowed magnitude of the leading coefficient.
+         * @return The two roots, or std::nullopt if the polynomial is ill formed.
+         */
+        template< typename COMPLEX_T, typename VALUE_T >
+        inline std::optional< std::array< COMPLEX_T, 2 > > quadraticRoots(const VALUE_T& c, const VALUE_T& b, const VALUE_T& a, auto tolerance)
+        {
+            // Calculate the discriminant
+            const COMPLEX_T discriminant   = sqrt(COMPLEX_T(b * b - 4.0 * a * c));
+            const COMPLEX_T sqrt_component = std::conj(COMPLEX_T(b)) * discriminant;
+
+            // Calculate the roots of the quadratic polynomial
+            const COMPLEX_T q = -0.5 * (b + (sqrt_component.real() >= 0.0 ? discriminant : -discriminant));
+
+            // Check if the discriminant or the coefficient 'a' is less than the tolerance
+            if (std::abs(q) < tolerance || std::abs(a) < tolerance) return std::nullopt;
+
+            return std::array< COMPLEX_T, 2 > { q / a, c / q };
+        }
+
+        /**
+         * @brief Computes the roots of the monic cubic polynomial c + b*x + a*x^2 + x^3, without allocating.
+         *
+         * @param c The constant coefficient.
+         * @param b The linear coefficient.
+         * @param a The quadratic coefficient.
+         * @return The three roots.
+         */
+        template< typename COMPLEX_T, typename VALUE_T >
+        inline std::array< COMPLEX_T, 3 > cubicRoots(const VALUE_T& c, const VALUE_T& b, const VALUE_T& a)
+        {
+            using std::sqrt;
+            using namespace std::complex_literals;
+
+            // ===== Ad hoc lambda function to calculate the cube root of a complex number.
+            auto cbrt = [](COMPLEX_T x) { return std::pow(x, 1.0 / 3.0); };
+
+            const COMPLEX_T Q = (a * a - 3.0 * b) / 9.0;
+            const COMPLEX_T R = (2.0 * a * a * a - 9.0 * a * b + 27.0 * c) / 54.0;
+            const COMPLEX_T A =
+                -cbrt(R + ((std::conj(R) * sqrt(R * R - Q * Q * Q)).real() >= 0.0 ? sqrt(R * R - Q * Q * Q) : -sqrt(R * R - Q * Q * Q)));
+            const COMPLEX_T B = (abs(A) == 0.0 ? 0.0 : Q / A);
+
+            return { A + B - a / 3.0,
+                     -0.5 * (A + B) - a / 3.0 + 0.5 * sqrt(3.0) * (A - B) * 1.0i,
+                     -0.5 * (A + B) - a / 3.0 - 0.5 * sqrt(3.0) * (A - B) * 1.0i };
+        }
+
+        /**
+         * @brief The maximum number of Newton steps used to polish each root of a quartic.
+         *
+         * @note The closed form roots are accurate to a few digits less than the working precision, so one or two
+         * steps usually suffice; further steps are only taken while they reduce the value of the quartic.
+         */
+        inline constexpr int QUARTIC_POLISH_STEPS = 4;
+
+        /**
+         * @brief Polishes a root of the monic quartic d + c*x + b*x^2 + a*x^3 + x^4, using Newton's method.
+         *
+         * A step is only taken if it reduces the magnitude of the quartic, so roots that are already accurate to
+         * working precision, and multiple roots, where Newton's method converges slowly, are left unchanged.
+         *
+         * @param x The root to polish; real or complex.
+         * @return The polished root.
+         */
+        template< typename ROOT_T, typename VALUE_T >
+        inline ROOT_T polishQuarticRoot(ROOT_T x, const VALUE_T& d, const VALUE_T& c, const VALUE_T& b, const VALUE_T& a)
+        {
+            using std::abs;
+            const auto evaluate = [&](const ROOT_T& z) { return (((z + a) * z + b) * z + c) * z + d; };
+
+            ROOT_T value = evaluate(x);
+            for (int i = 0; i < QUARTIC_POLISH_STEPS && value != ROOT_T(0); ++i) {
+                const ROOT_T deriv = ((ROOT_T(4) * x + ROOT_T(3) * a) * x + ROOT_T(2) * b) * x + c;
+                if (deriv == ROOT_T(0)) break;
+                const ROOT_T next      = x - value / deriv;
+                const ROOT_T nextValue = evaluate(next);
+                if (!(abs(nextValue) < abs(value))) break;
+                x     = next;
+                value = nextValue;
+            }
+            return x;
+        }
+
+        /**
+         * @brief Computes the roots of the monic quartic d + c*x + b*x^2 + a*x^3 + x^4 with real coefficients, in
+         * real arithmetic.
+         *
+         * The roots are computed with Ferrari's method (see detail::quarticLane), and the real roots are polished
+         * on the original coefficients (see polishQuarticRoot()). Complex roots are not polished, so no complex
+         * arithmetic is involved.
+         *
+         * @param re The real parts of the roots; the real roots come first, in increasing order, followed by the
+         * complex conjugate pairs.
+         * @param im The imaginary parts of the roots; exactly zero for the real roots.
+         */
+        template< std::floating_point FLOAT_T >
+        inline void quarticRealRoots(FLOAT_T d, FLOAT_T c, FLOAT_T b, FLOAT_T a, std::array< FLOAT_T, 4 >& re, std::array< FLOAT_T, 4 >& im)
+        {
+            detail::quarticLane(d, c, b, a, FLOAT_T(1), re, im);
+            const auto real = static_cast< std::size_t >(std::count(im.begin(), im.end(), FLOAT_T(0)));
+            for (std::size_t i = 0; i < real; ++i) re[i] = polishQuarticRoot(re[i], d, c, b, a);
+            std::sort(re.begin(), re.begin() + static_cast< std::ptrdiff_t >(real));
+        }
+
+        /**
+         * @brief Computes the roots of the monic quartic d + c*x + b*x^2 + a*x^3 + x^4, without allocating.
+         *
+         * The quartic is depressed to y^4 + p*y^2 + q*y + r (with x = y - a/4), and factored into the quadratics
+         * (y^2 + s*y + t)(y^2 - s*y + v) (Descartes' method), where u = s^2 is a root of the resolvent cubic
+         * u^3 + 2p*u^2 + (p^2 - 4r)*u - q^2. The root of largest magnitude is used, and polished with Newton's
+         * method, so s is not dominated by rounding errors; t and v, whose product is r, are computed without
+         * cancellation. Finally, each root is polished on the original coefficients (see polishQuarticRoot()).
+         * If the coefficients are real, the roots are computed in real arithmetic instead (see quarticRealRoots()),
+         * and only the complex roots are polished in complex arithmetic.
+         *
+         * @param d The constant coefficient.
+         * @param c The linear coefficient.
+         * @param b The quadratic coefficient.
+         * @param a The cubic coefficient.
+         * @return The four roots.
+         */
+        template< typename COMPLEX_T, typename VALUE_T >
+        inline std::array< COMPLEX_T, 4 > quarticRoots(const VALUE_T& d, const VALUE_T& c, const VALUE_T& b, const VALUE_T& a)
+        {
+            using std::abs;
+            using std::sqrt;
+
+            std::array< COMPLEX_T, 4 > roots;
+            if constexpr (std::floating_point< VALUE_T >) {
+                std::array< VALUE_T, 4 > re;
+                std::array< VALUE_T, 4 > im;
+                quarticRealRoots(d, c, b, a, re, im);
+                for (std::size_t i = 0; i < 4; ++i)
+                    roots[i] = im[i] == 0 ? COMPLEX_T(re[i]) : polishQuarticRoot(COMPLEX_T(re[i], im[i]), d, c, b, a);
+                return roots;
+            }
+            else {
+                if (d.imag() == 0 && c.imag() == 0 && b.imag() == 0 && a.imag() == 0)
+                    return quarticRoots< COMPLEX_T >(d.real(), c.real(), b.real(), a.real());
+            }
+
+            // ===== Depressed quartic y^4 + p*y^2 + q*y + r.
+            const COMPLEX_T a4 = COMPLEX_T(a) / COMPLEX_T(4);
+            const COMPLEX_T p  = b - COMPLEX_T(6) * a4 * a4;
+            const COMPLEX_T q  = c - COMPLEX_T(2) * b * a4 + COMPLEX_T(8) * a4 * a4 * a4;
+            const COMPLEX_T r  = d - c * a4 + b * a4 * a4 - COMPLEX_T(3) * a4 * a4 * a4 * a4;
+
+            // ===== The resolvent root of largest magnitude, polished on the resolvent cubic.
+            const COMPLEX_T c1        = p * p - COMPLEX_T(4) * r;
+            const auto      resolvent = cubicRoots< COMPLEX_T >(-q * q, c1, COMPLEX_T(2) * p);
+            COMPLEX_T       u = *std::max_element(resolvent.begin(), resolvent.end(), [](const auto& x, const auto& y) { return abs(x) < abs(y); });
+            for (int i = 0; i < QUARTIC_POLISH_STEPS; ++i) {
+                const COMPLEX_T value = ((u + COMPLEX_T(2) * p) * u + c1) * u - q * q;
+                const COMPLEX_T deriv = (COMPLEX_T(3) * u + COMPLEX_T(4) * p) * u + c1;
+                if (deriv == COMPLEX_T(0)) break;
+                const COMPLEX_T next = u - value / deriv;
+                if (!(abs(((next + COMPLEX_T(2) * p) * next + c1) * next - q * q) < abs(value))) break;
+                u = next;
+            }
+
+            // ===== All roots coincide if the resolvent roots vanish, i.e. p = q = r = 0.
+            if (u == COMPLEX_T(0)) {
+                roots.fill(-a4);
+                return roots;
+            }
+
+            // ===== The constants t = h - k and v = h + k multiply to r; the smaller one is computed as a quotient.
+            const COMPLEX_T s = sqrt(u);
+            const COMPLEX_T h = (p + u) / COMPLEX_T(2);
+            const COMPLEX_T k = q / (COMPLEX_T(2) * s);
+            COMPLEX_T       t = h - k;
+            COMPLEX_T       v = h + k;
+            if (abs(t) > abs(v))
+                v = r / t;
+            else if (v != COMPLEX_T(0))
+                t = r / v;
+
+            // ===== Roots of y^2 + B*y + C, choosing the sign of the square root that avoids cancellation.
+            const auto solveQuadratic = [](const COMPLEX_T& B, const COMPLEX_T& C, COMPLEX_T* out) {
+                COMPLEX_T disc = sqrt(B * B - COMPLEX_T(4) * C);
+                if ((std::conj(B) * disc).real() < 0) disc = -disc;
+                const COMPLEX_T Q = -(B + disc) / COMPLEX_T(2);
+                out[0]            = Q;
+                out[1]            = Q == COMPLEX_T(0) ? COMPLEX_T(0) : C / Q;
+            };
+            solveQuadratic(s, t, roots.data());
+            solveQuadratic(-s, v, roots.data() + 2);
+
+            for (auto& root : roots) root = polishQuarticRoot(root - a4, COMPLEX_T(d), COMPLEX_T(c), COMPLEX_T(b), COMPLEX_T(a));
+            return roots;
+        }
+
         /**
          * @brief Sorts a vector of roots either real or complex based on their values.
          *
@@ -216,19 +450,10 @@ namespace nxx::poly
         const auto& b      = coeffs[1];
         const auto& c      = coeffs[0];
 
-        // Calculate the discriminant
-        const COMPLEX_T discriminant   = sqrt(b * b - 4.0 * a * c);
-        const COMPLEX_T sqrt_component = std::conj(b) * discriminant;
-
         // Calculate the roots of the quadratic polynomial
-        const COMPLEX_T q = -0.5 * (b + (sqrt_component.real() >= 0.0 ? discriminant : -discriminant));
-
-        // Check if the discriminant or the coefficient 'a' is less than the tolerance
-        if (std::abs(q) < tolerance || std::abs(a) < tolerance)
-            return EXPECTED_T(tl::unexpected(NumerixxError("Quadratic polynomial is ill formed.")));
-
-        // Calculate the roots
-        std::vector< COMPLEX_T > roots = { q / a, c / q };
+        const auto found = impl::quadraticRoots< COMPLEX_T >(c, b, a, tolerance);
+        if (!found) return EXPECTED_T(tl::unexpected(NumerixxError("Quadratic polynomial is ill formed.")));
+        std::vector< COMPLEX_T > roots(found->begin(), found->end());
 
         // Sort the roots and return them
         EXPECTED_T result = impl::sortRoots< RETURN_T >(roots, tolerance);
@@ -270,31 +495,77 @@ namespace nxx::poly
         using RETURN_T   = std::conditional_t< std::same_as< RT, void >, VALUE_T, RT >;
         using EXPECTED_T = tl::expected< std::vector< RETURN_T >, NumerixxError >;
 
-        using std::sqrt;
-        using namespace std::numbers;
-        using namespace std::complex_literals;
-
-        // ===== Ad hoc lambda function to calculate the cube root of a complex number.
-        auto cbrt = [](COMPLEX_T x) { return std::pow(x, 1.0 / 3.0); };
-
         auto coeff = poly.coefficients();
         std::transform(coeff.cbegin(), coeff.cend(), coeff.begin(), [&coeff](auto elem) { return elem / coeff.back(); });
 
-        const auto& a = coeff[2];
-        const auto& b = coeff[1];
-        const auto& c = coeff[0];
+        const auto               found = impl::cubicRoots< COMPLEX_T >(coeff[0], coeff[1], coeff[2]);
+        std::vector< COMPLEX_T > roots(found.begin(), found.end());
 
-        const COMPLEX_T Q = (a * a - 3.0 * b) / 9.0;
-        const COMPLEX_T R = (2.0 * a * a * a - 9.0 * a * b + 27.0 * c) / 54.0;
-        const COMPLEX_T A =
-            -cbrt(R + ((std::conj(R) * sqrt(R * R - Q * Q * Q)).real() >= 0.0 ? sqrt(R * R - Q * Q * Q) : -sqrt(R * R - Q * Q * Q)));
-        const COMPLEX_T B = (abs(A) == 0.0 ? 0.0 : Q / A);
+        return EXPECTED_T(impl::sortRoots< RETURN_T >(roots, tolerance));
+    }
 
-        std::vector< COMPLEX_T > roots = { A + B - a / 3.0,
-                                           -0.5 * (A + B) - a / 3.0 + 0.5 * sqrt(3.0) * (A - B) * 1.0i,
-                                           -0.5 * (A + B) - a / 3.0 - 0.5 * sqrt(3.0) * (A - B) * 1.0i };
+    /**
+     * @brief Finds the roots of a quartic polynomial in closed form, returning either complex or real roots
+     * depending on the RT template parameter.
+     *
+     * For real coefficients, the roots are computed in real arithmetic with Ferrari's method, so requesting
+     * only the real roots involves no complex arithmetic at all. For complex
+     * coefficients, the roots are computed with Descartes' factorisation into two quadratics, in complex
+     * arithmetic. In both cases, the resolvent cubic root is chosen to avoid cancellation, and the roots are
+     * polished with Newton's method on the original coefficients.
+     *
+     * @tparam RT The desired return type. If not specified, the function will return roots with
+     * the same type as the polynomial value type.
+     * @param poly The input polynomial. Must be a quartic polynomial.
+     * @param tolerance The tolerance used to determine if the imaginary part of a root is sufficiently small
+     * for the root to be considered real. Defaults to nxx::EPS.
+     * @return A vector of roots in the specified return type, or a NumerixxError if the leading coefficient
+     * is zero. If RT is a floating point type, only real roots will be returned, in increasing order.
+     *
+     * @throws NumerixxError if the input polynomial is not quartic.
+     *
+     * @note As for quadratic() and cubic(), real roots are returned for complex roots whose imaginary part is
+     * smaller than the square root of the tolerance, which is where multiple real roots usually end up.
+     */
+    template< typename RT = void >
+    inline auto quartic(IsPolynomial auto poly, typename PolynomialTraits< decltype(poly) >::fundamental_type tolerance = nxx::EPS)
+    {
+        impl::validateTolerance(tolerance);
+        impl::validatePolynomialOrder(poly.order(), 4ull);
 
-        return EXPECTED_T(impl::sortRoots< RETURN_T >(roots, tolerance));
+        using POLY_T     = PolynomialTraits< decltype(poly) >;
+        using VALUE_T    = typename POLY_T::value_type;
+        using FLOAT_T    = typename POLY_T::fundamental_type;
+        using COMPLEX_T  = std::complex< FLOAT_T >;
+        using RETURN_T   = std::conditional_t< std::same_as< RT, void >, VALUE_T, RT >;
+        using EXPECTED_T = tl::expected< std::vector< RETURN_T >, NumerixxError >;
+
+        const auto& coeffs = poly.coefficients();
+        const auto  lead   = coeffs[4];
+        if (lead == VALUE_T(0)) return EXPECTED_T(tl::unexpected(NumerixxError("Quartic polynomial is ill formed.")));
+
+        const VALUE_T d = coeffs[0] / lead;
+        const VALUE_T c = coeffs[1] / lead;
+        const VALUE_T b = coeffs[2] / lead;
+        const VALUE_T a = coeffs[3] / lead;
+
+        // ===== Real roots of a real quartic: no complex arithmetic is involved.
+        if constexpr (std::floating_point< VALUE_T > && std::floating_point< RETURN_T >) {
+            std::array< FLOAT_T, 4 > re;
+            std::array< FLOAT_T, 4 > im;
+            impl::quarticRealRoots(d, c, b, a, re, im);
+
+            std::vector< RETURN_T > roots;
+            roots.reserve(4);
+            for (std::size_t i = 0; i < 4; ++i)
+                if (std::abs(im[i]) < std::sqrt(tolerance)) roots.push_back(re[i]);
+            std::sort(roots.begin(), roots.end());
+            return EXPECTED_T(std::move(roots));
+        }
+
+        const auto               found = impl::quarticRoots< COMPLEX_T >(d, c, b, a);
+        std::vector< COMPLEX_T > roots(found.begin(), found.end());
+        return EXPECTED_T(impl::sortRoots< RETURN_T >(std::move(roots), tolerance));
     }
 
     /**
@@ -307,125 +578,469 @@ namespace nxx::poly
      *
      * @param poly A polynomial, which should satisfy the poly::IsPolynomial concept.
      * @param guess An optional initial guess for a root of the polynomial. Defaults to 1.0.
+     * @param tolerance The convergence tolerance. Defaults to nxx::EPS.
+     * @param max_iterations The maximum number of iterations. Defaults to nxx::MAXITER.
+     * @param seed The seed of the sequence used to perturb the iteration every 10 steps. The sequence is
+     * counter based, so the same arguments always give the same root.
      *
      * @return An approximate root of the polynomial as a std::complex. Even if the polynomial is real,
      * the root may be complex due to the nature of the Laguerre's method.
      *
-     * @note The function calculates the first and second derivatives of the input polynomial to perform the
-     * Laguerre's method iterations.
+     * @note The polynomial and its first and second derivatives are evaluated in a single extended Horner
+     * sweep per iteration, so no derivative polynomials are constructed.
      * @note The Laguerre's method is an iterative root-finding technique that converges rapidly for most
      * polynomials. However, it may fail to converge for certain ill-conditioned polynomials. In such cases,
      * using a different root-finding method may be necessary.
      */
     template< typename POLY >
     requires IsPolynomial< POLY >
-    inline auto laguerre(POLY                                                                          poly,
-                         std::complex< typename PolynomialTraits< decltype(poly) >::fundamental_type > guess          = 0.0,
-                         typename PolynomialTraits< decltype(poly) >::fundamental_type                 tolerance      = nxx::EPS,
-                         int                                                                           max_iterations = nxx::MAXITER)
+    inline auto laguerre(const POLY&                                                         poly,
+                         std::complex< typename PolynomialTraits< POLY >::fundamental_type > guess          = 0.0,
+                         typename PolynomialTraits< POLY >::fundamental_type                 tolerance      = nxx::EPS,
+                         int                                                                 max_iterations = nxx::MAXITER,
+                         std::uint64_t                                                       seed = detail::LAGUERRE_DEFAULT_SEED)
     {
         impl::validateTolerance(tolerance);
         impl::validateMaxIterations(max_iterations);
         impl::validatePolynomialOrder(poly.order(), 4ull);
 
         // Define type aliases for readability
-        using POLY_T     = PolynomialTraits< decltype(poly) >;
+        using POLY_T     = PolynomialTraits< POLY >;
         using FLOAT_T    = typename POLY_T::fundamental_type;
         using COMPLEX_T  = std::complex< FLOAT_T >;
         using EXPECTED_T = tl::expected< std::vector< COMPLEX_T >, NumerixxError >;
-        using OPTIONAL_T = std::optional< COMPLEX_T >;
-
-        const COMPLEX_T order = static_cast< FLOAT_T >(poly.order());
 
-        // Define a lambda function for computing the Laguerre step.
-        auto laguerrestep = [&](COMPLEX_T g_param, COMPLEX_T h_param) -> OPTIONAL_T {
-            const COMPLEX_T arg = std::sqrt((order - COMPLEX_T(1)) * (order * h_param - g_param * g_param));
-            const COMPLEX_T den = (abs(g_param + arg) > abs(g_param - arg) ? (g_param + arg) : (g_param - arg));
-            return (abs(den) < nxx::EPS ? OPTIONAL_T(std::nullopt) : OPTIONAL_T(order / den));
-        };
+        // Find the root; the perturbations are drawn from a counter based sequence, so the result is reproducible.
+        const auto evaluate = [&poly](const COMPLEX_T& z) { return poly.template evaluateWithDerivatives< 2 >(z); };
+        const auto found    = detail::laguerreIterate(evaluate, poly.order(), guess, tolerance, max_iterations, seed, 0);
+        if (!found) return EXPECTED_T(tl::unexpected(NumerixxError("Maximum number of iterations reached.")));
+        COMPLEX_T root = *found;
 
-        // Initialize the root with the guess
-        COMPLEX_T  root = guess;
-        COMPLEX_T  G;
-        COMPLEX_T  H;
-        OPTIONAL_T step;
+        // ===== Polish the root on the original polynomial using Newton's method
+        const auto polished_root = impl::newtonPolish(poly, root, tolerance / 10, max_iterations);
+        if (polished_root) root = *polished_root;
 
-        // Get function objects for the first and second derivatives of the polynomial
-        auto d1poly = derivativeOf(poly);
-        auto d2poly = derivativeOf(d1poly);
+        // Return the root
+        return EXPECTED_T(std::vector { root });
+    }
 
-        // Initialize a random number generator to perturb the step size every 10 iterations.
-        std::random_device                        rd;
-        std::mt19937                              mt(rd());
-        std::uniform_real_distribution< FLOAT_T > dist(0.0, 1.0);
+    /**
+     * @brief Finds all roots of a polynomial simultaneously, using the Aberth–Ehrlich method.
+     *
+     * The initial estimates are placed on circles whose radii are derived from the Newton polygon of the
+     * coefficients (Bini's strategy), and all estimates are then refined together. As no deflation is
+     * involved, the accuracy does not degrade with the order of the polynomial. The corrections of the
+     * roots within one sweep are independent, and are computed in parallel for high orders when OpenMP
+     * is enabled.
+     *
+     * @param poly A polynomial, which should satisfy the poly::IsPolynomial concept.
+     * @param tolerance The convergence tolerance on the root corrections. Defaults to nxx::EPS.
+     * @param max_iterations The maximum number of sweeps. Defaults to nxx::MAXITER.
+     *
+     * @return A tl::expected holding all roots of the polynomial as std::complex, in no particular order,
+     * or a NumerixxError if the iteration did not converge.
+     */
+    template< typename POLY >
+    requires IsPolynomial< POLY >
+    inline auto aberth(const POLY&                                         poly,
+                       typename PolynomialTraits< POLY >::fundamental_type tolerance      = nxx::EPS,
+                       int                                                 max_iterations = nxx::MAXITER)
+    {
+        impl::validateTolerance(tolerance);
+        impl::validateMaxIterations(max_iterations);
+        impl::validatePolynomialOrder(poly.order(), 1ull);
 
-        // Perform the Laguerre iterations.
-        int i = 0;
-        while (true) {
-            // If the absolute value of the polynomial evaluated at the root is less than the tolerance, return the root.
-            if (abs(poly(root)) < tolerance) break;
+        // Define type aliases for readability
+        using FLOAT_T    = typename PolynomialTraits< POLY >::fundamental_type;
+        using COMPLEX_T  = std::complex< FLOAT_T >;
+        using EXPECTED_T = tl::expected< std::vector< COMPLEX_T >, NumerixxError >;
 
-            // Return an error if the maximum number of iterations is reached.
-            if (i >= max_iterations) return EXPECTED_T(tl::unexpected(NumerixxError("Maximum number of iterations reached.")));
+        const std::vector< COMPLEX_T > coeffs(poly.begin(), poly.end());
+        std::vector< COMPLEX_T >       roots(poly.order());
 
-            // Calculate G and H for the Laguerre step
-            G    = d1poly(root) / poly(root);
-            H    = G * G - d2poly(root) / poly(root);
-            step = laguerrestep(G, H);
+        detail::aberthInitialGuesses(std::span< const COMPLEX_T >(coeffs), std::span< COMPLEX_T >(roots));
+        if (!detail::aberthIterate(std::span< const COMPLEX_T >(coeffs), std::span< COMPLEX_T >(roots), tolerance, max_iterations))
+            return EXPECTED_T(tl::unexpected(NumerixxError("Maximum number of iterations reached.")));
 
-            // If the step is invalid, use a small value.
-            if (!step) step = OPTIONAL_T(root * 0.1);
+        return EXPECTED_T(std::move(roots));
+    }
 
-            // If the step is below the tolerance, stop.
-            if (abs(*step) < tolerance) break;
+    /**
+     * @brief Finds all roots of a polynomial as the eigenvalues of its companion matrix, using LAPACK.
+     *
+     * The companion matrix is balanced and its eigenvalues are computed by the Hessenberg QR algorithm
+     * (xGEBAL and xHSEQR). If all coefficients are real, the real variants of the routines are used, so
+     * complex roots come in exact conjugate pairs. The cost is O(n^3) and O(n^2) memory, but the method is
+     * backward stable, and its accuracy does not depend on deflation.
+     *
+     * @param poly A polynomial, which should satisfy the poly::IsPolynomial concept. The coefficients must be
+     * based on float or double.
+     *
+     * @return A tl::expected holding all roots of the polynomial as std::complex, in no particular order,
+     * or a NumerixxError if the QR algorithm did not converge.
+     */
+    template< typename POLY >
+    requires IsPolynomial< POLY > && detail::IsLapackType< typename PolynomialTraits< POLY >::fundamental_type >
+    inline auto companionsolve(const POLY& poly)
+    {
+        impl::validatePolynomialOrder(poly.order(), 1ull);
 
-            // Perturb the step size every 10 iterations.
-            if (i % 10 == 0) *step = dist(mt);
+        // Define type aliases for readability
+        using VALUE_T    = typename PolynomialTraits< POLY >::value_type;
+        using FLOAT_T    = typename PolynomialTraits< POLY >::fundamental_type;
+        using COMPLEX_T  = std::complex< FLOAT_T >;
+        using EXPECTED_T = tl::expected< std::vector< COMPLEX_T >, NumerixxError >;
 
-            // Update the root
-            root = root - *step;
+        std::vector< COMPLEX_T > roots(poly.order());
+        bool                     converged;
 
-            // Increment the iteration counter
-            ++i;
+        // ===== Complex polynomials with real coefficients are solved using real arithmetic.
+        if constexpr (IsComplex< VALUE_T >) {
+            if (std::all_of(poly.begin(), poly.end(), [](const auto& coeff) { return coeff.imag() == 0; })) {
+                std::vector< FLOAT_T > coeffs(poly.order() + 1);
+                std::transform(poly.begin(), poly.end(), coeffs.begin(), [](const auto& coeff) { return coeff.real(); });
+                converged = detail::companionRoots(std::span< const FLOAT_T >(coeffs), std::span< COMPLEX_T >(roots));
+            }
+            else {
+                const std::vector< COMPLEX_T > coeffs(poly.begin(), poly.end());
+                converged = detail::companionRoots(std::span< const COMPLEX_T >(coeffs), std::span< COMPLEX_T >(roots));
+            }
+        }
+        else {
+            const std::vector< FLOAT_T > coeffs(poly.begin(), poly.end());
+            converged = detail::companionRoots(std::span< const FLOAT_T >(coeffs), std::span< COMPLEX_T >(roots));
         }
 
-        // ===== Polish the root on the original polynomial using Newton's method
-        const auto polished_root = roots::fdfsolve< roots::Newton >(poly, derivativeOf(poly), root, tolerance / 10, max_iterations);
-        if (polished_root) root = *polished_root;
+        if (!converged) return EXPECTED_T(tl::unexpected(NumerixxError("The QR algorithm failed to converge.")));
+        return EXPECTED_T(std::move(roots));
+    }
 
-        // Return the root
-        return EXPECTED_T(std::vector { root });
+    /**
+     * @brief Finds the real roots of a polynomial with real coefficients, using real-root isolation.
+     *
+     * The positive and negative roots are isolated using Descartes' rule of signs with Vincent–Collins–Akritas
+     * bisection, and each isolated root is refined using Ridder's method (nxx::roots::Ridder). Complex roots
+     * are never computed, and only real arithmetic is used. Multiple roots, and roots closer together than
+     * the tolerance, are reported as a cluster at its midpoint, repeated by the number of roots in it.
+     * The isolation of the positive and negative roots, and the refinement of the isolated roots, run in
+     * parallel for high orders when OpenMP is enabled.
+     *
+     * @param poly A polynomial with real coefficients, which should satisfy the poly::IsPolynomial concept.
+     * @param tolerance The accuracy of the roots. Defaults to nxx::EPS.
+     * @param max_iterations The maximum number of iterations for refining each root. Defaults to nxx::MAXITER.
+     *
+     * @return A tl::expected holding the real roots of the polynomial in ascending order, repeated by
+     * multiplicity, or a NumerixxError if a root could not be refined within the maximum number of iterations.
+     *
+     * @note Rounding errors in the coefficients may split a multiple root into complex roots very close to the
+     * real axis. Like filtering the complex roots (see polysolve()), which keeps complex roots whose imaginary
+     * part is below the square root of the tolerance, these are reported as a cluster of real roots, located
+     * to about the square root of the tolerance.
+     */
+    template< typename POLY >
+    requires IsPolynomial< POLY > && std::floating_point< typename PolynomialTraits< POLY >::value_type >
+    inline auto realroots(const POLY&                                         poly,
+                          typename PolynomialTraits< POLY >::fundamental_type tolerance      = nxx::EPS,
+                          int                                                 max_iterations = nxx::MAXITER)
+    {
+        impl::validateTolerance(tolerance);
+        impl::validateMaxIterations(max_iterations);
+        impl::validatePolynomialOrder(poly.order(), 1ull);
+
+        // Define type aliases for readability
+        using FLOAT_T    = typename PolynomialTraits< POLY >::fundamental_type;
+        using EXPECTED_T = tl::expected< std::vector< FLOAT_T >, NumerixxError >;
+
+        // The leading coefficient must be non-zero for the root bound.
+        std::vector< FLOAT_T > coeffs(poly.begin(), poly.end());
+        while (coeffs.size() > 1 && coeffs.back() == 0) coeffs.pop_back();
+        if (coeffs.size() == 1) return EXPECTED_T(std::vector< FLOAT_T > {});
+
+        auto roots = detail::realRoots(std::span< const FLOAT_T >(coeffs), tolerance, max_iterations);
+        if (!roots) return EXPECTED_T(tl::unexpected(NumerixxError("Maximum number of iterations reached.")));
+
+        return EXPECTED_T(std::move(*roots));
     }
 
     /**
-     * @brief Solves a polynomial equation using Laguerre's method and the quadratic formula, returning
-     * either complex or real roots depending on the RT template parameter.
+     * @brief Root finding strategy for polysolve, using Laguerre's method with deflation.
      *
-     * This function accepts a polynomial as input and solves it using a combination of Laguerre's method
-     * and the quadratic formula. If the polynomial is of degree higher than 2, the Laguerre method is used
-     * to find the roots. For quadratics, the quadratic formula is used. The roots can be returned as complex
-     * or real numbers depending on the RT template parameter.
+     * One root is found at a time, polished against the original polynomial, and removed by deflation,
+     * until a polynomial of order 4 or less remains, which is solved in closed form (see quartic()). Quartics
+     * are therefore solved without iteration.
+     *
+     * The solver keeps a workspace for the deflated polynomial, which is reused between calls, and the
+     * iterations are perturbed using a seeded, counter based sequence (see laguerre()). A solver object can
+     * therefore be reused across polysolve calls, and solving the same polynomial with the same seed always
+     * gives bitwise identical roots. Once the workspace has grown to the order of the polynomial, the
+     * overload of solve() writing to a span of roots allocates nothing.
+     */
+    class LaguerreSolver
+    {
+        std::uint64_t m_seed { detail::LAGUERRE_DEFAULT_SEED }; /**< The seed of the perturbation sequence. */
+
+        /**< The coefficients of the deflated polynomial, for each floating point type. */
+        std::tuple< std::vector< std::complex< float > >, std::vector< std::complex< double > >, std::vector< std::complex< long double > > >
+            m_workspace {};
+
+    public:
+        static constexpr bool IsPolySolver = true;
+
+        /**
+         * @brief Constructs a solver using the default seed.
+         */
+        LaguerreSolver() = default;
+
+        /**
+         * @brief Constructs a solver using the given seed for the perturbation sequence.
+         */
+        explicit LaguerreSolver(std::uint64_t seed)
+            : m_seed { seed }
+        {}
+
+        /**
+         * @brief Sets the seed of the perturbation sequence.
+         */
+        void seed(std::uint64_t seed) { m_seed = seed; }
+
+        /**
+         * @brief Returns the seed of the perturbation sequence.
+         */
+        [[nodiscard]]
+        std::uint64_t seed() const
+        {
+            return m_seed;
+        }
+
+        /**
+         * @brief Finds all roots of a polynomial, writing them to the given range.
+         *
+         * @param original The polynomial to solve.
+         * @param roots The range for the roots; its size must be the order of the polynomial.
+         * @param tolerance The convergence tolerance.
+         * @param max_iterations The maximum number of iterations for each root.
+         * @return The range of roots, in the order they were found, or a NumerixxError if an iteration failed.
+         *
+         * @throws NumerixxError if the size of the range of roots differs from the order of the polynomial.
+         */
+        template< typename FLOAT_T >
+        auto solve(const Polynomial< std::complex< FLOAT_T > >& original,
+                   std::span< std::complex< FLOAT_T > >         roots,
+                   FLOAT_T                                      tolerance,
+                   int max_iterations) -> tl::expected< std::span< std::complex< FLOAT_T > >, NumerixxError >
+        {
+            using COMPLEX_T  = std::complex< FLOAT_T >;
+            using EXPECTED_T = tl::expected< std::span< COMPLEX_T >, NumerixxError >;
+
+            if (roots.size() != original.order()) throw NumerixxError("The number of roots must equal the polynomial order.");
+
+            auto& polynomial = std::get< std::vector< COMPLEX_T > >(m_workspace);
+            polynomial.assign(original.begin(), original.end());
+
+            // Loop to solve and deflate the polynomial in place (O(n), no allocation) until its order is reduced to 4 or less.
+            std::size_t order = original.order();
+            std::size_t found = 0;
+            for (; order > 4; --order, ++found) {
+                const auto coeffs   = std::span< const COMPLEX_T >(polynomial.data(), order + 1);
+                const auto evaluate = [coeffs](const COMPLEX_T& z) { return detail::hornerDerivatives< 2 >(coeffs, z); };
+                const auto root     = detail::laguerreIterate(evaluate, order, COMPLEX_T(1.0), tolerance, max_iterations, m_seed, found);
+                if (!root) [[unlikely]]
+                    return EXPECTED_T(tl::unexpected(NumerixxError("Error: Root-finding failed.")));
+
+                // Polish the root on the original polynomial, and deflate.
+                const auto polished_root = impl::newtonPolish(original, *root, tolerance / 10, max_iterations);
+                roots[found]             = polished_root ? *polished_root : *root;
+                detail::deflateLinear(std::span< COMPLEX_T >(polynomial.data(), order + 1), roots[found]);
+            }
+
+            // Solve the remaining linear, quadratic, cubic or quartic polynomial in closed form.
+            switch (order) {
+                case 1:
+                    roots[found] = -polynomial[0] / polynomial[1];
+                    break;
+                case 2: {
+                    const auto pair = impl::quadraticRoots< COMPLEX_T >(polynomial[0], polynomial[1], polynomial[2], tolerance);
+                    if (!pair) [[unlikely]]
+                        return EXPECTED_T(tl::unexpected(NumerixxError("Error: Root-finding failed.")));
+                    std::copy(pair->begin(), pair->end(), roots.begin() + static_cast< std::ptrdiff_t >(found));
+                    break;
+                }
+                case 3: {
+                    const COMPLEX_T lead   = polynomial[3];
+                    const auto      triple = impl::cubicRoots< COMPLEX_T >(polynomial[0] / lead, polynomial[1] / lead, polynomial[2] / lead);
+                    std::copy(triple.begin(), triple.end(), roots.begin() + static_cast< std::ptrdiff_t >(found));
+                    break;
+                }
+                default: {
+                    const COMPLEX_T lead      = polynomial[4];
+                    const auto      quadruple = impl::quarticRoots< COMPLEX_T >(polynomial[0] / lead,
+                                                                           polynomial[1] / lead,
+                                                                           polynomial[2] / lead,
+                                                                           polynomial[3] / lead);
+                    std::copy(quadruple.begin(), quadruple.end(), roots.begin() + static_cast< std::ptrdiff_t >(found));
+                    break;
+                }
+            }
+
+            return EXPECTED_T(roots);
+        }
+
+        /**
+         * @brief Finds all roots of a polynomial. Only the returned vector is allocated.
+         */
+        template< typename FLOAT_T >
+        auto solve(const Polynomial< std::complex< FLOAT_T > >& original, FLOAT_T tolerance, int max_iterations)
+            -> tl::expected< std::vector< std::complex< FLOAT_T > >, NumerixxError >
+        {
+            using COMPLEX_T  = std::complex< FLOAT_T >;
+            using EXPECTED_T = tl::expected< std::vector< COMPLEX_T >, NumerixxError >;
+
+            auto roots  = std::vector< COMPLEX_T >(original.order());
+            auto result = solve(original, std::span< COMPLEX_T >(roots), tolerance, max_iterations);
+            if (!result) [[unlikely]]
+                return EXPECTED_T(tl::unexpected(result.error()));
+            return EXPECTED_T(std::move(roots));
+        }
+    };
+
+    /**
+     * @brief Root finding strategy for polysolve, using the Aberth–Ehrlich method (see aberth()).
+     *
+     * All roots are refined simultaneously, without deflation. This is the better choice for high-order
+     * polynomials, where the deflation errors of LaguerreSolver accumulate.
+     */
+    struct AberthSolver
+    {
+        static constexpr bool IsPolySolver = true;
+
+        template< typename FLOAT_T >
+        auto solve(const Polynomial< std::complex< FLOAT_T > >& original, FLOAT_T tolerance, int max_iterations)
+            -> tl::expected< std::vector< std::complex< FLOAT_T > >, NumerixxError >
+        {
+            return aberth(original, tolerance, max_iterations);
+        }
+    };
+
+    /**
+     * @brief Root finding strategy for polysolve, using the eigenvalues of the companion matrix (see companionsolve()).
+     */
+    struct CompanionSolver
+    {
+        static constexpr bool IsPolySolver = true;
+
+        template< typename FLOAT_T >
+            requires detail::IsLapackType< FLOAT_T >
+        auto solve(const Polynomial< std::complex< FLOAT_T > >& original, FLOAT_T, int)
+            -> tl::expected< std::vector< std::complex< FLOAT_T > >, NumerixxError >
+        {
+            return companionsolve(original);
+        }
+    };
+
+    /**
+     * @brief Root finding strategy for polysolve, finding only the real roots by real-root isolation (see realroots()).
+     *
+     * This strategy only applies when real roots of a polynomial with real coefficients are requested, in
+     * which case polysolve calls solveReal() on the real coefficients, without converting them to complex.
+     */
+    struct RealRootSolver
+    {
+        static constexpr bool IsPolySolver = true;
+
+        template< typename FLOAT_T >
+        auto solveReal(const Polynomial< FLOAT_T >& original, FLOAT_T tolerance, int max_iterations)
+            -> tl::expected< std::vector< FLOAT_T >, NumerixxError >
+        {
+            return realroots(original, tolerance, max_iterations);
+        }
+    };
+
+    /**
+     * @brief Root finding strategy for polysolve, choosing the method based on the polynomial order.
+     *
+     * Polynomials of order below COMPANION_ORDER are solved using LaguerreSolver; polynomials of higher
+     * order are solved using CompanionSolver, whose accuracy does not suffer from repeated deflation. The
+     * default threshold is where the deflation errors of LaguerreSolver start to become noticeable for
+     * polynomials with roots of different magnitudes.
+     * Polynomials with long double based coefficients always use LaguerreSolver, as LAPACK does not
+     * support them. When only the real roots of a polynomial with real coefficients are requested, they
+     * are found by real-root isolation (see RealRootSolver), except for quartics, which are solved in closed
+     * form in real arithmetic (see quartic()).
+     *
+     * @tparam COMPANION_ORDER The polynomial order from which CompanionSolver is used.
+     */
+    template< std::size_t COMPANION_ORDER = 32 >
+    struct AutoSolver
+    {
+        static constexpr bool IsPolySolver = true;
+
+        LaguerreSolver laguerreSolver {}; /**< The Laguerre solver, whose workspace is reused between calls. */
+
+        template< typename FLOAT_T >
+        auto solve(const Polynomial< std::complex< FLOAT_T > >& original, FLOAT_T tolerance, int max_iterations)
+            -> tl::expected< std::vector< std::complex< FLOAT_T > >, NumerixxError >
+        {
+            if constexpr (detail::IsLapackType< FLOAT_T >)
+                if (original.order() >= COMPANION_ORDER) return CompanionSolver {}.solve(original, tolerance, max_iterations);
+            return laguerreSolver.solve(original, tolerance, max_iterations);
+        }
+
+        template< typename FLOAT_T >
+        auto solveReal(const Polynomial< FLOAT_T >& original, FLOAT_T tolerance, int max_iterations)
+            -> tl::expected< std::vector< FLOAT_T >, NumerixxError >
+        {
+            if (original.order() == 4 && original.coefficients().back() != 0) return quartic< FLOAT_T >(original, tolerance);
+            return RealRootSolver {}.solveReal(original, tolerance, max_iterations);
+        }
+    };
+
+    /**
+     * @brief Concept checking whether a type is a root finding strategy for polysolve.
+     */
+    template< typename SOLVER >
+    concept IsPolySolver = SOLVER::IsPolySolver;
+
+    /**
+     * @brief Solves a polynomial equation, returning either complex or real roots depending on the RT
+     * template parameter.
+     *
+     * This function accepts a polynomial as input and finds all of its roots using the root finding
+     * strategy given by the SOLVER template parameter. LaguerreSolver uses Laguerre's method with deflation,
+     * and the closed form solutions once the order is reduced to 4 or less. AberthSolver refines all roots
+     * simultaneously using the Aberth–Ehrlich method, and CompanionSolver computes the eigenvalues of the
+     * companion matrix using LAPACK. The default, AutoSolver, uses LaguerreSolver for low orders and
+     * CompanionSolver for high orders. The roots can be returned as complex or real numbers depending on the
+     * RT template parameter. If only real roots of a polynomial with real coefficients are requested, and
+     * the solver provides solveReal() (RealRootSolver and AutoSolver), the real roots are isolated directly,
+     * without complex arithmetic. For polynomials with multiple roots, SquareFreeSolver solves each factor of
+     * the square-free decomposition separately, so all roots solved for are simple. AdaptiveSolver certifies
+     * the roots found by another strategy, and refines only the ill-conditioned ones in higher precision.
      *
      * @tparam RT The desired return type for the roots. Defaults to void, which will return the same type as
      * the polynomial coefficients. If specified, the roots will be of type RT.
+     * @tparam SOLVER The root finding strategy.
      * @param poly A polynomial, which should satisfy the IsPolynomial concept. The input polynomial can have
      * real or complex coefficients.
+     * @param solver The solver object. Stateful solvers, such as LaguerreSolver, keep their workspace and
+     * seed between calls.
+     * @param tolerance The convergence tolerance. Defaults to nxx::EPS.
+     * @param max_iterations The maximum number of iterations. Defaults to nxx::MAXITER.
      *
      * @return A vector containing the roots of the polynomial. If RT is void, the return type will be a
      * vector of complex numbers if the input polynomial has complex coefficients, or a vector of real numbers
      * if the input polynomial has real coefficients. If RT is specified, the return type will be a vector of RT.
      *
-     * @note The implementation uses Laguerre's method for polynomials of degree higher than 2 and the quadratic
-     * formula for quadratics. The Laguerre method is an iterative root-finding technique that converges rapidly
-     * for most polynomials. A polishing step is performed after finding each root using the Laguerre method to
+     * @note The Laguerre method is an iterative root-finding technique that converges rapidly for most
+     * polynomials. A polishing step is performed after finding each root using the Laguerre method to
      * improve the accuracy of the root.
      * @note The returned roots are either complex or real, depending on the provided RT template parameter. If
      * the return type is complex, all roots will be returned. If the return type is real, only roots with
      * imaginary parts smaller than the specified tolerance will be returned.
      */
     // Template function to solve polynomial equations of various orders.
-    template< typename RT = void >
+    template< typename RT = void, IsPolySolver SOLVER >
     inline auto polysolve(IsPolynomial auto                                             poly,
+                          SOLVER&                                                       solver,
                           typename PolynomialTraits< decltype(poly) >::fundamental_type tolerance      = nxx::EPS,
                           int                                                           max_iterations = nxx::MAXITER)
     {
@@ -442,54 +1057,43 @@ namespace nxx::poly
         using RETURN_T   = std::conditional_t< std::same_as< RT, void >, VALUE_T, RT >;    // Return type.
         using EXPECTED_T = tl::expected< std::vector< RETURN_T >, NumerixxError >;         // Expected return type.
 
-        // Convert input polynomial to complex type and initialize a vector for roots.
-        auto polynomial = Polynomial< COMPLEX_T >(std::vector< COMPLEX_T > { poly.begin(), poly.end() });
-        auto original   = Polynomial< COMPLEX_T >(std::vector< COMPLEX_T > { poly.begin(), poly.end() });
-        auto roots      = std::vector< COMPLEX_T > {};
-
-        // Lambda function to find roots based on the order of the polynomial.
-        auto findRoots = [&](Polynomial< COMPLEX_T > p) {
-            switch (p.order()) {
-                case 1:    // Linear polynomial.
-                    return linear< COMPLEX_T >(p);
-                case 2:    // Quadratic polynomial.
-                    return quadratic< COMPLEX_T >(p);
-                case 3:    // Cubic polynomial.
-                    return cubic< COMPLEX_T >(p);
-                default:    // Higher-order polynomials.
-                    return laguerre(p, 1.0, tolerance, max_iterations);
-            }
-        };
-
-        // Loop to solve and deflate the polynomial until its order is reduced to 3 or less.
-        size_t order;
-        do {
-            order                  = polynomial.order();       // Current order of the polynomial.
-            const auto roots_found = findRoots(polynomial);    // Find roots.
-
-            // Check if roots are found, return an error if not.
-            if (!roots_found) [[unlikely]]
-                return EXPECTED_T(tl::unexpected(NumerixxError("Error: Root-finding failed.")));
-
-            // Insert found roots into the roots vector.
-            roots.insert(roots.end(), (*roots_found).begin(), (*roots_found).end());
-
-            // If its order is greater than 3, polish the root an deflate the polynomial.
-            if (polynomial.order() > 3) {
-                const auto polished_root = nxx::roots::fdfsolve< roots::Newton >(original,
-                                                                                 derivativeOf(original),
-                                                                                 roots.back(),
-                                                                                 tolerance / 10,
-                                                                                 max_iterations);
-                if (polished_root) roots.back() = *polished_root;
-
-                polynomial /= Polynomial< COMPLEX_T > { -roots.back(), 1.0 };
-            }
+        // Real roots of a real polynomial: use real-root isolation, if the solver supports it.
+        if constexpr (std::floating_point< RETURN_T > && std::floating_point< VALUE_T > &&
+                      requires(const Polynomial< FLOAT_T >& p) { solver.solveReal(p, tolerance, max_iterations); }) {
+            const auto polynomial = Polynomial< FLOAT_T >(std::vector< FLOAT_T > { poly.begin(), poly.end() });
+            auto       roots      = solver.solveReal(polynomial, tolerance, max_iterations);
+            if (!roots) [[unlikely]]
+                return EXPECTED_T(tl::unexpected(roots.error()));
+            return EXPECTED_T(std::vector< RETURN_T >(roots->begin(), roots->end()));
+        }
+        else {
+            static_assert(requires(const Polynomial< COMPLEX_T >& p) { solver.solve(p, tolerance, max_iterations); },
+                          "The solver only supports real roots of polynomials with real coefficients.");
+
+            // Convert input polynomial to complex type, and find the roots with the chosen strategy.
+            const auto polynomial = Polynomial< COMPLEX_T >(std::vector< COMPLEX_T > { poly.begin(), poly.end() });
+            auto       roots      = solver.solve(polynomial, tolerance, max_iterations);
+            if (!roots) [[unlikely]]
+                return EXPECTED_T(tl::unexpected(roots.error()));
+
+            // Sort the roots and return them as the expected return type.
+            return EXPECTED_T(impl::sortRoots< RETURN_T >(std::move(*roots), tolerance));
         }
-        while (order > 3);    // Continue until the polynomial is of order 3 or less.
+    }
 
-        // Sort the roots and return them as the expected return type.
-        return EXPECTED_T(impl::sortRoots< RETURN_T >(roots, tolerance));
+    /**
+     * @brief Solves a polynomial equation using a default constructed solver of type SOLVER.
+     *
+     * See the overload taking a solver object for details. Pass a solver object instead to reuse its
+     * workspace across calls, or to seed LaguerreSolver.
+     */
+    template< typename RT = void, IsPolySolver SOLVER = AutoSolver<> >
+    inline auto polysolve(IsPolynomial auto                                             poly,
+                          typename PolynomialTraits< decltype(poly) >::fundamental_type tolerance      = nxx::EPS,
+                          int                                                           max_iterations = nxx::MAXITER)
+    {
+        auto solver = SOLVER {};
+        return polysolve< RT >(std::move(poly), solver, tolerance, max_iterations);
     }
 
 }    // namespace nxx::poly
@@ -0,0 +1,412 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_STATICPOLYNOMIAL_HPP
+#define NUMERIXX_STATICPOLYNOMIAL_HPP
+
+// ===== Numerixx Includes
+#include "PolyEvaluation.hpp"
+#include "Polynomial.hpp"
+#include <Concepts.hpp>
+#include <Error.hpp>
+
+// ===== External Includes
+#include <tl/expected.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <span>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+namespace nxx::poly
+{
+    /*
+     * Specialization of the PolynomialTraits class for StaticPolynomial objects with floating point coefficients.
+     */
+    template< typename T, std::size_t N >
+        requires nxx::IsFloat< T >
+    struct PolynomialTraits< StaticPolynomial< T, N > >
+    {
+        using value_type       = T;
+        using fundamental_type = T;
+    };
+
+    /*
+     * Specialization of the PolynomialTraits class for StaticPolynomial objects with complex coefficients.
+     */
+    template< typename T, std::size_t N >
+        requires nxx::IsFloat< T >
+    struct PolynomialTraits< StaticPolynomial< std::complex< T >, N > >
+    {
+        using value_type       = std::complex< T >;
+        using fundamental_type = T;
+    };
+
+    /**
+     * @brief A class representing a polynomial of fixed order N, with coefficients of type T.
+     *
+     * StaticPolynomial is the compile-time counterpart of Polynomial. The N + 1 coefficients are stored
+     * in a std::array, so no memory is allocated, and evaluation is constexpr and fully unrolled. Sums,
+     * differences, products and derivatives of static polynomials are static polynomials as well, with
+     * the order computed at compile time. When combined with a (dynamic) Polynomial, or when divided,
+     * the result is a Polynomial.
+     *
+     * Unlike Polynomial, trailing zero coefficients are not trimmed, as the order is part of the type.
+     * The leading coefficient should therefore be non-zero when the polynomial is passed to the root
+     * finding functions that rely on the order, such as quadratic() and cubic(). polysolve() handles a
+     * zero leading coefficient, as it converts to a Polynomial internally.
+     *
+     * @tparam T The type of the polynomial coefficients. This must be a floating point type or a complex type.
+     * @tparam N The order of the polynomial.
+     */
+    template< typename T, std::size_t N >
+        requires nxx::IsFloat< T > || IsComplex< T >
+    class StaticPolynomial final
+    {
+        std::array< T, N + 1 > m_coefficients {}; /**< The internal store of polynomial coefficients. */
+
+    public:
+        /**
+         * @brief The type of the polynomial coefficients.
+         */
+        using value_type = T;
+
+        /**
+         * @brief The type of the const iterator over the coefficients.
+         */
+        using iterator = typename std::array< T, N + 1 >::const_iterator;
+
+        /**
+         * @brief The order of the polynomial, available at compile time.
+         */
+        static constexpr std::size_t static_order = N;
+
+        /**
+         * @brief Constructs a zero polynomial of order N.
+         */
+        constexpr StaticPolynomial() = default;
+
+        /**
+         * @brief Constructs a polynomial from an array of N + 1 coefficients.
+         *
+         * @param coefficients The coefficients in increasing order of degree, i.e. {a0, a1, ..., aN}.
+         */
+        constexpr explicit StaticPolynomial(const std::array< T, N + 1 >& coefficients)
+            : m_coefficients { coefficients }
+        {}
+
+        /**
+         * @brief Constructs a polynomial from N + 1 individual coefficients.
+         *
+         * @param coefficients The coefficients in increasing order of degree, i.e. a0, a1, ..., aN.
+         */
+        template< typename... ARGS >
+            requires(sizeof...(ARGS) == N + 1) && (std::convertible_to< ARGS, T > && ...)
+        constexpr StaticPolynomial(ARGS... coefficients)
+            : m_coefficients { static_cast< T >(coefficients)... }
+        {}
+
+        /**
+         * @brief Evaluates the polynomial at a given value.
+         *
+         * Horner's method is unrolled at compile time, and the function can be used in constant expressions.
+         * No check for non-finite results is performed; use evaluate() for that.
+         *
+         * @param value The value to evaluate the polynomial at.
+         * @return The value of the polynomial at the specified input value.
+         */
+        template< typename U >
+            requires std::convertible_to< U, T > || nxx::IsFloat< U > || IsComplex< U >
+        constexpr auto operator()(U value) const
+        {
+            using TYPE = std::common_type_t< T, U >;
+            const TYPE x = static_cast< TYPE >(value);
+
+            return [&]< std::size_t... I >(std::index_sequence< I... >) {
+                TYPE result = static_cast< TYPE >(m_coefficients[N]);
+                ((result = detail::fmadd(result, x, static_cast< TYPE >(m_coefficients[N - 1 - I]))), ...);
+                return result;
+            }(std::make_index_sequence< N > {});
+        }
+
+        /**
+         * @brief Evaluates the polynomial at a given point, checking the result.
+         *
+         * This is the counterpart of Polynomial::evaluate(), and returns an error if the result is non-finite.
+         *
+         * @param value The point at which to evaluate the polynomial.
+         * @return A tl::expected object holding the result, or an error.
+         */
+        template< typename U >
+            requires std::convertible_to< U, T > || nxx::IsFloat< U > || IsComplex< U >
+        [[nodiscard]]
+        auto evaluate(U value) const
+            -> tl::expected< std::common_type_t< T, U >, Error< detail::PolyErrorData< std::common_type_t< T, U > > > >
+        {
+            using TYPE      = std::common_type_t< T, U >;
+            using PolyError = Error< detail::PolyErrorData< TYPE > >;
+
+            const TYPE result = (*this)(value);
+            if (!detail::isFinite(result)) [[unlikely]]
+                return tl::unexpected(PolyError("Polynomial error",
+                                                nxx::NumerixxErrorType::Poly,
+                                                { .details      = "Polynomial evaluation failed; non-finite result.",
+                                                  .coefficients = { m_coefficients.begin(), m_coefficients.end() },
+                                                  .arg          = value,
+                                                  .result       = result }));
+
+            return result;
+        }
+
+        /**
+         * @brief Evaluates the polynomial and its first K derivatives at a given point, in a single pass.
+         *
+         * @tparam K The number of derivatives to compute.
+         * @tparam STRATEGY The evaluation strategy; Horner (the default) or CompensatedHorner.
+         * @param value The point at which to evaluate the polynomial.
+         * @return A std::array holding p(x), p'(x), ..., p^(K)(x).
+         */
+        template< std::size_t K, IsEvaluationStrategy STRATEGY = Horner, typename U >
+            requires std::convertible_to< U, T > || nxx::IsFloat< U > || IsComplex< U >
+        [[nodiscard]]
+        constexpr auto evaluateWithDerivatives(U value) const
+        {
+            using TYPE = std::common_type_t< T, U >;
+            return STRATEGY::template evaluateWithDerivatives< K >(std::span< const T >(m_coefficients), static_cast< TYPE >(value));
+        }
+
+        /**
+         * @brief Gets the coefficients of the polynomial.
+         *
+         * @return A constant reference to the array of coefficients.
+         */
+        [[nodiscard]]
+        constexpr const std::array< T, N + 1 >& coefficients() const
+        {
+            return m_coefficients;
+        }
+
+        /**
+         * @brief Returns the order of the polynomial, i.e. N.
+         */
+        [[nodiscard]]
+        static constexpr std::size_t order()
+        {
+            return N;
+        }
+
+        /**
+         * @brief Converts the polynomial to a (dynamic) Polynomial, trimming any trailing zeros.
+         */
+        [[nodiscard]]
+        Polynomial< T > toPolynomial() const
+        {
+            return Polynomial< T >(m_coefficients);
+        }
+
+        /**
+         * @brief Adds a static polynomial of the same or lower order to this polynomial.
+         */
+        template< typename U, std::size_t M >
+            requires(M <= N) && (nxx::IsFloat< U > || (IsComplex< T > && IsComplex< U >))
+        constexpr StaticPolynomial& operator+=(const StaticPolynomial< U, M >& rhs)
+        {
+            for (std::size_t i = 0; i <= M; ++i) m_coefficients[i] += rhs.coefficients()[i];
+            return *this;
+        }
+
+        /**
+         * @brief Subtracts a static polynomial of the same or lower order from this polynomial.
+         */
+        template< typename U, std::size_t M >
+            requires(M <= N) && (nxx::IsFloat< U > || (IsComplex< T > && IsComplex< U >))
+        constexpr StaticPolynomial& operator-=(const StaticPolynomial< U, M >& rhs)
+        {
+            for (std::size_t i = 0; i <= M; ++i) m_coefficients[i] -= rhs.coefficients()[i];
+            return *this;
+        }
+
+        /**
+         * @brief Equality operator for static polynomials of the same order.
+         */
+        constexpr bool operator==(const StaticPolynomial& rhs) const = default;
+
+        /**
+         * @brief Outputs the polynomial to an output stream, in the same format as Polynomial.
+         */
+        friend std::ostream& operator<<(std::ostream& os, const StaticPolynomial& p) { return os << p.toPolynomial(); }
+
+        constexpr auto begin() const { return m_coefficients.cbegin(); }
+        constexpr auto cbegin() const { return m_coefficients.cbegin(); }
+        constexpr auto end() const { return m_coefficients.cend(); }
+        constexpr auto cend() const { return m_coefficients.cend(); }
+    };
+
+    /*
+     * Deduction guides for constructing a StaticPolynomial from an array or from individual coefficients.
+     */
+    template< typename T, std::size_t M >
+        requires(M > 0)
+    StaticPolynomial(std::array< T, M >) -> StaticPolynomial< T, M - 1 >;
+
+    template< typename T, typename... ARGS >
+        requires nxx::IsFloat< T > || IsComplex< T >
+    StaticPolynomial(T, ARGS...) -> StaticPolynomial< T, sizeof...(ARGS) >;
+
+    namespace detail
+    {
+        /**
+         * @brief Returns a static polynomial as a Polynomial, and any other polynomial unchanged.
+         *
+         * Used for the operations on a mix of static and dynamic polynomials, which are carried out on
+         * dynamic polynomials.
+         */
+        template< typename POLY >
+            requires IsPolynomial< POLY >
+        decltype(auto) toDynamic(const POLY& poly)
+        {
+            if constexpr (IsStaticPolynomial< POLY >)
+                return poly.toPolynomial();
+            else
+                return (poly);
+        }
+    }    // namespace detail
+
+    /**
+     * @brief Computes the derivative of a static polynomial.
+     *
+     * @param func The polynomial to differentiate. Must be of order one or higher.
+     * @return A StaticPolynomial of order N - 1, holding the derivative.
+     */
+    template< typename T, std::size_t N >
+        requires(N > 0)
+    constexpr auto derivativeOf(const StaticPolynomial< T, N >& func)
+    {
+        using FLOAT_TYPE = typename PolynomialTraits< StaticPolynomial< T, N > >::fundamental_type;
+
+        std::array< T, N > coefficients {};
+        for (std::size_t i = 0; i < N; ++i) coefficients[i] = func.coefficients()[i + 1] * static_cast< FLOAT_TYPE >(i + 1);
+        return StaticPolynomial< T, N - 1 >(coefficients);
+    }
+
+    /**
+     * @brief Converts a StaticPolynomial object to its string representation.
+     */
+    template< typename T, std::size_t N >
+    std::string to_string(const StaticPolynomial< T, N >& p)
+    {
+        std::stringstream ss;
+        ss << p;
+        return ss.str();
+    }
+
+    /**
+     * @brief Adds two static polynomials. The result is a static polynomial of order max(N, M).
+     */
+    template< typename T, std::size_t N, typename U, std::size_t M >
+    constexpr auto operator+(const StaticPolynomial< T, N >& lhs, const StaticPolynomial< U, M >& rhs)
+    {
+        using TYPE = std::common_type_t< T, U >;
+
+        std::array< TYPE, std::max(N, M) + 1 > coeffs {};
+        for (std::size_t i = 0; i <= N; ++i) coeffs[i] += static_cast< TYPE >(lhs.coefficients()[i]);
+        for (std::size_t i = 0; i <= M; ++i) coeffs[i] += static_cast< TYPE >(rhs.coefficients()[i]);
+        return StaticPolynomial< TYPE, std::max(N, M) >(coeffs);
+    }
+
+    /**
+     * @brief Subtracts two static polynomials. The result is a static polynomial of order max(N, M).
+     */
+    template< typename T, std::size_t N, typename U, std::size_t M >
+    constexpr auto operator-(const StaticPolynomial< T, N >& lhs, const StaticPolynomial< U, M >& rhs)
+    {
+        using TYPE = std::common_type_t< T, U >;
+
+        std::array< TYPE, std::max(N, M) + 1 > coeffs {};
+        for (std::size_t i = 0; i <= N; ++i) coeffs[i] += static_cast< TYPE >(lhs.coefficients()[i]);
+        for (std::size_t i = 0; i <= M; ++i) coeffs[i] -= static_cast< TYPE >(rhs.coefficients()[i]);
+        return StaticPolynomial< TYPE, std::max(N, M) >(coeffs);
+    }
+
+    /**
+     * @brief Multiplies two static polynomials. The result is a static polynomial of order N + M.
+     */
+    template< typename T, std::size_t N, typename U, std::size_t M >
+    constexpr auto operator*(const StaticPolynomial< T, N >& lhs, const StaticPolynomial< U, M >& rhs)
+    {
+        using TYPE = std::common_type_t< T, U >;
+
+        std::array< TYPE, N + M + 1 > coeffs {};
+        for (std::size_t i = 0; i <= N; ++i)
+            for (std::size_t j = 0; j <= M; ++j)
+                coeffs[i + j] += static_cast< TYPE >(lhs.coefficients()[i]) * static_cast< TYPE >(rhs.coefficients()[j]);
+        return StaticPolynomial< TYPE, N + M >(coeffs);
+    }
+
+    /*
+     * Operations on a mix of static and dynamic polynomials, and division of static polynomials, are carried
+     * out on dynamic polynomials, and return a Polynomial.
+     */
+    template< typename P1, typename P2 >
+        requires IsPolynomial< P1 > && IsPolynomial< P2 > && (IsStaticPolynomial< P1 > != IsStaticPolynomial< P2 >)
+    auto operator+(const P1& lhs, const P2& rhs)
+    {
+        return detail::toDynamic(lhs) + detail::toDynamic(rhs);
+    }
+
+    template< typename P1, typename P2 >
+        requires IsPolynomial< P1 > && IsPolynomial< P2 > && (IsStaticPolynomial< P1 > != IsStaticPolynomial< P2 >)
+    auto operator-(const P1& lhs, const P2& rhs)
+    {
+        return detail::toDynamic(lhs) - detail::toDynamic(rhs);
+    }
+
+    template< typename P1, typename P2 >
+        requires IsPolynomial< P1 > && IsPolynomial< P2 > && (IsStaticPolynomial< P1 > != IsStaticPolynomial< P2 >)
+    auto operator*(const P1& lhs, const P2& rhs)
+    {
+        return detail::toDynamic(lhs) * detail::toDynamic(rhs);
+    }
+
+    template< typename P1, typename P2 >
+        requires IsPolynomial< P1 > && IsPolynomial< P2 > && (IsStaticPolynomial< P1 > || IsStaticPolynomial< P2 >)
+    auto divide(const P1& lhs, const P2& rhs)
+    {
+        return divide(detail::toDynamic(lhs), detail::toDynamic(rhs));
+    }
+
+}    // namespace nxx::poly
+
+#endif    // NUMERIXX_STATICPOLYNOMIAL_HPP
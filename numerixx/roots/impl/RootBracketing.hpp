@@ -226,17 +226,17 @@ namespace nxx::roots
             RT        f_lo = BASE::evaluate(x_lo);
             RT        f_hi = BASE::evaluate(x_hi);
 
-            RT x_mid = (x_lo + x_hi) / 2.0;
+            RT x_mid = (x_lo + x_hi) / 2;
             RT f_mid = BASE::evaluate(x_mid);
 
-            int sign  = ((f_lo - f_hi) < 0.0 ? -1 : 1);
+            RT  sign  = ((f_lo - f_hi) < 0 ? -1 : 1);
             RT  x_new = x_mid + (x_mid - x_lo) * ((sign * f_mid) / sqrt(f_mid * f_mid - f_lo * f_hi));
             RT  f_new = BASE::evaluate(x_new);
 
             // Update bounds based on the results of Ridder's method.
-            if (f_mid * f_new < 0.0)
+            if (f_mid * f_new < RT(0))
                 BASE::setBounds(x_mid < x_new ? std::make_pair(x_mid, x_new) : std::make_pair(x_new, x_mid));
-            else if (f_hi * f_new < 0.0)
+            else if (f_hi * f_new < RT(0))
                 BASE::setBounds(x_hi < x_new ? std::make_pair(x_hi, x_new) : std::make_pair(x_new, x_hi));
             else
                 BASE::setBounds(x_lo < x_new ? std::make_pair(x_lo, x_new) : std::make_pair(x_new, x_lo));
@@ -5,10 +5,14 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators_all.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <Multiroots.hpp>
 #include <Poly.hpp>
+#include <blaze/Blaze.h>
 
+#include <array>
 #include <cmath>
 #include <deque>
+#include <ranges>
 #include <sstream>
 #include <vector>
 
@@ -94,7 +98,7 @@ TEST_CASE("Polynomial class tests", "[Polynomial]")
         REQUIRE(p5.coefficients() == std::vector<double>{-3, -3, -3});
         p5 = p2;
         p5 -= p3;
-        REQUIRE(p5.coefficients() == std::vector<double>{-1, -1, -1, 8});
+        REQUIRE(p5.coefficients() == std::vector<double>{-1, -1, -1, -8});
 
         auto p6 = p1 * p2;
         REQUIRE(p6.coefficients() == std::vector<double>{4, 13, 28, 27, 18});
@@ -126,7 +130,7 @@ TEST_CASE("Polynomial class tests", "[Polynomial]")
         REQUIRE(c5.coefficients() == std::vector<std::complex<double>>{-3.0+0i, -3.0+0i, -3.0+0i});
         c5 = c2;
         c5 -= c3;
-        REQUIRE(c5.coefficients() == std::vector<std::complex<double>>{-1.0+0i, -1.0+0i, -1.0+0i, 8.0+0i});
+        REQUIRE(c5.coefficients() == std::vector<std::complex<double>>{-1.0+0i, -1.0+0i, -1.0+0i, -8.0+0i});
 
         auto c6 = c1 * c2;
         REQUIRE(c6.coefficients() == std::vector<std::complex<double>>{4.0+0i, 13.0+0i, 28.0+0i, 27.0+0i, 18.0+0i});
@@ -159,6 +163,93 @@ TEST_CASE("Polynomial class tests", "[Polynomial]")
         auto t8 = p1 % c2;
         REQUIRE(t8.coefficients() == std::vector<std::complex<double>>{-1.0+0i, -0.5+0i});
 
+        // Chained expressions reuse the storage of the temporaries
+        auto        prod = p1 * p2;
+        const auto* data = prod.coefficients().data();
+        auto        p9   = std::move(prod) + p3 - p1;
+        REQUIRE(p9.coefficients() == std::vector<double>{8, 17, 32, 35, 18});
+        REQUIRE(p9.coefficients().data() == data);
+        REQUIRE((p1 - p2 * p3).coefficients() == std::vector<double>{-19, -47, -85, -103, -82, -48});
+        REQUIRE((p3 - p1) + (p1 - p3) == Polynomial<double>({0}));
+        REQUIRE((c1 - p3 + p1).coefficients() == std::vector<std::complex<double>>{-3.0+0i, -2.0+0i, -1.0+0i, -8.0+0i});
+
+        // Scalar operations and negation
+        REQUIRE((2.0 * p1).coefficients() == std::vector<double>{2, 4, 6});
+        REQUIRE((p1 * 2.0 / 4.0).coefficients() == std::vector<double>{0.5, 1, 1.5});
+        REQUIRE((-p1).coefficients() == std::vector<double>{-1, -2, -3});
+        REQUIRE((p1 * 0.0).order() == 0);
+        auto p10 = p1;
+        p10 += p10;
+        REQUIRE(p10.coefficients() == std::vector<double>{2, 4, 6});
+        p10 -= p10;
+        REQUIRE(p10.coefficients() == std::vector<double>{0});
+
+    }
+
+    SECTION("Division and Deflation Tests")
+    {
+        // Deflation by a linear factor: (x - 2)(x + 1)(x - 3) = 6 + x - 4x^2 + x^3
+        Polynomial<double> p1({6, 1, -4, 1});
+        REQUIRE(p1.deflate(2.0) == 0.0);
+        REQUIRE(p1.coefficients() == std::vector<double>{-3, -2, 1});
+        REQUIRE(p1.deflate(1.0) == -4.0);
+        REQUIRE(p1.coefficients() == std::vector<double>{-1, 1});
+
+        // Deflation by a quadratic factor: (x^2 + 1)(x^2 - 2x + 5) = 5 - 2x + 6x^2 - 2x^3 + x^4, plus a remainder
+        Polynomial<double> p2({7, 1, 6, -2, 1});
+        auto [rem0, rem1] = p2.deflateQuadratic(0.0, 1.0);
+        REQUIRE(p2.coefficients() == std::vector<double>{5, -2, 1});
+        REQUIRE(rem0 == 2.0);
+        REQUIRE(rem1 == 3.0);
+        REQUIRE_THROWS(Polynomial<double>({1.0}).deflate(1.0));
+        REQUIRE_THROWS(Polynomial<double>({1.0, 1.0}).deflateQuadratic(1.0, 1.0));
+
+        // In-place division by non-monic linear and quadratic divisors
+        Polynomial<double> p3({-12, 2, 8, 2});
+        p3 /= Polynomial<double>({-2, 2});
+        REQUIRE(p3.coefficients() == std::vector<double>{6, 5, 1});
+        p3 /= Polynomial<double>({4, 2, 2});
+        REQUIRE(p3.coefficients() == std::vector<double>{0.5});
+
+        Polynomial<std::complex<double>> c1({{-1.0+0i, 0.0+0i, 1.0+0i}});
+        c1 /= Polynomial<std::complex<double>>({{-1.0+0i, 1.0+0i}});
+        REQUIRE(c1.coefficients() == std::vector<std::complex<double>>{1.0+0i, 1.0+0i});
+
+        // Newton and schoolbook division of a = b*q + r, on both sides of the threshold. The coefficients of the
+        // divisor decay away from the leading one, so that the division is well conditioned.
+        for (size_t size : {40, 300, 1100, 3100}) {
+            std::vector<double> b(size);
+            std::vector<double> q(size + 5);
+            std::vector<double> r(size - 1);
+            for (size_t i = 0; i < b.size(); ++i) b[i] = std::cos(static_cast<double>(i)) * std::pow(0.25, static_cast<double>(size - 1 - i));
+            for (size_t i = 0; i < q.size(); ++i) q[i] = std::sin(static_cast<double>(i) + 1.0);
+            for (size_t i = 0; i < r.size(); ++i) r[i] = std::cos(0.5 * static_cast<double>(i));
+            b.back() = 1.0;
+
+            auto a = (Polynomial(b) * Polynomial(q) + Polynomial(r)).coefficients();
+
+            std::vector<double> q1(q.size());
+            std::vector<double> r1(r.size());
+            detail::divideNewton(std::span<const double>(a), std::span<const double>(b), std::span<double>(q1), std::span<double>(r1));
+
+            std::vector<double> q2(q.size());
+            std::vector<double> r2 = a;
+            detail::divideSchoolbook(std::span<double>(r2), std::span<const double>(b), std::span<double>(q2));
+
+            auto [quotient, remainder] = divide(Polynomial(a), Polynomial(b));
+            REQUIRE(quotient.order() == q.size() - 1);
+            REQUIRE(remainder.order() == r.size() - 1);
+            for (size_t i = 0; i < q.size(); ++i) {
+                REQUIRE_THAT(q1[i], Catch::Matchers::WithinAbs(q[i], 1.0E-10));
+                REQUIRE_THAT(q2[i], Catch::Matchers::WithinAbs(q[i], 1.0E-10));
+                REQUIRE_THAT(quotient.coefficients()[i], Catch::Matchers::WithinAbs(q[i], 1.0E-10));
+            }
+            for (size_t i = 0; i < r.size(); ++i) {
+                REQUIRE_THAT(r1[i], Catch::Matchers::WithinAbs(r[i], 1.0E-10));
+                REQUIRE_THAT(r2[i], Catch::Matchers::WithinAbs(r[i], 1.0E-10));
+                REQUIRE_THAT(remainder.coefficients()[i], Catch::Matchers::WithinAbs(r[i], 1.0E-10));
+            }
+        }
     }
 
     SECTION("Order and Coefficient Tests")
@@ -178,6 +269,44 @@ TEST_CASE("Polynomial class tests", "[Polynomial]")
         REQUIRE(p3.order() == 0);
         REQUIRE(p3.coefficients() == std::vector<double>{0.0});
 
+        // Test the Karatsuba and FFT multiplication kernels against a plain schoolbook product
+        for (size_t size : {31, 64, 191, 192, 300, 401, 511, 512, 1100}) {
+            std::vector<double> c1(size);
+            std::vector<double> c2(size / 2 + 7);
+            for (size_t i = 0; i < c1.size(); ++i) c1[i] = std::sin(static_cast<double>(i) + 1.0);
+            for (size_t i = 0; i < c2.size(); ++i) c2[i] = std::cos(0.5 * static_cast<double>(i));
+
+            std::vector<double> expected(c1.size() + c2.size() - 1, 0.0);
+            for (size_t i = 0; i < c1.size(); ++i)
+                for (size_t j = 0; j < c2.size(); ++j) expected[i + j] += c1[i] * c2[j];
+
+            auto q1 = Polynomial(c1) * Polynomial(c2);
+            auto q2 = Polynomial(c2) * Polynomial(c1);
+            auto q3 = Polynomial(c1);
+            q3 *= Polynomial(c2);
+            auto q4 = Polynomial(c1) * Polynomial(c1);
+            auto q5 = Polynomial(c1);
+            q5 *= q5;
+            REQUIRE(q1.order() == expected.size() - 1);
+            REQUIRE(q3.order() == expected.size() - 1);
+            for (size_t i = 0; i < expected.size(); ++i) {
+                REQUIRE_THAT(q1.coefficients()[i], Catch::Matchers::WithinAbs(expected[i], 1.0E-10));
+                REQUIRE_THAT(q2.coefficients()[i], Catch::Matchers::WithinAbs(expected[i], 1.0E-10));
+                REQUIRE_THAT(q3.coefficients()[i], Catch::Matchers::WithinAbs(expected[i], 1.0E-10));
+            }
+            for (size_t i = 0; i <= q4.order(); ++i) REQUIRE_THAT(q5.coefficients()[i], Catch::Matchers::WithinAbs(q4.coefficients()[i], 1.0E-10));
+
+            std::vector<std::complex<double>> z1(c1.begin(), c1.end());
+            for (size_t i = 0; i < z1.size(); ++i) z1[i] += std::complex<double>(0.0, c2[i % c2.size()]);
+            auto z2 = Polynomial(z1) * Polynomial(c2);
+            for (size_t k = 0; k <= z2.order(); ++k) {
+                std::complex<double> sum = 0.0;
+                for (size_t j = 0; j < c2.size(); ++j)
+                    if (k >= j && k - j < z1.size()) sum += z1[k - j] * c2[j];
+                REQUIRE_THAT(std::abs(z2.coefficients()[k] - sum), Catch::Matchers::WithinAbs(0.0, 1.0E-10));
+            }
+        }
+
         // Test equality and inequality
         REQUIRE(p1 == p1);
         REQUIRE(p2 == p2);
@@ -207,6 +336,28 @@ TEST_CASE("Polynomial class tests", "[Polynomial]")
         REQUIRE(d4.coefficients() == std::vector<std::complex<double>>{{2.0+0i, 6.0+0i, 12.0+0i}});
     }
 
+    SECTION("Fused Derivative Tests")
+    {
+        Polynomial<double> p1({1, 2, 3, 4});
+        auto d1 = derivativeOf(p1);
+        auto d2 = derivativeOf(d1);
+        auto d3 = derivativeOf(d2);
+
+        for (double x : {-1.5, 0.0, 0.7, 2.0}) {
+            auto [p, dp, d2p, d3p, d4p] = p1.evaluateWithDerivatives<4>(x);
+            REQUIRE_THAT(p, Catch::Matchers::WithinAbs(p1(x), 1.0E-12));
+            REQUIRE_THAT(dp, Catch::Matchers::WithinAbs(d1(x), 1.0E-12));
+            REQUIRE_THAT(d2p, Catch::Matchers::WithinAbs(d2(x), 1.0E-12));
+            REQUIRE_THAT(d3p, Catch::Matchers::WithinAbs(d3(x), 1.0E-12));
+            REQUIRE(d4p == 0.0);
+        }
+
+        Polynomial<std::complex<double>> p2({{1.0+2.0i, 3.0-1.0i, -2.0+0.5i}});
+        auto [p, dp] = p2.evaluateWithDerivatives<1>(0.3 - 0.2i);
+        REQUIRE_THAT(std::abs(p - p2(0.3 - 0.2i)), Catch::Matchers::WithinAbs(0.0, 1.0E-12));
+        REQUIRE_THAT(std::abs(dp - derivativeOf(p2)(0.3 - 0.2i)), Catch::Matchers::WithinAbs(0.0, 1.0E-12));
+    }
+
     SECTION("String Representation Tests")
     {
         Polynomial<double> p1({1, 2, 3});
@@ -248,6 +399,314 @@ TEST_CASE("Polynomial class tests", "[Polynomial]")
         REQUIRE_THAT(p5(0.49+0.95i).real(), Catch::Matchers::WithinAbs(1.8246201, 1.0E-5));
         REQUIRE_THAT(p5(0.49+0.95i).imag(), Catch::Matchers::WithinAbs(2.30389412, 1.0E-5));
     }
+
+    SECTION("Evaluation Strategy Tests")
+    {
+        for (size_t order : {0, 1, 2, 3, 6, 7, 8, 9, 15, 16, 17, 31, 40}) {
+            std::vector<double> coeffs(order + 1);
+            for (size_t i = 0; i <= order; ++i) coeffs[i] = std::pow(-1.0, static_cast<double>(i)) / static_cast<double>(i + 1);
+            Polynomial p(coeffs);
+
+            for (double x : {-0.9, -0.3, 0.0, 0.45, 0.8}) {
+                double expected = 0.0;
+                for (size_t i = order + 1; i-- > 0;) expected = expected * x + coeffs[i];
+
+                REQUIRE_THAT(*p.evaluate<Horner>(x), Catch::Matchers::WithinAbs(expected, 1.0E-12));
+                REQUIRE_THAT(*p.evaluate<Horner2>(x), Catch::Matchers::WithinAbs(expected, 1.0E-12));
+                REQUIRE_THAT(*p.evaluate<Estrin>(x), Catch::Matchers::WithinAbs(expected, 1.0E-12));
+                REQUIRE_THAT(*p.evaluate<AutoEvaluation>(x), Catch::Matchers::WithinAbs(expected, 1.0E-12));
+                REQUIRE_THAT(*p.evaluate<CompensatedHorner>(x), Catch::Matchers::WithinAbs(expected, 1.0E-12));
+            }
+
+            auto z = p.evaluate<Estrin>(0.3 + 0.4i);
+            auto w = p.evaluate<Horner>(0.3 + 0.4i);
+            auto c = p.evaluate<CompensatedHorner>(0.3 + 0.4i);
+            REQUIRE_THAT(z->real(), Catch::Matchers::WithinAbs(w->real(), 1.0E-12));
+            REQUIRE_THAT(z->imag(), Catch::Matchers::WithinAbs(w->imag(), 1.0E-12));
+            REQUIRE_THAT(c->real(), Catch::Matchers::WithinAbs(w->real(), 1.0E-12));
+            REQUIRE_THAT(c->imag(), Catch::Matchers::WithinAbs(w->imag(), 1.0E-12));
+        }
+    }
+
+    SECTION("Compensated Evaluation Tests")
+    {
+        // The expanded form of (x - 1)^7 has exact integer coefficients, but plain Horner loses all digits close to x = 1
+        Polynomial p({-1.0, 7.0, -21.0, 35.0, -35.0, 21.0, -7.0, 1.0});
+        for (double x : {1.0 + 1.0E-3, 1.0 - 3.0E-3, 1.0 + 1.0E-2}) {
+            const double expected = std::pow(x - 1.0, 7);
+            REQUIRE_THAT(*p.evaluate<CompensatedHorner>(x), Catch::Matchers::WithinRel(expected, 1.0E-6));
+            REQUIRE_FALSE(std::abs(*p.evaluate<Horner>(x) - expected) < 1.0E-6 * std::abs(expected));
+
+            const auto [value, deriv] = p.evaluateWithDerivatives<1, CompensatedHorner>(x);
+            const auto plain          = p.evaluateWithDerivatives<1>(x);
+            REQUIRE_THAT(value, Catch::Matchers::WithinRel(expected, 1.0E-6));
+            REQUIRE_THAT(deriv, Catch::Matchers::WithinAbs(plain[1], 1.0E-12));
+        }
+
+        // The same on the complex plane, and for a StaticPolynomial
+        const std::complex<double> z = 1.0 + 2.0E-3 + 1.0E-3i;
+        const Polynomial<std::complex<double>> q({{-1.0, 7.0, -21.0, 35.0, -35.0, 21.0, -7.0, 1.0}});
+        const std::complex<double> expected = std::pow(z - 1.0, 7);
+        REQUIRE(std::abs(*q.evaluate<CompensatedHorner>(z) - expected) < 1.0E-6 * std::abs(expected));
+        StaticPolynomial s { -1.0, 7.0, -21.0, 35.0, -35.0, 21.0, -7.0, 1.0 };
+        const auto derivatives = s.evaluateWithDerivatives<2, CompensatedHorner>(1.001);
+        REQUIRE_THAT(derivatives[0], Catch::Matchers::WithinRel(std::pow(1.001 - 1.0, 7), 1.0E-6));
+
+        // The error-free transformations are exact
+        const auto [sum, sumError] = nxx::poly::detail::twoSum(1.0, 1.0E-17);
+        REQUIRE(sum == 1.0);
+        REQUIRE(sumError == 1.0E-17);
+        const double a = 1.0 + std::ldexp(1.0, -30);
+        const auto [product, productError] = nxx::poly::detail::twoProduct(a, a);
+        REQUIRE(product == 1.0 + std::ldexp(1.0, -29));
+        REQUIRE(productError == std::ldexp(1.0, -60));
+    }
+
+    SECTION("Batch Evaluation Tests")
+    {
+        Polynomial p1({2.1, -1.34, 0.76, 0.45, -0.12});
+        std::vector<double> x(21);
+        std::vector<double> y(x.size());
+        for (size_t i = 0; i < x.size(); ++i) x[i] = -2.0 + 0.2 * static_cast<double>(i);
+
+        REQUIRE(p1.evaluate(x, y).has_value());
+        for (size_t i = 0; i < x.size(); ++i) REQUIRE_THAT(y[i], Catch::Matchers::WithinAbs(p1(x[i]), 1.0E-12));
+
+        Polynomial p2({-2.31+0.44i, 4.21-3.19i, 0.93+1.04i, -0.42+0.68i});
+        std::vector<std::complex<double>> z { 0.49+0.95i, 0.49+0.95i, 0.0+0.0i };
+        std::vector<std::complex<double>> w(z.size());
+        REQUIRE(p2.evaluate(z, w).has_value());
+        REQUIRE_THAT(w[1].real(), Catch::Matchers::WithinAbs(1.8246201, 1.0E-5));
+        REQUIRE_THAT(w[1].imag(), Catch::Matchers::WithinAbs(2.30389412, 1.0E-5));
+
+        x[3] = std::numeric_limits<double>::infinity();
+        auto err = p1.evaluate(x, y);
+        REQUIRE_FALSE(err.has_value());
+        REQUIRE(err.error().data().arg == x[3]);
+
+        std::vector<double> tooShort(3);
+        REQUIRE_THROWS(p1.evaluate(x, tooShort));
+    }
+
+    SECTION("Grid Evaluation Tests")
+    {
+        // ===== The bound on the error scales with the magnitude of the terms, sum |a_k| |x|^k.
+        const auto check = [](const auto& poly, auto x0, auto h, const auto& values) {
+            for (size_t i = 0; i < values.size(); ++i) {
+                const auto x     = x0 + h * static_cast<double>(i);
+                double     scale = 0.0;
+                for (size_t k = 0; k < poly.coefficients().size(); ++k)
+                    scale += std::abs(poly.coefficients()[k]) * std::pow(std::abs(x), static_cast<double>(k));
+                REQUIRE(std::abs(values[i] - poly(x)) <= 64 * std::numeric_limits<double>::epsilon() * scale);
+            }
+        };
+
+        for (const size_t order : { 0, 1, 4, 12, 20 }) {
+            std::vector<double> coeffs(order + 1);
+            for (size_t k = 0; k <= order; ++k) coeffs[k] = std::cos(static_cast<double>(5 * k + order));
+            const Polynomial<double> poly(coeffs);
+
+            // ===== A count that is not a multiple of the lanes, spanning several anchors.
+            const double        h = 3.0 / 1003;
+            std::vector<double> values(1003);
+            check(poly, -1.5, h, evaluateGrid(poly, -1.5, h, values.size()));
+            nxx::poly::detail::gridDifferences<nxx::poly::detail::POLY_BATCH_LANES>(std::span<const double>(coeffs), -1.5, h, std::span(values));
+            check(poly, -1.5, h, values);
+            nxx::poly::detail::gridDifferences<1>(std::span<const double>(coeffs), -1.5, h, std::span(values));
+            check(poly, -1.5, h, values);
+        }
+
+        // ===== Complex polynomials below and above the order limit for the difference table.
+        for (const size_t order : { 3, 14, 18 }) {
+            std::vector<std::complex<double>> coeffs(order + 1);
+            for (size_t k = 0; k <= order; ++k) coeffs[k] = { std::cos(static_cast<double>(k)), std::sin(static_cast<double>(2 * k + 1)) };
+            const Polynomial<std::complex<double>> poly(coeffs);
+
+            const std::complex<double> x0 = -0.8+0.6i;
+            const std::complex<double> h  = 0.002-0.001i;
+            check(poly, x0, h, evaluateGrid(poly, x0, h, 777));
+        }
+
+        // ===== Coarse grids crossing the origin, where the terms grow quickly over the distance between anchors.
+        {
+            std::vector<std::complex<double>> coeffs(17);
+            for (size_t k = 0; k < coeffs.size(); ++k) coeffs[k] = { std::cos(static_cast<double>(3 * k)), std::sin(static_cast<double>(k + 2)) };
+            const Polynomial<std::complex<double>> poly(coeffs);
+
+            check(poly, std::complex<double>(-10.0), std::complex<double>(20.0 / 511), evaluateGrid(poly, {-10.0}, {20.0 / 511}, 512));
+            check(poly, std::complex<double>(-3.0), std::complex<double>(0.05), evaluateGrid(poly, {-3.0}, {0.05}, 3001));
+        }
+
+        REQUIRE(evaluateGrid(Polynomial({1.0, 2.0}), 0.0, 1.0, 0).empty());
+    }
+
+    SECTION("Polynomial Bank Tests")
+    {
+        // ===== Mixed orders, and more polynomials than one block.
+        std::vector<Polynomial<double>> polys;
+        for (size_t i = 0; i < 1100; ++i) {
+            std::vector<double> coeffs(i % 8 + 1);
+            for (size_t k = 0; k < coeffs.size(); ++k) coeffs[k] = std::sin(static_cast<double>(3 * i + 7 * k + 1));
+            polys.emplace_back(coeffs);
+        }
+
+        const PolynomialBank<double> bank(polys);
+        REQUIRE(bank.size() == 1100);
+        REQUIRE(bank.order() == 7);
+        REQUIRE(bank.polynomial(13).coefficients() == polys[13].coefficients());
+
+        for (const double x : { -1.7, 0.0, 0.35, 2.2 }) {
+            const auto values = bank(x);
+            const auto derivs = bank.evaluateWithDerivatives<2>(x);
+            for (size_t i = 0; i < polys.size(); ++i) {
+                const auto expected = polys[i].evaluateWithDerivatives<2>(x);
+                REQUIRE_THAT(values[i], Catch::Matchers::WithinAbs(expected[0], 1.0E-12));
+                for (size_t j = 0; j < 3; ++j) REQUIRE_THAT(derivs[j][i], Catch::Matchers::WithinAbs(expected[j], 1.0E-10));
+            }
+        }
+
+        PolynomialBank<std::complex<double>> cbank(2, 3);
+        cbank.assign(0, Polynomial({-2.31+0.44i, 4.21-3.19i, 0.93+1.04i, -0.42+0.68i}));
+        cbank.assign(1, Polynomial({1.0+0.0i, 0.0+1.0i}));
+        const auto w = cbank(0.49+0.95i);
+        REQUIRE_THAT(w[0].real(), Catch::Matchers::WithinAbs(1.8246201, 1.0E-5));
+        REQUIRE_THAT(w[0].imag(), Catch::Matchers::WithinAbs(2.30389412, 1.0E-5));
+        REQUIRE_THAT(std::abs(w[1] - (1.0+0.0i + 1.0i * (0.49+0.95i))), Catch::Matchers::WithinAbs(0.0, 1.0E-14));
+
+        std::vector<std::complex<double>> tooShort(1);
+        REQUIRE_THROWS(cbank.evaluate(0.0, tooShort));
+        REQUIRE_THROWS(cbank.assign(1, Polynomial({1.0+0.0i, 0.0+1.0i, 0.0+0.0i, 0.0+0.0i, 1.0+0.0i})));
+        REQUIRE_THROWS(cbank.assign(2, Polynomial({1.0+0.0i})));
+    }
+
+    SECTION("Matrix Evaluation Tests")
+    {
+        // ===== Reference: the sum of c_k A^k, with the powers formed one product at a time.
+        auto naive = [](const auto& coeffs, auto A) {
+            auto result = A;
+            auto power  = A;
+            for (size_t i = 0; i < A.rows(); ++i)
+                for (size_t j = 0; j < A.columns(); ++j) {
+                    result(i, j) = i == j ? coeffs[0] : 0.0;
+                    power(i, j)  = i == j ? 1.0 : 0.0;
+                }
+            for (size_t k = 1; k < coeffs.size(); ++k) {
+                power = power * A;
+                result += coeffs[k] * power;
+            }
+            return result;
+        };
+
+        blaze::DynamicMatrix<double> A(4, 4);
+        for (size_t i = 0; i < 4; ++i)
+            for (size_t j = 0; j < 4; ++j) A(i, j) = 0.3 * std::sin(static_cast<double>(4 * i + j + 1));
+
+        for (size_t order = 0; order <= 20; ++order) {
+            std::vector<double> coeffs(order + 1);
+            for (size_t k = 0; k <= order; ++k) coeffs[k] = 1.0 / static_cast<double>(k + 1);
+            const auto result   = evaluateMatrix(Polynomial(coeffs), A);
+            const auto expected = naive(coeffs, A);
+            for (size_t i = 0; i < 4; ++i)
+                for (size_t j = 0; j < 4; ++j) REQUIRE_THAT(result(i, j), Catch::Matchers::WithinAbs(expected(i, j), 1.0E-13));
+        }
+
+        blaze::StaticMatrix<double, 3, 3> B;
+        for (size_t i = 0; i < 3; ++i)
+            for (size_t j = 0; j < 3; ++j) B(i, j) = i <= j ? 0.5 + static_cast<double>(i + j) : 0.0;
+        constexpr StaticPolynomial p4 { 1.0, -2.0, 0.5, 0.25, -0.125 };
+        const blaze::StaticMatrix<double, 3, 3> pB = evaluateMatrix(p4, B);
+        const auto expectedB = naive(p4.coefficients(), B);
+        for (size_t i = 0; i < 3; ++i)
+            for (size_t j = 0; j < 3; ++j) REQUIRE_THAT(pB(i, j), Catch::Matchers::WithinAbs(expectedB(i, j), 1.0E-12));
+
+        // ===== For a triangular matrix, the diagonal of p(B) holds p of the diagonal.
+        for (size_t i = 0; i < 3; ++i) REQUIRE_THAT(pB(i, i), Catch::Matchers::WithinRel(p4(B(i, i)), 1.0E-14));
+
+        blaze::DynamicMatrix<std::complex<double>> C(2, 2);
+        C(0, 0) = 1.0i;
+        C(1, 1) = -1.0i;
+        const auto pC = evaluateMatrix(Polynomial({1.0+0.0i, 0.0+2.0i, 3.0+0.0i}), C);
+        REQUIRE_THAT(std::abs(pC(0, 0) - (-4.0+0.0i)), Catch::Matchers::WithinAbs(0.0, 1.0E-14));
+        REQUIRE_THAT(std::abs(pC(1, 1) - (0.0+0.0i)), Catch::Matchers::WithinAbs(0.0, 1.0E-14));
+        REQUIRE(pC(0, 1) == 0.0+0.0i);
+
+        REQUIRE_THROWS(evaluateMatrix(Polynomial({1.0, 2.0}), blaze::DynamicMatrix<double>(2, 3)));
+    }
+}
+
+TEST_CASE("StaticPolynomial class tests", "[Polynomial]")
+{
+    using namespace nxx::poly;
+    using namespace std::complex_literals;
+
+    SECTION("Constructor and Evaluation tests")
+    {
+        constexpr StaticPolynomial p1 { 6.0, -5.0, 1.0 };
+        static_assert(p1.order() == 2);
+        static_assert(p1(2.0) == 0.0);
+        static_assert(p1(0.0) == 6.0);
+        REQUIRE(p1.coefficients() == std::array<double, 3>{6.0, -5.0, 1.0});
+
+        constexpr auto p2 = StaticPolynomial(std::array{ 2.1, -1.34, 0.76, 0.45 });
+        Polynomial     p3({ 2.1, -1.34, 0.76, 0.45 });
+        REQUIRE_THAT(p2(0.7), Catch::Matchers::WithinAbs(p3(0.7), 1.0E-12));
+        REQUIRE_THAT(p2(0.49 + 0.95i).real(), Catch::Matchers::WithinAbs(0.3959143, 1.0E-5));
+        REQUIRE_THAT(p2(0.49 + 0.95i).imag(), Catch::Matchers::WithinAbs(-0.643330, 1.0E-5));
+        REQUIRE_THAT(*p2.evaluate(0.7), Catch::Matchers::WithinAbs(p3(0.7), 1.0E-12));
+        REQUIRE_FALSE(p2.evaluate(std::numeric_limits<double>::infinity()).has_value());
+        REQUIRE(to_string(p1) == "6 - 5x + 1x^2");
+    }
+
+    SECTION("Arithmetic Operations tests")
+    {
+        constexpr StaticPolynomial p1 { 1.0, 2.0, 3.0 };
+        constexpr StaticPolynomial p2 { 5.0, 6.0, 7.0, 8.0 };
+
+        constexpr auto p3 = p1 + p2;
+        static_assert(std::same_as<decltype(p3), const StaticPolynomial<double, 3>>);
+        static_assert(p3 == StaticPolynomial { 6.0, 8.0, 10.0, 8.0 });
+
+        constexpr auto p4 = p1 - p2;
+        static_assert(p4 == StaticPolynomial { -4.0, -4.0, -4.0, -8.0 });
+
+        constexpr auto p5 = p1 * p2;
+        static_assert(std::same_as<decltype(p5), const StaticPolynomial<double, 5>>);
+        REQUIRE(p5.toPolynomial() == Polynomial<double>({1, 2, 3}) * Polynomial<double>({5, 6, 7, 8}));
+
+        constexpr auto d1 = derivativeOf(p2);
+        static_assert(d1 == StaticPolynomial { 6.0, 14.0, 24.0 });
+
+        auto p6 = p2;
+        p6 += p1;
+        REQUIRE(p6 == StaticPolynomial { 6.0, 8.0, 10.0, 8.0 });
+        p6 -= p1;
+        REQUIRE(p6 == p2);
+
+        // Mixing static and dynamic polynomials gives a dynamic polynomial
+        Polynomial<double> q1({4, 5, 6});
+        auto               q2 = p1 * q1;
+        REQUIRE(q2.coefficients() == std::vector<double>{4, 13, 28, 27, 18});
+        REQUIRE((q1 + p1).coefficients() == std::vector<double>{5, 7, 9});
+        REQUIRE((p1 / q1).coefficients() == std::vector<double>{0.5});
+    }
+
+    SECTION("Root tests")
+    {
+        StaticPolynomial p1 { -120.0, 274.0, -225.0, 85.0, -15.0, 1.0 };
+        auto             roots1 = polysolve(p1);
+        REQUIRE(roots1.value().size() == 5);
+        for (size_t i = 0; i < 5; ++i) REQUIRE_THAT(roots1.value()[i], Catch::Matchers::WithinAbs(static_cast<double>(i + 1), EPS));
+
+        StaticPolynomial p2 { 26.0, -20.0, 4.0 };
+        auto             roots2 = polysolve<std::complex<double>>(p2);
+        REQUIRE_THAT(roots2.value()[0].real(), Catch::Matchers::WithinAbs(2.5, EPS));
+        REQUIRE_THAT(roots2.value()[0].imag(), Catch::Matchers::WithinAbs(-0.5, EPS));
+
+        StaticPolynomial p3 { 6.0, -5.0, 1.0 };
+        auto             roots3 = quadratic(p3);
+        REQUIRE_THAT(roots3.value()[0], Catch::Matchers::WithinAbs(2.0, EPS));
+        REQUIRE_THAT(roots3.value()[1], Catch::Matchers::WithinAbs(3.0, EPS));
+    }
 }
 
 TEST_CASE("Polynomial roots tests", "[Polynomial]")
@@ -426,6 +885,75 @@ TEST_CASE("Polynomial roots tests", "[Polynomial]")
         REQUIRE_THAT(croots6.value()[2].imag(), Catch::Matchers::WithinAbs(0.0, EPS));
     }
 
+    SECTION("Quartics")
+    {
+        // (x - 1)(x - 2)(x - 3)(x - 4)
+        Polynomial p1({24.0, -50.0, 35.0, -10.0, 1.0});
+        auto rroots1 = quartic<double>(p1);
+        REQUIRE(rroots1.value().size() == 4);
+        for (size_t i = 0; i < 4; ++i) REQUIRE_THAT(rroots1.value()[i], Catch::Matchers::WithinAbs(static_cast<double>(i + 1), EPS));
+        auto croots1 = quartic<std::complex<double> >(p1);
+        REQUIRE(croots1.value().size() == 4);
+        for (size_t i = 0; i < 4; ++i) {
+            REQUIRE_THAT(croots1.value()[i].real(), Catch::Matchers::WithinAbs(static_cast<double>(i + 1), EPS));
+            REQUIRE_THAT(croots1.value()[i].imag(), Catch::Matchers::WithinAbs(0.0, EPS));
+        }
+
+        // (x^2 + 1)(x^2 + 4): biquadratic, no real roots
+        Polynomial p2({4.0, 0.0, 5.0, 0.0, 1.0});
+        REQUIRE(quartic<double>(p2).value().empty());
+        auto croots2 = quartic<std::complex<double> >(p2);
+        REQUIRE(croots2.value().size() == 4);
+        const std::vector<double> imag2 = {-2.0, -1.0, 1.0, 2.0};
+        for (size_t i = 0; i < 4; ++i) {
+            REQUIRE_THAT(croots2.value()[i].real(), Catch::Matchers::WithinAbs(0.0, EPS));
+            REQUIRE_THAT(croots2.value()[i].imag(), Catch::Matchers::WithinAbs(imag2[i], EPS));
+        }
+
+        // (x - 1)^2 (x + 2)(x - 5): the double root is reported twice
+        Polynomial p3 = Polynomial({-1.0, 1.0}) * Polynomial({-1.0, 1.0}) * Polynomial({2.0, 1.0}) * Polynomial({-5.0, 1.0});
+        auto rroots3 = quartic<double>(p3);
+        REQUIRE(rroots3.value().size() == 4);
+        REQUIRE_THAT(rroots3.value()[0], Catch::Matchers::WithinAbs(-2.0, EPS));
+        REQUIRE_THAT(rroots3.value()[1], Catch::Matchers::WithinAbs(1.0, EPS));
+        REQUIRE_THAT(rroots3.value()[2], Catch::Matchers::WithinAbs(1.0, EPS));
+        REQUIRE_THAT(rroots3.value()[3], Catch::Matchers::WithinAbs(5.0, EPS));
+
+        // (x - 2)^4: all roots coincide
+        Polynomial p4 = Polynomial({-2.0, 1.0}) * Polynomial({-2.0, 1.0}) * Polynomial({-2.0, 1.0}) * Polynomial({-2.0, 1.0});
+        auto croots4 = quartic<std::complex<double> >(p4);
+        REQUIRE(croots4.value().size() == 4);
+        for (const auto& root : croots4.value()) REQUIRE_THAT(std::abs(root - 2.0), Catch::Matchers::WithinAbs(0.0, EPS));
+
+        // Widely spread roots: (x - 1E-3)(x - 1)(x - 10)(x - 1E3)
+        Polynomial p5 = Polynomial({-1.0E-3, 1.0}) * Polynomial({-1.0, 1.0}) * Polynomial({-10.0, 1.0}) * Polynomial({-1.0E3, 1.0});
+        auto rroots5 = quartic<double>(p5);
+        REQUIRE(rroots5.value().size() == 4);
+        const std::vector<double> expected5 = {1.0E-3, 1.0, 10.0, 1.0E3};
+        for (size_t i = 0; i < 4; ++i) REQUIRE_THAT(rroots5.value()[i], Catch::Matchers::WithinRel(expected5[i], EPS));
+
+        // Complex coefficients: (x - i)(x + 2)(x - 1 - i)(x - 3)
+        using C = std::complex<double>;
+        Polynomial<C> p6 = Polynomial<C>({C(0.0, -1.0), 1.0}) * Polynomial<C>({2.0, 1.0}) * Polynomial<C>({C(-1.0, -1.0), 1.0}) * Polynomial<C>({-3.0, 1.0});
+        auto croots6 = quartic(p6);
+        REQUIRE(croots6.value().size() == 4);
+        const std::vector<C> expected6 = {C(-2.0, 0.0), C(0.0, 1.0), C(1.0, 1.0), C(3.0, 0.0)};
+        for (size_t i = 0; i < 4; ++i) REQUIRE_THAT(std::abs(croots6.value()[i] - expected6[i]), Catch::Matchers::WithinAbs(0.0, EPS));
+
+        // The closed form is the terminal case of the deflation in LaguerreSolver, and the real roots of a quartic
+        // are found in closed form by AutoSolver.
+        auto lroots1 = polysolve<std::complex<double>, LaguerreSolver>(p1);
+        for (size_t i = 0; i < 4; ++i) REQUIRE_THAT(lroots1.value()[i].real(), Catch::Matchers::WithinAbs(static_cast<double>(i + 1), EPS));
+        auto aroots3 = polysolve(p3);
+        REQUIRE(aroots3.value() == rroots3.value());
+        Polynomial p7 = p1 * Polynomial({-5.0, 1.0}) * Polynomial({-6.0, 1.0});
+        auto lroots7 = polysolve<std::complex<double>, LaguerreSolver>(p7);
+        REQUIRE(lroots7.value().size() == 6);
+        for (size_t i = 0; i < 6; ++i) REQUIRE_THAT(lroots7.value()[i].real(), Catch::Matchers::WithinAbs(static_cast<double>(i + 1), EPS));
+
+        REQUIRE_THROWS(quartic(Polynomial({1.0, 2.0, 3.0})));
+    }
+
     SECTION("Higher-order")
     {
         Polynomial p1({-120, 274, -225, 85, -15, 1.0});
@@ -514,4 +1042,1120 @@ TEST_CASE("Polynomial roots tests", "[Polynomial]")
         REQUIRE_THAT(croots3.value()[14].real(), Catch::Matchers::WithinAbs(2.0, EPS));
         REQUIRE_THAT(croots3.value()[14].imag(), Catch::Matchers::WithinAbs(0.0, EPS));
     }
+
+    SECTION("Reusable Laguerre solver")
+    {
+        // The same seed gives bitwise identical roots, also when the solver is reused
+        Polynomial     p1({-120, 274, -225, 85, -15, 1.0});
+        Polynomial     p2({1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0});
+        LaguerreSolver solver(42);
+        auto croots1 = polysolve<std::complex<double>>(p1, solver);
+        auto croots2 = polysolve<std::complex<double>>(p2, solver);
+        REQUIRE(croots1.value() == polysolve<std::complex<double>>(p1, solver).value());
+        REQUIRE(croots2.value() == polysolve<std::complex<double>>(p2, solver).value());
+
+        LaguerreSolver other(42);
+        REQUIRE(croots2.value() == polysolve<std::complex<double>>(p2, other).value());
+        for (size_t i = 0; i < 5; ++i) REQUIRE_THAT(croots1.value()[i].real(), Catch::Matchers::WithinAbs(static_cast<double>(i + 1), EPS));
+        for (const auto& root : croots2.value()) REQUIRE_THAT(std::abs(p2(root)), Catch::Matchers::WithinAbs(0.0, EPS));
+
+        // Solving into a preallocated range of roots
+        const Polynomial<std::complex<double>> p3({{-120, 0}, {274, 0}, {-225, 0}, {85, 0}, {-15, 0}, {1.0, 0}});
+        std::vector<std::complex<double>>      roots(5);
+        REQUIRE(solver.solve(p3, std::span(roots), EPS, nxx::MAXITER).has_value());
+        for (const auto& root : roots) REQUIRE_THAT(std::abs(p3(root)), Catch::Matchers::WithinAbs(0.0, EPS));
+        REQUIRE_THROWS(solver.solve(p3, std::span(roots).first(4), EPS, nxx::MAXITER));
+    }
+
+    SECTION("Aberth-Ehrlich")
+    {
+        Polynomial p1({-120, 274, -225, 85, -15, 1.0});
+        auto rroots1 = polysolve<void, AberthSolver>(p1);
+        REQUIRE(rroots1.value().size() == 5);
+        for (size_t i = 0; i < 5; ++i) REQUIRE_THAT(rroots1.value()[i], Catch::Matchers::WithinAbs(static_cast<double>(i + 1), EPS));
+
+        // The roots of x^8 + x^4 + 1 are the primitive 3rd and 6th roots of unity and their square roots
+        Polynomial p2({1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0});
+        auto croots2 = polysolve<std::complex<double>, AberthSolver>(p2);
+        REQUIRE(croots2.value().size() == 8);
+        for (const auto& root : croots2.value()) REQUIRE_THAT(std::abs(p2(root)), Catch::Matchers::WithinAbs(0.0, EPS));
+
+        // Roots of unity of a high order, where deflation errors would accumulate
+        std::vector<double> coeffs(101, 0.0);
+        coeffs.front() = -1.0;
+        coeffs.back()  = 1.0;
+        auto croots3 = aberth(Polynomial(coeffs));
+        REQUIRE(croots3.value().size() == 100);
+        for (const auto& root : croots3.value()) {
+            REQUIRE_THAT(std::abs(root), Catch::Matchers::WithinAbs(1.0, 1.0E-12));
+            REQUIRE_THAT(std::abs(std::pow(root, 100) - 1.0), Catch::Matchers::WithinAbs(0.0, 1.0E-10));
+        }
+
+        // Zero roots and widely spread root moduli: x^2 (x - 1E-3)(x - 1)(x - 1E3)
+        Polynomial p4 = Polynomial({0.0, 0.0, 1.0}) * Polynomial({-1.0E-3, 1.0}) * Polynomial({-1.0, 1.0}) * Polynomial({-1.0E3, 1.0});
+        auto rroots4 = polysolve<double, AberthSolver>(p4);
+        REQUIRE(rroots4.value().size() == 5);
+        REQUIRE_THAT(rroots4.value()[0], Catch::Matchers::WithinAbs(0.0, EPS));
+        REQUIRE_THAT(rroots4.value()[1], Catch::Matchers::WithinAbs(0.0, EPS));
+        REQUIRE_THAT(rroots4.value()[2], Catch::Matchers::WithinRel(1.0E-3, EPS));
+        REQUIRE_THAT(rroots4.value()[3], Catch::Matchers::WithinRel(1.0, EPS));
+        REQUIRE_THAT(rroots4.value()[4], Catch::Matchers::WithinRel(1.0E3, EPS));
+
+        REQUIRE_FALSE(aberth(p1, EPS, 1));
+
+        // An estimate at a critical point (p'(0) = 0 for x^3 - 1) is perturbed, not accepted as a root
+        const std::vector<std::complex<double>> cubic = {-1.0, 0.0, 0.0, 1.0};
+        std::vector<std::complex<double>>       estimates = {0.0, 2.0, {-1.0, 1.0}};
+        REQUIRE(detail::aberthIterate(std::span<const std::complex<double>>(cubic), std::span(estimates), EPS, 100));
+        for (const auto& root : estimates) REQUIRE_THAT(std::abs(root * root * root - 1.0), Catch::Matchers::WithinAbs(0.0, 1.0E-12));
+        REQUIRE(std::abs(estimates[0] - estimates[1]) > 0.5);
+        REQUIRE(std::abs(estimates[0] - estimates[2]) > 0.5);
+        REQUIRE(std::abs(estimates[1] - estimates[2]) > 0.5);
+    }
+
+    SECTION("Companion matrix")
+    {
+        Polynomial p1({-120, 274, -225, 85, -15, 1.0});
+        auto rroots1 = polysolve<void, CompanionSolver>(p1);
+        REQUIRE(rroots1.value().size() == 5);
+        for (size_t i = 0; i < 5; ++i) REQUIRE_THAT(rroots1.value()[i], Catch::Matchers::WithinAbs(static_cast<double>(i + 1), EPS));
+
+        // Complex coefficients: (x - i)(x + 2i)(x - 3) = -6 + (2 + 3i)x + (-3 - i)x^2 + x^3
+        Polynomial<std::complex<double>> p2({{-6.0+0.0i, 2.0+3.0i, -3.0-1.0i, 1.0+0.0i}});
+        auto croots2 = companionsolve(p2);
+        REQUIRE(croots2.value().size() == 3);
+        for (const auto& root : croots2.value()) REQUIRE_THAT(std::abs(p2(root)), Catch::Matchers::WithinAbs(0.0, EPS));
+
+        // Above the AutoSolver threshold, polysolve uses the companion matrix by default
+        std::vector<double> coeffs(41, 0.0);
+        coeffs.front() = -1.0;
+        coeffs.back()  = 1.0;
+        auto rroots3 = polysolve(Polynomial(coeffs));
+        REQUIRE(rroots3.value().size() == 2);
+        REQUIRE_THAT(rroots3.value()[0], Catch::Matchers::WithinAbs(-1.0, EPS));
+        REQUIRE_THAT(rroots3.value()[1], Catch::Matchers::WithinAbs(1.0, EPS));
+        auto croots3 = polysolve<std::complex<double>, AutoSolver<64>>(Polynomial(coeffs));
+        REQUIRE(croots3.value().size() == 40);
+        for (const auto& root : croots3.value()) REQUIRE_THAT(std::abs(root), Catch::Matchers::WithinAbs(1.0, EPS));
+
+        auto froots = companionsolve(Polynomial<float>({2.0f, -3.0f, 1.0f}));
+        REQUIRE(froots.value().size() == 2);
+    }
+
+    SECTION("Real-root isolation")
+    {
+        Polynomial p1({-120, 274, -225, 85, -15, 1.0});
+        auto rroots1 = realroots(p1);
+        REQUIRE(rroots1.value().size() == 5);
+        for (size_t i = 0; i < 5; ++i) REQUIRE_THAT(rroots1.value()[i], Catch::Matchers::WithinAbs(static_cast<double>(i + 1), EPS));
+
+        // (x^2 + 1)(x - 3)(x + 2)^2: the complex pair is never computed, and the double root is reported twice
+        Polynomial p2 = Polynomial({1.0, 0.0, 1.0}) * Polynomial({-3.0, 1.0}) * Polynomial({2.0, 1.0}) * Polynomial({2.0, 1.0});
+        auto rroots2 = polysolve<double, RealRootSolver>(p2);
+        REQUIRE(rroots2.value().size() == 3);
+        REQUIRE_THAT(rroots2.value()[0], Catch::Matchers::WithinAbs(-2.0, EPS));
+        REQUIRE_THAT(rroots2.value()[1], Catch::Matchers::WithinAbs(-2.0, EPS));
+        REQUIRE_THAT(rroots2.value()[2], Catch::Matchers::WithinAbs(3.0, EPS));
+
+        // Zero roots and widely spread root moduli: x^2 (x - 1E-3)(x - 1)(x - 1E3)
+        Polynomial p3 = Polynomial({0.0, 0.0, 1.0}) * Polynomial({-1.0E-3, 1.0}) * Polynomial({-1.0, 1.0}) * Polynomial({-1.0E3, 1.0});
+        auto rroots3 = realroots(p3);
+        REQUIRE(rroots3.value().size() == 5);
+        REQUIRE(rroots3.value()[0] == 0.0);
+        REQUIRE(rroots3.value()[1] == 0.0);
+        REQUIRE_THAT(rroots3.value()[2], Catch::Matchers::WithinRel(1.0E-3, EPS));
+        REQUIRE_THAT(rroots3.value()[3], Catch::Matchers::WithinRel(1.0, EPS));
+        REQUIRE_THAT(rroots3.value()[4], Catch::Matchers::WithinRel(1.0E3, EPS));
+
+        // The real roots of a high-order polynomial agree with those of the companion matrix
+        std::vector<double> coeffs(61);
+        for (size_t i = 0; i < coeffs.size(); ++i) coeffs[i] = std::sin(static_cast<double>(i * i + 1));
+        auto rroots4 = realroots(Polynomial(coeffs));
+        auto croots4 = polysolve<double, CompanionSolver>(Polynomial(coeffs));
+        REQUIRE(rroots4.value().size() == croots4.value().size());
+        for (size_t i = 0; i < rroots4.value().size(); ++i)
+            REQUIRE_THAT(rroots4.value()[i], Catch::Matchers::WithinAbs(croots4.value()[i], 1.0E-6));
+
+        // Roots at bisection midpoints, which rounding errors may move out of both halves or into both,
+        // next to roots within a single interval of them: (x + 2)(x + 1.625)(x - 0.749) and (x - 1)(x - 1.001)(x - 3)
+        Polynomial p5 = Polynomial({2.0, 1.0}) * Polynomial({1.625, 1.0}) * Polynomial({-0.749, 1.0});
+        auto rroots5 = realroots(p5);
+        REQUIRE(rroots5.value().size() == 3);
+        REQUIRE_THAT(rroots5.value()[0], Catch::Matchers::WithinAbs(-2.0, EPS));
+        REQUIRE_THAT(rroots5.value()[1], Catch::Matchers::WithinAbs(-1.625, EPS));
+        REQUIRE_THAT(rroots5.value()[2], Catch::Matchers::WithinAbs(0.749, EPS));
+
+        Polynomial p6 = Polynomial({-1.0, 1.0}) * Polynomial({-1.001, 1.0}) * Polynomial({-3.0, 1.0});
+        auto rroots6 = realroots(p6);
+        REQUIRE(rroots6.value().size() == 3);
+        REQUIRE_THAT(rroots6.value()[0], Catch::Matchers::WithinAbs(1.0, EPS));
+        REQUIRE_THAT(rroots6.value()[1], Catch::Matchers::WithinAbs(1.001, EPS));
+        REQUIRE_THAT(rroots6.value()[2], Catch::Matchers::WithinAbs(3.0, EPS));
+
+        // Double roots at a bisection midpoint, which may be within rounding error of zero rather than exact
+        for (double root : {2.0, 1.5}) {
+            auto rroots7 = polysolve<double>(createPolynomialFromRoots({root, root, 5.5, 6.5, 7.5}));
+            REQUIRE(rroots7.value().size() == 5);
+            REQUIRE_THAT(rroots7.value()[0], Catch::Matchers::WithinAbs(root, EPS));
+            REQUIRE_THAT(rroots7.value()[1], Catch::Matchers::WithinAbs(root, EPS));
+        }
+
+        // Multiple roots that rounding errors split into complex roots very close to the real axis
+        auto rroots8 = realroots(createPolynomialFromRoots({0.3, 0.3, 2.0, 3.0, 4.0}));
+        REQUIRE(rroots8.value().size() == 5);
+        REQUIRE_THAT(rroots8.value()[0], Catch::Matchers::WithinAbs(0.3, std::sqrt(EPS)));
+        REQUIRE_THAT(rroots8.value()[1], Catch::Matchers::WithinAbs(0.3, std::sqrt(EPS)));
+
+        auto rroots9 = realroots(createPolynomialFromRoots({0.1, 0.1, 0.1, 8.0, -2.0, -8.0, -5.0}));
+        REQUIRE(rroots9.value().size() == 7);
+        for (size_t i = 3; i < 6; ++i) REQUIRE_THAT(rroots9.value()[i], Catch::Matchers::WithinAbs(0.1, 1.0E-3));
+
+        auto froots = realroots(Polynomial<float>({2.0f, -3.0f, 1.0f}), 1.0E-5f);
+        REQUIRE(froots.value().size() == 2);
+        REQUIRE_THAT(froots.value()[1], Catch::Matchers::WithinAbs(2.0f, 1.0E-5f));
+
+        REQUIRE(realroots(Polynomial({1.0, 0.0, 1.0})).value().empty());
+        REQUIRE_FALSE(realroots(Polynomial({-2.0, 0.0, 1.0}), EPS, 1));
+    }
+
+    SECTION("Root continuation")
+    {
+        // Roots moving smoothly with a parameter t; the tracker keeps roots[i] on the path of root i
+        const auto path = [](double t) {
+            return std::vector<std::complex<double>> { {1.0 + t, 0.0}, {-2.0 * t, 1.0 + t}, {-2.0 * t, -1.0 - t}, {3.0 - t * t, 0.5}, {0.5, -2.0 + t} };
+        };
+        const auto makePoly = [](const std::vector<std::complex<double>>& roots) {
+            Polynomial<std::complex<double>> poly({{1.0, 0.0}});
+            for (const auto& root : roots) poly *= Polynomial<std::complex<double>>({-root, 1.0});
+            return poly;
+        };
+
+        RootTracker<double> tracker;
+        auto first = tracker.track(makePoly(path(0.0)));
+        REQUIRE(first.value().size() == 5);
+
+        // Identify the initial roots with the paths
+        std::vector<size_t> index(5);
+        for (size_t i = 0; i < 5; ++i)
+            for (size_t j = 0; j < 5; ++j)
+                if (std::abs(tracker.roots()[j] - path(0.0)[i]) < 1.0E-6) index[i] = j;
+
+        for (int step = 1; step <= 100; ++step) {
+            const double t     = 0.01 * step;
+            const auto   roots = tracker.track(makePoly(path(t))).value();
+            for (size_t i = 0; i < 5; ++i) REQUIRE(std::abs(roots[index[i]] - path(t)[i]) < 1.0E-6);
+        }
+        REQUIRE(tracker.steps() == 101);
+        REQUIRE(tracker.fallbacks() == 0);
+
+        // A jump which swaps two roots can not be tracked; the roots are solved from scratch, and matched by distance
+        auto swapped = path(1.0);
+        swapped[0]   = {2.9, 0.5};
+        swapped[3]   = {2.0, 0.0};
+        const auto roots = tracker.track(makePoly(swapped)).value();
+        REQUIRE(tracker.fallbacks() == 1);
+        REQUIRE(std::abs(roots[index[0]] - swapped[3]) < 1.0E-6);
+        REQUIRE(std::abs(roots[index[3]] - swapped[0]) < 1.0E-6);
+
+        // A change of order starts anew; real coefficients are accepted as well
+        auto real = tracker.track(Polynomial({-6.0, 11.0, -6.0, 1.0}));
+        REQUIRE(real.value().size() == 3);
+        REQUIRE(tracker.fallbacks() == 2);
+        for (const auto& root : tracker.roots()) REQUIRE_THAT(std::abs(root.imag()), Catch::Matchers::WithinAbs(0.0, EPS));
+
+        tracker.reset();
+        REQUIRE(tracker.roots().empty());
+        REQUIRE_THROWS(tracker.track(Polynomial({1.0})));
+    }
+
+    SECTION("Square-free decomposition")
+    {
+        const auto fromRoots = [](const std::vector<std::pair<double, int>>& roots) {
+            Polynomial<double> poly({1.0});
+            for (const auto& [root, multiplicity] : roots)
+                for (int i = 0; i < multiplicity; ++i) poly *= Polynomial<double>({-root, 1.0});
+            return poly;
+        };
+
+        // gcd((x-1)^2 (x-2)(x-5), (x-1)(x-2)(x-7)) = x^2 - 3x + 2
+        const auto gcd = polygcd(fromRoots({{1.0, 2}, {2.0, 1}, {5.0, 1}}), fromRoots({{1.0, 1}, {2.0, 1}, {7.0, 1}}));
+        REQUIRE(gcd.order() == 2);
+        REQUIRE_THAT(gcd.coefficients()[0], Catch::Matchers::WithinAbs(2.0, EPS));
+        REQUIRE_THAT(gcd.coefficients()[1], Catch::Matchers::WithinAbs(-3.0, EPS));
+        REQUIRE(polygcd(fromRoots({{1.0, 1}, {2.0, 1}}), fromRoots({{3.0, 1}})).order() == 0);
+
+        // (x-3)(x+2)^2(x-1)^3 = f_1 f_2^2 f_3^3
+        const auto factors = squarefree(fromRoots({{1.0, 3}, {-2.0, 2}, {3.0, 1}}) * Polynomial<double>({2.0})).value();
+        REQUIRE(factors.size() == 3);
+        for (size_t i = 0; i < 3; ++i) {
+            REQUIRE(factors[i].multiplicity == i + 1);
+            REQUIRE(factors[i].factor.order() == 1);
+            REQUIRE(factors[i].factor.coefficients()[1] == 1.0);
+        }
+        REQUIRE_THAT(factors[0].factor.coefficients()[0], Catch::Matchers::WithinAbs(-3.0, EPS));
+        REQUIRE_THAT(factors[1].factor.coefficients()[0], Catch::Matchers::WithinAbs(2.0, EPS));
+        REQUIRE_THAT(factors[2].factor.coefficients()[0], Catch::Matchers::WithinAbs(-1.0, EPS));
+
+        REQUIRE(squarefree(fromRoots({{1.0, 1}, {2.0, 1}, {3.0, 1}})).value().size() == 1);
+        REQUIRE(squarefree(Polynomial({3.0})).value().empty());
+        REQUIRE_THROWS(squarefree(Polynomial({1.0, 1.0}), -1.0));
+
+        // Roots of high multiplicity are found accurately, with their multiplicities
+        const auto roots1 = squarefreesolve<double>(fromRoots({{1.0, 4}, {2.0, 4}, {3.0, 2}}));
+        REQUIRE(roots1.value().size() == 3);
+        for (size_t i = 0; i < 3; ++i) {
+            REQUIRE_THAT(roots1.value()[i].root, Catch::Matchers::WithinAbs(static_cast<double>(i + 1), 1.0E-9));
+            REQUIRE(roots1.value()[i].multiplicity == (i == 2 ? 2 : 4));
+        }
+
+        // Non-symmetric roots of equal, high multiplicity, whose GCDs are badly conditioned; the roots are
+        // computed, as they would be in practice, rather than given as literals. The square-free factor is only
+        // accurate to about 1e-8 for multiplicity 8, but solving the polynomial directly is off by 0.2.
+        const std::vector<double> distinct = {0.1 - 0.4, 0.2 * 2.0, 1.0 + 0.1, 0.6 * 3.0};
+        for (int multiplicity : {5, 6, 8}) {
+            const auto poly = fromRoots({{distinct[0], multiplicity}, {distinct[1], multiplicity}, {distinct[2], multiplicity}, {distinct[3], multiplicity}});
+            for (double tolerance : {1.0E-15, 1.0E-12, 1.0E-9}) {
+                const auto highFactors = squarefree(poly, tolerance);
+                REQUIRE(highFactors.value().size() == 1);
+                REQUIRE(highFactors.value()[0].multiplicity == static_cast<size_t>(multiplicity));
+                REQUIRE(highFactors.value()[0].factor.order() == 4);
+
+                const auto highRoots = squarefreesolve<double>(poly, tolerance);
+                REQUIRE(highRoots.value().size() == 4);
+                for (size_t i = 0; i < 4; ++i) {
+                    REQUIRE_THAT(highRoots.value()[i].root, Catch::Matchers::WithinAbs(distinct[i], 1.0E-7));
+                    REQUIRE(highRoots.value()[i].multiplicity == static_cast<size_t>(multiplicity));
+                }
+            }
+        }
+
+        // Mixed multiplicities
+        const auto mixed = squarefreesolve<double>(fromRoots({{distinct[0], 3}, {distinct[1], 5}, {distinct[2], 2}, {distinct[3], 7}}), 1.0E-15);
+        REQUIRE(mixed.value().size() == 4);
+        for (size_t i = 0; i < 4; ++i) {
+            REQUIRE_THAT(mixed.value()[i].root, Catch::Matchers::WithinAbs(distinct[i], 1.0E-9));
+            REQUIRE(mixed.value()[i].multiplicity == std::vector<size_t> {3, 5, 2, 7}[i]);
+        }
+
+        // Beyond the attainable accuracy, the decomposition fails rather than returning the polynomial as square-free
+        const auto tooHigh = fromRoots({{distinct[0], 10}, {distinct[1], 10}, {distinct[2], 10}, {distinct[3], 10}});
+        REQUIRE_FALSE(squarefree(tooHigh, 1.0E-12));
+        REQUIRE_FALSE(squarefreesolve<double>(tooHigh, 1.0E-12));
+        REQUIRE(polysolve<std::complex<double>, SquareFreeSolver<>>(tooHigh, 1.0E-12).value().size() == 40);
+
+        // As a strategy for polysolve, the roots are repeated by multiplicity
+        const auto roots2 = polysolve<std::complex<double>, SquareFreeSolver<>>(fromRoots({{1.5, 6}, {-0.7, 3}, {4.0, 1}}));
+        REQUIRE(roots2.value().size() == 10);
+        for (size_t i = 0; i < 10; ++i) {
+            const double expected = i < 3 ? -0.7 : (i < 9 ? 1.5 : 4.0);
+            REQUIRE(std::abs(roots2.value()[i] - expected) < 1.0E-9);
+        }
+        const auto roots3 = polysolve<double, SquareFreeSolver<>>(fromRoots({{0.0, 3}, {2.0, 2}}));
+        REQUIRE(roots3.value().size() == 5);
+        REQUIRE_THAT(roots3.value()[2], Catch::Matchers::WithinAbs(0.0, 1.0E-9));
+        REQUIRE_THAT(roots3.value()[3], Catch::Matchers::WithinAbs(2.0, 1.0E-9));
+
+        // Complex coefficients: (x - (1+i))^2 (x - (-2+0.5i))
+        Polynomial<std::complex<double>> cpoly({{1.0, 0.0}});
+        for (const auto& root : {std::complex<double>(1.0, 1.0), std::complex<double>(1.0, 1.0), std::complex<double>(-2.0, 0.5)})
+            cpoly *= Polynomial<std::complex<double>>({-root, 1.0});
+        const auto roots4 = squarefreesolve(cpoly);
+        REQUIRE(roots4.value().size() == 2);
+        REQUIRE(std::abs(roots4.value()[0].root - std::complex<double>(-2.0, 0.5)) < 1.0E-9);
+        REQUIRE(roots4.value()[0].multiplicity == 1);
+        REQUIRE(std::abs(roots4.value()[1].root - std::complex<double>(1.0, 1.0)) < 1.0E-9);
+        REQUIRE(roots4.value()[1].multiplicity == 2);
+    }
+
+    SECTION("Adaptive precision")
+    {
+        const auto fromRoots = [](const std::vector<double>& roots) {
+            Polynomial<double> poly({1.0});
+            for (const double root : roots) poly *= Polynomial<double>({-root, 1.0});
+            return poly;
+        };
+        const auto maxError = [](const std::vector<std::complex<double>>& roots, const std::vector<double>& expected) {
+            double error = 0.0;
+            for (size_t i = 0; i < roots.size(); ++i) error = std::max(error, std::abs(roots[i] - expected[i]));
+            return error;
+        };
+
+        // Well-conditioned roots are returned as found by the inner solver
+        const std::vector<double> easy = {-2.5, -1.25, -0.75, 0.25, 0.5, 1.5, 2.75, 3.5};
+        AdaptiveSolver<>          solver;
+        const auto                roots1 = polysolve<std::complex<double>>(fromRoots(easy), solver);
+        REQUIRE(roots1.value() == polysolve<std::complex<double>>(fromRoots(easy)).value());
+        REQUIRE(solver.statistics.working == 8);
+        REQUIRE(solver.statistics.compensated + solver.statistics.multiprecision + solver.statistics.uncertified == 0);
+
+        // Moderately clustered roots are refined with compensated evaluation
+        std::vector<double> cluster;
+        for (int i = 0; i < 6; ++i) cluster.push_back(1.0 + i / 64.0);
+        const auto roots2 = polysolve<std::complex<double>>(fromRoots(cluster), solver, 1.0E-14);
+        REQUIRE(maxError(roots2.value(), cluster) < 1.0E-14);
+        REQUIRE(maxError(polysolve<std::complex<double>>(fromRoots(cluster), 1.0E-14).value(), cluster) > 1.0E-12);
+        REQUIRE(solver.statistics.compensated > 0);
+        REQUIRE(solver.statistics.multiprecision + solver.statistics.uncertified == 0);
+
+        // Tightly clustered and double roots are refined in multiprecision
+        for (auto& root : cluster) root = 1.0 + (root - 1.0) / 16.0;
+        const auto roots3 = polysolve<std::complex<double>>(fromRoots(cluster), solver, 1.0E-14);
+        REQUIRE(maxError(roots3.value(), cluster) < 1.0E-14);
+        REQUIRE(maxError(polysolve<std::complex<double>>(fromRoots(cluster), 1.0E-14).value(), cluster) > 1.0E-6);
+        REQUIRE(solver.statistics.multiprecision > 0);
+        REQUIRE(solver.statistics.uncertified == 0);
+
+        const std::vector<double> multiple = {-0.25, 1.5, 1.5};
+        const auto                roots4   = polysolve<std::complex<double>>(fromRoots(multiple), solver, 1.0E-14);
+        REQUIRE(maxError(roots4.value(), multiple) < 1.0E-13);
+        REQUIRE(solver.statistics.multiprecision == 2);
+
+        // Zero roots are exact, and divided out rather than refined: x^2 (x - 1)
+        const auto roots6 = polysolve<std::complex<double>>(fromRoots({0.0, 0.0, 1.0}), solver);
+        REQUIRE(maxError(roots6.value(), {0.0, 0.0, 1.0}) < 1.0E-15);
+        REQUIRE(roots6.value()[0] == 0.0);
+        REQUIRE(roots6.value()[1] == 0.0);
+        REQUIRE(solver.statistics.working == 3);
+        REQUIRE(solver.statistics.uncertified == 0);
+
+        // Real roots are filtered as for the other solvers
+        const auto roots5 = polysolve<double, AdaptiveSolver<>>(fromRoots(cluster), 1.0E-14);
+        REQUIRE(roots5.value().size() == 6);
+        for (size_t i = 0; i < 6; ++i) REQUIRE_THAT(roots5.value()[i], Catch::Matchers::WithinAbs(cluster[i], 1.0E-14));
+    }
+
+    SECTION("Batched closed forms")
+    {
+        // Each lane is built from known roots: real roots r and complex pairs u +- vi, with
+        // the factors (x - r) and (x^2 - 2ux + u^2 + v^2).
+        const std::vector<std::array<double, 4>> quarticRoots = {
+            {-3.0, -1.0, 0.5, 2.0},       // four real roots
+            {-1.0, 4.0, 1.5, 2.0},        // two real roots and the pair 1.5 +- 2i
+            {0.5, 1.0, -2.0, 0.25},       // the pairs 0.5 +- i and -2 +- 0.25i
+            {-2.0, -1.0, 1.0, 2.0},       // biquadratic, real roots
+            {0.0, 1.0, 0.0, 2.0},         // biquadratic, the pairs +-i and +-2i
+            {1.0E-5, 1.0, -1.0E-5, 2.0},  // nearly biquadratic, the pairs 1e-5 +- i and -1e-5 +- 2i
+            {1.0E-7, 1.0, -1.0E-7, 2.0},  // nearly biquadratic, the pairs 1e-7 +- i and -1e-7 +- 2i
+            {-3.5, 3.0, 3.0, 3.5},        // a double root, for which the resolvent has a double root
+        };
+        const std::vector<int> pairs = {0, 1, 2, 0, 2, 2, 2, 0};
+
+        std::array<std::vector<double>, 5> c;
+        std::array<std::vector<double>, 4> re;
+        std::array<std::vector<double>, 4> im;
+        for (size_t i = 0; i < quarticRoots.size(); ++i) {
+            const auto& r = quarticRoots[i];
+            Polynomial<double> poly({2.0});
+            if (pairs[i] == 0)
+                for (double root : r) poly *= Polynomial<double>({-root, 1.0});
+            if (pairs[i] == 1)
+                poly *= Polynomial<double>({-r[0], 1.0}) * Polynomial<double>({-r[1], 1.0}) * Polynomial<double>({r[2] * r[2] + r[3] * r[3], -2 * r[2], 1.0});
+            if (pairs[i] == 2)
+                poly *= Polynomial<double>({r[0] * r[0] + r[1] * r[1], -2 * r[0], 1.0}) * Polynomial<double>({r[2] * r[2] + r[3] * r[3], -2 * r[2], 1.0});
+            for (size_t k = 0; k < 5; ++k) c[k].push_back(poly.coefficients()[k]);
+        }
+        for (size_t k = 0; k < 4; ++k) {
+            re[k].resize(quarticRoots.size());
+            im[k].resize(quarticRoots.size());
+        }
+
+        auto degenerate = quarticBatch<double>({c[0], c[1], c[2], c[3], c[4]}, {re[0], re[1], re[2], re[3]}, {im[0], im[1], im[2], im[3]});
+        REQUIRE(degenerate == 0);
+
+        const std::vector<std::array<std::complex<double>, 4>> expected = {
+            {{-3.0, -1.0, 0.5, 2.0}},
+            {{-1.0, 4.0, {1.5, -2.0}, {1.5, 2.0}}},
+            {{{-2.0, -0.25}, {-2.0, 0.25}, {0.5, -1.0}, {0.5, 1.0}}},
+            {{-2.0, -1.0, 1.0, 2.0}},
+            {{{0.0, -2.0}, {0.0, -1.0}, {0.0, 1.0}, {0.0, 2.0}}},
+            {{{-1.0E-5, -2.0}, {-1.0E-5, 2.0}, {1.0E-5, -1.0}, {1.0E-5, 1.0}}},
+            {{{-1.0E-7, -2.0}, {-1.0E-7, 2.0}, {1.0E-7, -1.0}, {1.0E-7, 1.0}}},
+            {{-3.5, 3.0, 3.0, 3.5}},
+        };
+        for (size_t i = 0; i < expected.size(); ++i)
+            for (size_t k = 0; k < 4; ++k) {
+                REQUIRE_THAT(re[k][i], Catch::Matchers::WithinAbs(expected[i][k].real(), 1.0E-10));
+                REQUIRE_THAT(im[k][i], Catch::Matchers::WithinAbs(expected[i][k].imag(), 1.0E-10));
+            }
+
+        // Cubics and quadratics, including a zero leading coefficient
+        std::vector<double> d0 = {6.0, -2.0, 1.0, 5.0, -2.0};
+        std::vector<double> d1 = {-5.0, 2.0, 0.0, 1.0, -3.0};
+        std::vector<double> d2 = {-2.0, -1.0, 0.0, 1.0, 0.0};
+        std::vector<double> d3 = {1.0, 1.0, 1.0, 0.0, 1.0};
+        std::array<std::vector<double>, 3> cre;
+        std::array<std::vector<double>, 3> cim;
+        for (size_t k = 0; k < 3; ++k) {
+            cre[k].resize(d0.size());
+            cim[k].resize(d0.size());
+        }
+        degenerate = cubicBatch<double>({d0, d1, d2, d3}, {cre[0], cre[1], cre[2]}, {cim[0], cim[1], cim[2]});
+        REQUIRE(degenerate == 1);
+        REQUIRE(std::isnan(cre[0][3]));
+        for (size_t i = 0; i < 3; ++i) {
+            auto roots = polysolve<std::complex<double>>(Polynomial<double>({d0[i], d1[i], d2[i], d3[i]})).value();
+            std::sort(roots.begin(), roots.end(), [](auto a, auto b) {
+                return (std::abs(a.imag()) < 1.0E-12) != (std::abs(b.imag()) < 1.0E-12) ? std::abs(a.imag()) < 1.0E-12 : a.real() != b.real() ? a.real() < b.real() : a.imag() < b.imag();
+            });
+            for (size_t k = 0; k < 3; ++k) {
+                REQUIRE_THAT(cre[k][i], Catch::Matchers::WithinAbs(roots[k].real(), 1.0E-10));
+                REQUIRE_THAT(cim[k][i], Catch::Matchers::WithinAbs(roots[k].imag(), 1.0E-10));
+            }
+        }
+
+        // (x + 1)^2 (x - 2): the double root is real, and comes before the single root
+        for (size_t k = 0; k < 3; ++k) {
+            REQUIRE_THAT(cre[k][4], Catch::Matchers::WithinAbs(k < 2 ? -1.0 : 2.0, 1.0E-10));
+            REQUIRE(cim[k][4] == 0.0);
+        }
+
+        std::array<std::vector<double>, 2> qre = {std::vector<double>(3), std::vector<double>(3)};
+        std::array<std::vector<double>, 2> qim = {std::vector<double>(3), std::vector<double>(3)};
+        std::vector<double> q0 = {-6.0, 5.0, 0.0};
+        std::vector<double> q1 = {1.0, -2.0, 1.0};
+        std::vector<double> q2 = {1.0, 1.0, 1.0};
+        quadraticBatch<double>({q0, q1, q2}, {qre[0], qre[1]}, {qim[0], qim[1]});
+        REQUIRE(qre[0] == std::vector<double>{-3.0, 1.0, -1.0});
+        REQUIRE(qre[1] == std::vector<double>{2.0, 1.0, 0.0});
+        REQUIRE(qim[0] == std::vector<double>{0.0, -2.0, 0.0});
+        REQUIRE(qim[1] == std::vector<double>{0.0, 2.0, 0.0});
+
+        REQUIRE_THROWS(quadraticBatch<double>({q0, q1, d0}, {qre[0], qre[1]}, {qim[0], qim[1]}));
+    }
+}
+
+TEST_CASE("ChebyshevSeries tests", "[Polynomial]")
+{
+    using namespace nxx::poly;
+
+    SECTION("Evaluation")
+    {
+        // 1 + 2x + 3(2x^2 - 1) + 4(4x^3 - 3x) = -2 - 10x + 6x^2 + 16x^3
+        ChebyshevSeries<double> cs {1.0, 2.0, 3.0, 4.0};
+        Polynomial<double> p {-2.0, -10.0, 6.0, 16.0};
+        REQUIRE(cs.order() == 3);
+        for (double x = -1.0; x <= 1.0; x += 0.125) REQUIRE_THAT(cs(x), Catch::Matchers::WithinAbs(p(x), 1.0E-12));
+        REQUIRE(cs.toPolynomial() == p);
+
+        ChebyshevSeries<double> shifted(std::vector<double> {1.0, 2.0, 3.0, 4.0}, 2.0, 6.0);
+        REQUIRE_THAT(shifted(4.0), Catch::Matchers::WithinAbs(p(0.0), 1.0E-12));
+        REQUIRE_THAT(shifted(5.0), Catch::Matchers::WithinAbs(p(0.5), 1.0E-12));
+        REQUIRE_THROWS(ChebyshevSeries<double>(std::vector<double> {1.0}, 1.0, 1.0));
+
+        std::vector<double> x(37);
+        std::vector<double> y(x.size());
+        for (size_t i = 0; i < x.size(); ++i) x[i] = 2.0 + 4.0 * static_cast<double>(i) / 36.0;
+        REQUIRE(shifted.evaluate(x, y).has_value());
+        for (size_t i = 0; i < x.size(); ++i) REQUIRE_THAT(y[i], Catch::Matchers::WithinAbs(shifted(x[i]), 1.0E-12));
+        REQUIRE_THROWS(shifted.evaluate(x, std::span<double>(y).first(3)));
+    }
+
+    SECTION("Differentiation and integration")
+    {
+        ChebyshevSeries<double> cs(std::vector<double> {1.0, 2.0, 3.0, 4.0, 5.0}, 1.0, 3.0);
+        auto poly = cs.toPolynomial();
+
+        auto deriv = derivativeOf(cs);
+        auto polyDeriv = derivativeOf(poly);
+        REQUIRE(deriv.order() == 3);
+        for (double x = 1.0; x <= 3.0; x += 0.25) REQUIRE_THAT(deriv(x), Catch::Matchers::WithinAbs(polyDeriv(x), 1.0E-10));
+
+        auto integral = integralOf(cs);
+        REQUIRE(integral.order() == 5);
+        REQUIRE_THAT(integral(1.0), Catch::Matchers::WithinAbs(0.0, 1.0E-12));
+        for (double x = 1.0; x <= 3.0; x += 0.25) {
+            REQUIRE_THAT(derivativeOf(integral)(x), Catch::Matchers::WithinAbs(cs(x), 1.0E-10));
+        }
+
+        REQUIRE(derivativeOf(ChebyshevSeries<double> {3.0}).coefficients() == std::vector<double> {0.0});
+    }
+
+    SECTION("Basis conversion")
+    {
+        // Large enough to use the divide and conquer conversions, on an interval where both bases are reasonable.
+        std::vector<double> coeffs(41);
+        for (size_t i = 0; i < coeffs.size(); ++i) coeffs[i] = std::sin(static_cast<double>(i) + 1.0) / static_cast<double>(i + 1);
+        Polynomial<double> p(coeffs);
+
+        auto cs = toChebyshev(p, -0.5, 0.5);
+        for (double x = -0.5; x <= 0.5; x += 0.0625) REQUIRE_THAT(cs(x), Catch::Matchers::WithinAbs(p(x), 1.0E-12));
+
+        // The monomial coefficients of T_n grow like 2^n, so the round trip is checked for a decaying series.
+        std::vector<double> decaying(41);
+        for (size_t i = 0; i < decaying.size(); ++i) decaying[i] = std::sin(static_cast<double>(i) + 1.0) * std::ldexp(1.0, -static_cast<int>(i));
+        ChebyshevSeries<double> series(decaying);
+        auto mono = series.toPolynomial();
+        REQUIRE(mono.order() == 40);
+        for (double x = -1.0; x <= 1.0; x += 0.0625) REQUIRE_THAT(mono(x), Catch::Matchers::WithinAbs(series(x), 1.0E-12));
+        auto back = toChebyshev(mono);
+        REQUIRE(back.order() == 40);
+        for (size_t i = 0; i < decaying.size(); ++i) REQUIRE_THAT(back.coefficients()[i], Catch::Matchers::WithinAbs(decaying[i], 1.0E-12));
+
+        // Chebyshev polynomials on [-1, 1] have well known monomial forms.
+        std::vector<double> t40(41, 0.0);
+        t40[40] = 1.0;
+        auto t40mono = ChebyshevSeries<double>(t40).toPolynomial();
+        REQUIRE_THAT(t40mono.coefficients().back(), Catch::Matchers::WithinRel(std::ldexp(1.0, 39), 1.0E-12));
+        REQUIRE_THAT(t40mono.coefficients().front(), Catch::Matchers::WithinAbs(1.0, 1.0E-6));
+        REQUIRE_THAT(t40mono(0.3), Catch::Matchers::WithinAbs(std::cos(40.0 * std::acos(0.3)), 1.0E-6));
+
+        auto small = toChebyshev(Polynomial<double> {-2.0, -10.0, 6.0, 16.0});
+        for (size_t i = 0; i < 4; ++i) REQUIRE_THAT(small.coefficients()[i], Catch::Matchers::WithinAbs(static_cast<double>(i + 1), 1.0E-12));
+    }
+
+    SECTION("Interpolation")
+    {
+        auto func = [](double x) { return std::exp(x) * std::sin(3.0 * x); };
+
+        // Power of two order uses the FFT; other orders use the direct transform.
+        for (size_t order : {32, 27}) {
+            auto cs = chebyshevInterpolate(func, order, 0.0, 2.0);
+            REQUIRE(cs.order() <= order);
+            for (double x = 0.0; x <= 2.0; x += 0.05) REQUIRE_THAT(cs(x), Catch::Matchers::WithinAbs(func(x), 1.0E-12));
+            REQUIRE_THAT(integralOf(cs)(2.0),
+                         Catch::Matchers::WithinAbs((std::exp(2.0) * (std::sin(6.0) - 3.0 * std::cos(6.0)) + 3.0) / 10.0, 1.0E-12));
+        }
+
+        REQUIRE_THROWS(chebyshevInterpolate(func, 0));
+    }
+
+    SECTION("Colleague matrix roots")
+    {
+        // The roots of T_n are the Chebyshev points cos((2k - 1) pi / 2n).
+        std::vector<double> t12(13, 0.0);
+        t12[12] = 1.0;
+        auto roots = polysolve(ChebyshevSeries<double>(t12)).value();
+        REQUIRE(roots.size() == 12);
+        for (size_t k = 0; k < 12; ++k)
+            REQUIRE_THAT(roots[k], Catch::Matchers::WithinAbs(-std::cos((2.0 * static_cast<double>(k) + 1.0) * std::numbers::pi / 24.0), 1.0E-12));
+
+        // Roots on a custom interval, from an interpolant of a smooth function.
+        auto cs = chebyshevInterpolate([](double x) { return std::cos(x); }, 32, 0.0, 10.0);
+        auto real = polysolve(cs).value();
+        std::erase_if(real, [](double x) { return x < 0.0 || x > 10.0; });
+        REQUIRE(real.size() == 3);
+        for (size_t k = 0; k < 3; ++k) REQUIRE_THAT(real[k], Catch::Matchers::WithinAbs((static_cast<double>(k) + 0.5) * std::numbers::pi, 1.0E-10));
+
+        auto complexRoots = polysolve<std::complex<double>>(ChebyshevSeries<double> {2.0, 0.0, 1.0}).value();
+        REQUIRE(complexRoots.size() == 2);
+        for (auto root : complexRoots) REQUIRE(std::abs(ChebyshevSeries<double> {2.0, 0.0, 1.0}(root)) < 1.0E-12);
+
+        REQUIRE_THROWS(polysolve(ChebyshevSeries<double> {1.0}));
+    }
+}
+
+TEST_CASE("Subproduct tree tests", "[Polynomial]")
+{
+    using namespace nxx::poly;
+    using Complex = std::complex<double>;
+
+    // Points on the unit circle, where the products of the linear factors are well conditioned.
+    auto circle = [](size_t n) {
+        std::vector<Complex> points(n);
+        for (size_t i = 0; i < n; ++i) points[i] = std::polar(1.0, 2.0 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(n));
+        return points;
+    };
+
+    SECTION("Polynomials from roots")
+    {
+        REQUIRE(createPolynomialFromRoots({1.0, 2.0, 3.0}) == Polynomial<double>({-6.0, 11.0, -6.0, 1.0}));
+        REQUIRE(createPolynomialFromRoots(std::vector<double> {}) == Polynomial<double>({1.0}));
+
+        // The roots of unity give x^n - 1; enough roots to use the product tree.
+        auto poly = createPolynomialFromRoots(circle(300));
+        REQUIRE(poly.order() == 300);
+        for (size_t i = 0; i <= 300; ++i) {
+            const Complex expected = i == 0 ? Complex(-1.0) : i == 300 ? Complex(1.0) : Complex(0.0);
+            REQUIRE(std::abs(poly.coefficients()[i] - expected) < 1.0E-12);
+        }
+    }
+
+    SECTION("Multipoint evaluation")
+    {
+        const auto points = circle(300);
+        std::vector<Complex> coeffs(257);
+        for (size_t i = 0; i < coeffs.size(); ++i) coeffs[i] = Complex(std::sin(static_cast<double>(i)), std::cos(3.0 * static_cast<double>(i)));
+        Polynomial<Complex> poly(coeffs);
+
+        SubproductTree tree(points);
+        REQUIRE(tree.size() == 300);
+        auto values = tree.evaluate(poly);
+        for (size_t i = 0; i < points.size(); ++i) REQUIRE(std::abs(values[i] - poly(points[i])) < 1.0E-10);
+
+        // A polynomial of higher order than the tree is reduced modulo the root first.
+        Polynomial<Complex> high(circle(700));
+        values = tree.evaluate(high);
+        for (size_t i = 0; i < points.size(); ++i) REQUIRE(std::abs(values[i] - high(points[i])) < 1.0E-9);
+
+        // Enough points for the remainders to be computed with the stored inverses.
+        const auto many = circle(1500);
+        Polynomial<Complex> large(circle(1400));
+        values = SubproductTree(many).evaluate(large);
+        for (size_t i = 0; i < many.size(); i += 7) REQUIRE(std::abs(values[i] - large(many[i])) < 1.0E-9);
+
+        auto direct = multipointEvaluate(poly, std::span<const Complex>(points)).value();
+        for (size_t i = 0; i < points.size(); ++i) REQUIRE(std::abs(direct[i] - poly(points[i])) < 1.0E-12);
+
+        // Across the threshold, real points are still evaluated with Horner's method.
+        for (size_t n : {size_t(8191), size_t(8192)}) {
+            std::vector<double> nodes(n);
+            std::vector<double> bigCoeffs(n);
+            for (size_t i = 0; i < n; ++i) {
+                nodes[i]     = std::cos(std::numbers::pi * (static_cast<double>(i) + 0.5) / static_cast<double>(n));
+                bigCoeffs[i] = std::sin(static_cast<double>(i));
+            }
+            Polynomial<double> big(bigCoeffs);
+            auto bigValues = multipointEvaluate(big, std::span<const double>(nodes));
+            REQUIRE(bigValues);
+            for (size_t i = 0; i < n; i += 13) REQUIRE_THAT((*bigValues)[i], Catch::Matchers::WithinAbs(big(nodes[i]), 1.0E-10));
+        }
+
+        // Complex points above the threshold: the roots of unity use the tree, and points at random angles,
+        // for which the tree is inaccurate, fall back to Horner's method.
+        std::vector<Complex> bigCoeffs(8192);
+        for (size_t i = 0; i < bigCoeffs.size(); ++i) bigCoeffs[i] = Complex(std::sin(static_cast<double>(i)), std::cos(3.0 * static_cast<double>(i)));
+        Polynomial<Complex> big(bigCoeffs);
+        std::vector<Complex> scattered(8192);
+        for (size_t i = 0; i < scattered.size(); ++i) scattered[i] = std::polar(1.0, 2.0 * std::numbers::pi * std::fmod(std::abs(std::sin(static_cast<double>(i))) * 43758.5453, 1.0));
+        for (const auto& nodes : {circle(8192), scattered}) {
+            auto bigValues = multipointEvaluate(big, std::span<const Complex>(nodes));
+            REQUIRE(bigValues);
+            for (size_t i = 0; i < nodes.size(); i += 13) REQUIRE(std::abs((*bigValues)[i] - big(nodes[i])) < 1.0E-9);
+        }
+
+        // Non-finite values are reported rather than returned.
+        std::vector<double> huge = {1.0, 1.0E200};
+        REQUIRE_FALSE(multipointEvaluate(Polynomial<double>({0.0, 0.0, 1.0}), std::span<const double>(huge)));
+
+        // Real points on a short interval.
+        std::vector<double> real(100);
+        for (size_t i = 0; i < real.size(); ++i) real[i] = std::cos(std::numbers::pi * (static_cast<double>(i) + 0.5) / 100.0);
+        Polynomial<double> p({1.0, -2.0, 0.5, 3.0, -1.0, 0.25});
+        auto realValues = SubproductTree(real).evaluate(p);
+        for (size_t i = 0; i < real.size(); ++i) REQUIRE_THAT(realValues[i], Catch::Matchers::WithinAbs(p(real[i]), 1.0E-10));
+
+        std::vector<Complex> wrong(3);
+        REQUIRE_THROWS(tree.evaluate(std::span<const Complex>(coeffs), std::span<Complex>(wrong)));
+        REQUIRE_THROWS(SubproductTree(std::vector<double> {}));
+    }
+
+    SECTION("Interpolation")
+    {
+        std::vector<double> x = {0.0, 1.0, 2.0, 3.0};
+        std::vector<double> y = {1.0, 2.0, 9.0, 28.0};    // x^3 + 1
+        auto cubic = interpolatePolynomial(std::span<const double>(x), std::span<const double>(y)).value();
+        REQUIRE(cubic.order() == 3);
+        for (size_t i = 0; i < 4; ++i) REQUIRE_THAT(cubic.coefficients()[i], Catch::Matchers::WithinAbs(i == 0 || i == 3 ? 1.0 : 0.0, 1.0E-12));
+        REQUIRE(SubproductTree(x).interpolate(y).coefficients().size() == 4);
+        for (size_t i = 0; i < 4; ++i)
+            REQUIRE_THAT(SubproductTree(x).interpolate(y).coefficients()[i], Catch::Matchers::WithinAbs(cubic.coefficients()[i], 1.0E-12));
+
+        // Recover the coefficients of a polynomial from its values at the roots of unity.
+        const auto points = circle(300);
+        std::vector<Complex> coeffs(300);
+        for (size_t i = 0; i < coeffs.size(); ++i) coeffs[i] = Complex(std::sin(static_cast<double>(i)), std::cos(3.0 * static_cast<double>(i)));
+        Polynomial<Complex> poly(coeffs);
+
+        SubproductTree tree(points);
+        auto values = tree.evaluate(poly);
+        auto recovered = tree.interpolate(values);
+        REQUIRE(recovered.order() == 299);
+        for (size_t i = 0; i < coeffs.size(); ++i) REQUIRE(std::abs(recovered.coefficients()[i] - coeffs[i]) < 1.0E-10);
+
+        auto newton = interpolatePolynomial(std::span<const Complex>(points), std::span<const Complex>(values)).value();
+        for (size_t i = 0; i < coeffs.size(); ++i) REQUIRE(std::abs(newton.coefficients()[i] - coeffs[i]) < 1.0E-10);
+
+        // Above the threshold, the roots of unity use the tree.
+        const auto unity = circle(2048);
+        std::vector<Complex> unityValues(unity.size());
+        for (size_t i = 0; i < unity.size(); ++i) unityValues[i] = 1.0 + unity[i] * (2.0 - 3.0 * unity[i]);
+        auto quadratic = interpolatePolynomial(std::span<const Complex>(unity), std::span<const Complex>(unityValues));
+        REQUIRE(quadratic);
+        for (size_t i = 0; i < quadratic->coefficients().size(); ++i) {
+            const Complex expected = i == 0 ? Complex(1.0) : i == 1 ? Complex(2.0) : i == 2 ? Complex(-3.0) : Complex(0.0);
+            REQUIRE(std::abs(quadratic->coefficients()[i] - expected) < 1.0E-12);
+        }
+
+        // Real points are badly conditioned for the monomial basis; across the threshold, the overflowing
+        // coefficients are reported as an error rather than returned.
+        for (size_t n : {size_t(2047), size_t(2048)}) {
+            std::vector<double> nodes(n);
+            std::vector<double> nodeValues(n);
+            for (size_t i = 0; i < n; ++i) {
+                nodes[i]      = std::cos(std::numbers::pi * (static_cast<double>(i) + 0.5) / static_cast<double>(n));
+                nodeValues[i] = 1.0 + nodes[i] * (2.0 - 3.0 * nodes[i]);
+            }
+            REQUIRE_FALSE(interpolatePolynomial(std::span<const double>(nodes), std::span<const double>(nodeValues)));
+        }
+
+        std::vector<double> repeated = {0.0, 1.0, 1.0};
+        REQUIRE_THROWS(interpolatePolynomial(std::span<const double>(repeated), std::span<const double>(x).first(3)));
+        REQUIRE_THROWS(SubproductTree(repeated).interpolate(std::span<const double>(x).first(3)));
+        REQUIRE_THROWS(interpolatePolynomial(std::span<const double>(x), std::span<const double>(y).first(3)));
+    }
+}
+
+TEST_CASE("MultiPolynomial tests", "[Polynomial]")
+{
+    using namespace nxx::poly;
+
+    // p(x, y, z) = 7 + 5xz - 2yz^3 + 3x^2y - x^4, with the terms in no particular order and one term split in two.
+    const MultiPolynomial<double> p { { 3.0, { 2, 1, 0 } }, { 7.0, { 0, 0, 0 } }, { -2.0, { 0, 1, 3 } },
+                                      { 2.0, { 1, 0, 1 } }, { -1.0, { 4, 0, 0 } }, { 3.0, { 1, 0, 1 } } };
+
+    auto value = [](double x, double y, double z) { return 7 + 5 * x * z - 2 * y * z * z * z + 3 * x * x * y - x * x * x * x; };
+
+    SECTION("Evaluation")
+    {
+        REQUIRE(p.variables() == 3);
+        REQUIRE(p.size() == 5);
+        REQUIRE(p.degree() == 4);
+
+        for (const auto& x : { std::array{ 0.0, 0.0, 0.0 }, std::array{ 1.5, -0.5, 2.0 }, std::array{ -2.0, 3.0, 0.25 } })
+            REQUIRE_THAT(p(x), Catch::Matchers::WithinRel(value(x[0], x[1], x[2]), 1.0E-14));
+
+        std::vector<double> tooShort(2);
+        REQUIRE_THROWS(p(tooShort));
+        REQUIRE_THROWS(MultiPolynomial<double>(0));
+
+        MultiPolynomial<double> q(2);
+        REQUIRE(q(std::array{ 1.0, 2.0 }) == 0.0);
+        q.addTerm(2.0, { 1, 1 });
+        q.addTerm(1.0, { 0, 2 });
+        REQUIRE(q(std::array{ 3.0, 2.0 }) == 16.0);
+        q.addTerm(-2.0, { 1, 1 });
+        REQUIRE(q.size() == 1);
+        REQUIRE(q(std::array{ 3.0, 2.0 }) == 4.0);
+        REQUIRE_THROWS(q.addTerm(1.0, { 1, 2, 3 }));
+    }
+
+    SECTION("Gradients and Hessians")
+    {
+        const std::array x { 1.5, -0.5, 2.0 };
+        std::array<double, 3> grad {};
+        std::array<double, 9> hess {};
+
+        const double gx = 5 * x[2] + 6 * x[0] * x[1] - 4 * x[0] * x[0] * x[0];
+        const double gy = -2 * x[2] * x[2] * x[2] + 3 * x[0] * x[0];
+        const double gz = 5 * x[0] - 6 * x[1] * x[2] * x[2];
+        const std::array expectedHess { 6 * x[1] - 12 * x[0] * x[0], 6 * x[0], 5.0,
+                                        6 * x[0], 0.0, -6 * x[2] * x[2],
+                                        5.0, -6 * x[2] * x[2], -12 * x[1] * x[2] };
+
+        REQUIRE_THAT(p.gradient(x, grad), Catch::Matchers::WithinRel(value(x[0], x[1], x[2]), 1.0E-14));
+        REQUIRE_THAT(grad[0], Catch::Matchers::WithinRel(gx, 1.0E-14));
+        REQUIRE_THAT(grad[1], Catch::Matchers::WithinRel(gy, 1.0E-14));
+        REQUIRE_THAT(grad[2], Catch::Matchers::WithinRel(gz, 1.0E-14));
+
+        grad = {};
+        REQUIRE_THAT(p.hessian(x, grad, hess), Catch::Matchers::WithinRel(value(x[0], x[1], x[2]), 1.0E-14));
+        REQUIRE_THAT(grad[2], Catch::Matchers::WithinRel(gz, 1.0E-14));
+        for (size_t i = 0; i < 9; ++i) REQUIRE_THAT(hess[i], Catch::Matchers::WithinAbs(expectedHess[i], 1.0E-13));
+
+        std::array<double, 4> wrongSize {};
+        REQUIRE_THROWS(p.hessian(x, grad, wrongSize));
+    }
+
+    SECTION("Analytic Jacobians for multiroots")
+    {
+        using namespace nxx::multiroots;
+
+        // x^2 + y^2 = 4 and xy = 1.
+        const MultiPolynomial<double> f1 { { 1.0, { 2, 0 } }, { 1.0, { 0, 2 } }, { -4.0, { 0, 0 } } };
+        const MultiPolynomial<double> f2 { { 1.0, { 1, 1 } }, { -1.0, { 0, 0 } } };
+        MultiFunctionArray functions { f1, f2 };
+        REQUIRE(functions.hasGradients());
+
+        const auto J = nxx::deriv::jacobian(functions, std::vector { 1.5, 0.5 });
+        REQUIRE(J(0, 0) == 3.0);
+        REQUIRE(J(0, 1) == 1.0);
+        REQUIRE(J(1, 0) == 0.5);
+        REQUIRE(J(1, 1) == 1.5);
+
+        const auto root = multisolve<MultiNewton>(functions, { 2.0, 0.5 }, 1.0E-12);
+        REQUIRE(root.has_value());
+        REQUIRE_THAT((*root)[0] * (*root)[1], Catch::Matchers::WithinAbs(1.0, 1.0E-12));
+        REQUIRE_THAT((*root)[0] * (*root)[0] + (*root)[1] * (*root)[1], Catch::Matchers::WithinAbs(4.0, 1.0E-12));
+    }
+}
+
+TEST_CASE("Orthogonal polynomial tests", "[Polynomial]")
+{
+    using namespace nxx::poly;
+
+    // ===== More points than one block, to cover the blocking.
+    std::vector<double> x(300);
+    for (size_t m = 0; m < x.size(); ++m) x[m] = -1.0 + 2.0 * static_cast<double>(m) / static_cast<double>(x.size() - 1);
+    const size_t M = x.size();
+
+    SECTION("Recurrence Tables")
+    {
+        const auto legendre = evaluateOrthogonalWithDerivatives<2>(LegendreFamily<double>{}, 3, x);
+        for (size_t m = 0; m < M; ++m) {
+            const double t = x[m];
+            REQUIRE_THAT(legendre[0][2 * M + m], Catch::Matchers::WithinAbs((3 * t * t - 1) / 2, 1.0E-14));
+            REQUIRE_THAT(legendre[0][3 * M + m], Catch::Matchers::WithinAbs((5 * t * t * t - 3 * t) / 2, 1.0E-14));
+            REQUIRE_THAT(legendre[1][3 * M + m], Catch::Matchers::WithinAbs((15 * t * t - 3) / 2, 1.0E-13));
+            REQUIRE_THAT(legendre[2][3 * M + m], Catch::Matchers::WithinAbs(15 * t, 1.0E-13));
+            REQUIRE(legendre[1][m] == 0.0);
+        }
+
+        // ===== T_k(cos θ) = cos(k θ), at high degree.
+        const auto chebyshev = evaluateOrthogonal(ChebyshevFamily<double>{}, 60, x);
+        for (size_t k = 0; k <= 60; ++k)
+            for (size_t m = 0; m < M; ++m)
+                REQUIRE_THAT(chebyshev[k * M + m], Catch::Matchers::WithinAbs(std::cos(static_cast<double>(k) * std::acos(x[m])), 1.0E-12));
+
+        const auto hermite = evaluateOrthogonal(HermiteFamily<double>{}, 3, x);
+        for (size_t m = 0; m < M; ++m)
+            REQUIRE_THAT(hermite[3 * M + m], Catch::Matchers::WithinAbs(8 * x[m] * x[m] * x[m] - 12 * x[m], 1.0E-13));
+
+        // ===== d/dx L_k^(a) = -L_(k-1)^(a+1).
+        const auto laguerre = evaluateOrthogonalWithDerivatives<1>(LaguerreFamily<double>(0.5), 12, x);
+        const auto shifted  = evaluateOrthogonal(LaguerreFamily<double>(1.5), 12, x);
+        for (size_t k = 1; k <= 12; ++k)
+            for (size_t m = 0; m < M; ++m)
+                REQUIRE_THAT(laguerre[1][k * M + m], Catch::Matchers::WithinAbs(-shifted[(k - 1) * M + m], 1.0E-11));
+
+        // ===== Jacobi with alpha = beta = 0 is Legendre.
+        const auto jacobi = evaluateOrthogonal(JacobiFamily<double>(0.0, 0.0), 20, x);
+        const auto legendre20 = evaluateOrthogonal(LegendreFamily<double>{}, 20, x);
+        for (size_t i = 0; i < jacobi.size(); ++i) REQUIRE_THAT(jacobi[i], Catch::Matchers::WithinAbs(legendre20[i], 1.0E-13));
+
+        std::vector<double> tooShort(3 * M);
+        REQUIRE_THROWS(evaluateOrthogonal(LegendreFamily<double>{}, 3, x, tooShort));
+        REQUIRE_THROWS(LaguerreFamily<double>(-1.0));
+        REQUIRE_THROWS(JacobiFamily<double>(0.0, -2.0));
+    }
+
+    SECTION("Gauss Rules")
+    {
+        const auto legendre = gaussRule(LegendreFamily<double>{}, 5);
+        const std::array<double, 5> nodes { -0.9061798459386640, -0.5384693101056831, 0.0, 0.5384693101056831, 0.9061798459386640 };
+        const std::array<double, 5> weights { 0.2369268850561891, 0.4786286704993665, 0.5688888888888889, 0.4786286704993665, 0.2369268850561891 };
+        for (size_t i = 0; i < 5; ++i) {
+            REQUIRE_THAT(legendre.nodes[i], Catch::Matchers::WithinAbs(nodes[i], 1.0E-15));
+            REQUIRE_THAT(legendre.weights[i], Catch::Matchers::WithinAbs(weights[i], 1.0E-15));
+        }
+
+        const auto chebyshev = gaussRule(ChebyshevFamily<double>{}, 7);
+        for (size_t i = 0; i < 7; ++i) {
+            REQUIRE_THAT(chebyshev.nodes[i], Catch::Matchers::WithinAbs(-std::cos((2.0 * static_cast<double>(i) + 1) * std::numbers::pi / 14), 1.0E-15));
+            REQUIRE_THAT(chebyshev.weights[i], Catch::Matchers::WithinAbs(std::numbers::pi / 7, 1.0E-14));
+        }
+
+        // ===== Exactness for polynomials of order up to 2n - 1 against the weight function.
+        const auto integrate = [](const auto& rule, auto function) {
+            double sum = 0.0;
+            for (size_t i = 0; i < rule.nodes.size(); ++i) sum += rule.weights[i] * function(rule.nodes[i]);
+            return sum;
+        };
+
+        const auto hermite = gaussRule(HermiteFamily<double>{}, 20);
+        REQUIRE_THAT(integrate(hermite, [](double t) { return t * t * t * t; }), Catch::Matchers::WithinRel(3 * std::sqrt(std::numbers::pi) / 4, 1.0E-13));
+
+        const auto laguerre = gaussRule(LaguerreFamily<double>(0.5), 15);
+        REQUIRE(laguerre.nodes.front() > 0.0);
+        REQUIRE_THAT(integrate(laguerre, [](double t) { return t * t * t; }), Catch::Matchers::WithinRel(std::tgamma(4.5), 1.0E-13));
+
+        const auto jacobi = gaussRule(JacobiFamily<double>(1.0, 2.0), 10);
+        const auto reference = gaussRule(LegendreFamily<double>{}, 20);
+        REQUIRE_THAT(integrate(jacobi, [](double t) { return t * t * t; }),
+                     Catch::Matchers::WithinAbs(integrate(reference, [](double t) { return (1 - t) * (1 + t) * (1 + t) * t * t * t; }), 1.0E-14));
+
+        // ===== Large rules, where the orthonormal polynomials overflow at the outermost nodes, whose weights underflow.
+        const auto largeLaguerre = gaussRule(LaguerreFamily<double>{}, 400);
+        const auto largeHermite  = gaussRule(HermiteFamily<double>{}, 800);
+        for (const auto* rule : { &largeLaguerre, &largeHermite }) {
+            REQUIRE(std::ranges::all_of(rule->nodes, [](double t) { return std::isfinite(t); }));
+            REQUIRE(std::ranges::is_sorted(rule->nodes));
+            REQUIRE(std::ranges::all_of(rule->weights, [](double w) { return w >= 0.0 && std::isfinite(w); }));
+        }
+        REQUIRE(largeLaguerre.weights.back() == 0.0);
+        REQUIRE_THAT(integrate(largeLaguerre, [](double t) { return t; }), Catch::Matchers::WithinRel(1.0, 1.0E-12));
+        REQUIRE_THAT(integrate(largeHermite, [](double t) { return t * t; }), Catch::Matchers::WithinRel(std::sqrt(std::numbers::pi) / 2, 1.0E-12));
+
+        REQUIRE(gaussRule(LegendreFamily<double>{}, 1).nodes == std::vector<double> { 0.0 });
+        REQUIRE_THROWS(gaussRule(LegendreFamily<double>{}, 0));
+    }
+}
+
+TEST_CASE("Rational function tests", "[Polynomial]")
+{
+    using namespace nxx::poly;
+    using namespace std::complex_literals;
+
+    SECTION("Evaluation")
+    {
+        const Polynomial<double> num({ 2.1, -1.34, 0.76, 0.45 });
+        const Polynomial<double> den({ 1.0, 0.3, 0.0, -0.2, 0.05 });
+        const Rational<double>   r(num, den);
+
+        std::vector<double> x(203);
+        std::vector<double> y(x.size());
+        for (size_t i = 0; i < x.size(); ++i) x[i] = -3.0 + 0.03 * static_cast<double>(i);
+        REQUIRE(r.evaluate(x, y).has_value());
+        for (size_t i = 0; i < x.size(); ++i) {
+            REQUIRE_THAT(r(x[i]), Catch::Matchers::WithinRel(num(x[i]) / den(x[i]), 1.0E-13));
+            REQUIRE(y[i] == r(x[i]));
+        }
+
+        // ===== Large arguments are evaluated in 1 / x, and do not overflow.
+        const Rational<double> s(Polynomial<double>({ 1.0, 0.0, 1.0 }), Polynomial<double>({ 3.0, 0.0, 2.0 }));
+        REQUIRE_THAT(s(1.0E200), Catch::Matchers::WithinRel(0.5, 1.0E-15));
+        REQUIRE_THAT(s(-1.0E200), Catch::Matchers::WithinRel(0.5, 1.0E-15));
+
+        const Rational<std::complex<double>> c(Polynomial({ 1.0 + 1.0i, 2.0 - 0.5i }), Polynomial({ 0.5 + 0.0i, 0.0 + 1.0i, 1.0 + 0.0i }));
+        for (const auto z : { 0.3 + 0.2i, -2.0 + 1.5i, 4.0 - 3.0i }) {
+            const auto expected = (1.0 + 1.0i + (2.0 - 0.5i) * z) / (0.5 + 1.0i * z + z * z);
+            REQUIRE_THAT(std::abs(c(z) - expected), Catch::Matchers::WithinAbs(0.0, 1.0E-14));
+        }
+
+        // ===== At a pole, the result is non-finite.
+        const Rational<double> pole(Polynomial<double>({ 1.0 }), Polynomial<double>({ -2.0, 1.0 }));
+        REQUIRE_FALSE(pole.evaluate(2.0).has_value());
+        std::vector<double> points { 0.0, 2.0 };
+        std::vector<double> values(2);
+        REQUIRE_FALSE(pole.evaluate(points, values).has_value());
+        std::vector<double> tooShort(1);
+        REQUIRE_THROWS(pole.evaluate(points, tooShort));
+
+        REQUIRE_THROWS(Rational<double>(Polynomial<double>({ 1.0 }), Polynomial<double>({ 0.0 })));
+        REQUIRE(Rational<double>()(3.0) == 0.0);
+    }
+
+    SECTION("Pade Approximants")
+    {
+        // ===== [3/3] of exp(x): (1 + x/2 + x^2/10 + x^3/120) / (1 - x/2 + x^2/10 - x^3/120).
+        std::vector<double> taylor(7);
+        double              factorial = 1.0;
+        for (size_t k = 0; k < taylor.size(); ++k) {
+            taylor[k] = 1.0 / factorial;
+            factorial *= static_cast<double>(k + 1);
+        }
+
+        const auto exp33 = pade(taylor, 3, 3);
+        REQUIRE(exp33.has_value());
+        const std::array<double, 4> expected { 1.0, 0.5, 0.1, 1.0 / 120 };
+        for (size_t k = 0; k < 4; ++k) {
+            const double sign = k % 2 == 0 ? 1.0 : -1.0;
+            REQUIRE_THAT(exp33->numerator().coefficients()[k], Catch::Matchers::WithinAbs(expected[k], 1.0E-14));
+            REQUIRE_THAT(exp33->denominator().coefficients()[k], Catch::Matchers::WithinAbs(sign * expected[k], 1.0E-14));
+        }
+        REQUIRE_THAT((*exp33)(0.5), Catch::Matchers::WithinAbs(std::exp(0.5), 2.0E-7));
+
+        // ===== [m/0] is the Taylor polynomial.
+        const auto exp40 = pade(taylor, 4, 0);
+        REQUIRE(exp40->numerator().coefficients() == std::vector<double>(taylor.begin(), taylor.begin() + 5));
+
+        // ===== The [1/1] approximant of cos(x) does not exist.
+        REQUIRE_FALSE(pade(std::vector<double> { 1.0, 0.0, -0.5 }, 1, 1).has_value());
+        REQUIRE_THROWS(pade(taylor, 4, 4));
+    }
+
+    SECTION("Minimax Approximations")
+    {
+        const auto approx = minimaxRational([](double t) { return std::exp(t); }, 3, 3, -1.0, 1.0);
+        REQUIRE(approx.has_value());
+
+        // ===== The error equioscillates at m + n + 2 = 8 points, with a level below that of the Padé approximant.
+        std::vector<double> err(20001);
+        for (size_t i = 0; i < err.size(); ++i) {
+            const double t = -1.0 + 2.0 * static_cast<double>(i) / static_cast<double>(err.size() - 1);
+            err[i]         = std::exp(t) - (*approx)(t);
+        }
+        const double maxError = std::ranges::max(err | std::views::transform([](double e) { return std::abs(e); }));
+        REQUIRE(maxError < 2.0E-7);
+        REQUIRE(maxError < std::abs(std::exp(1.0) - (*pade(std::vector<double> { 1.0, 1.0, 0.5, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720 }, 3, 3))(1.0)));
+
+        size_t alternations = 0;
+        double lastSign     = 0.0;
+        for (const double e : err)
+            if (std::abs(e) > 0.99 * maxError && (e > 0 ? 1.0 : -1.0) != lastSign) {
+                ++alternations;
+                lastSign = e > 0 ? 1.0 : -1.0;
+            }
+        REQUIRE(alternations == 8);
+
+        const auto gamma = minimaxRational([](double t) { return std::tgamma(t); }, 4, 4, 1.0, 2.0);
+        REQUIRE(gamma.has_value());
+        for (const double t : { 1.0, 1.3, 1.77, 2.0 }) REQUIRE_THAT((*gamma)(t), Catch::Matchers::WithinAbs(std::tgamma(t), 1.0E-9));
+
+        // ===== The maximum error on a fine grid.
+        const auto maxErrorOf = [](auto function, const Rational<double>& r, double lower, double upper) {
+            double result = 0.0;
+            for (int i = 0; i <= 4000; ++i) {
+                const double t = lower + (upper - lower) * i / 4000.0;
+                result         = std::max(result, std::abs(function(t) - r(t)));
+            }
+            return result;
+        };
+
+        // ===== Every [m/n] up to [6/6] of atan on [0, 5] and sqrt on [1, 4] converges, and is no worse than [m/0].
+        const auto atan = [](double t) { return std::atan(t); };
+        const auto sqrt = [](double t) { return std::sqrt(t); };
+        for (size_t m = 1; m <= 6; ++m) {
+            const double atanPolynomial = maxErrorOf(atan, *minimaxRational(atan, m, 0, 0.0, 5.0), 0.0, 5.0);
+            const double sqrtPolynomial = maxErrorOf(sqrt, *minimaxRational(sqrt, m, 0, 1.0, 4.0), 1.0, 4.0);
+            for (size_t n = 1; n <= 6; ++n) {
+                const auto atanApprox = minimaxRational(atan, m, n, 0.0, 5.0);
+                const auto sqrtApprox = minimaxRational(sqrt, m, n, 1.0, 4.0);
+                REQUIRE(atanApprox.has_value());
+                REQUIRE(sqrtApprox.has_value());
+                REQUIRE(maxErrorOf(atan, *atanApprox, 0.0, 5.0) <= 1.001 * atanPolynomial);
+                REQUIRE(maxErrorOf(sqrt, *sqrtApprox, 1.0, 4.0) <= 1.001 * sqrtPolynomial);
+            }
+        }
+
+        // ===== The [4/4] approximation of atan on [0, 5] equioscillates at 10 points.
+        const auto   atan44           = minimaxRational(atan, 4, 4, 0.0, 5.0);
+        const double atanError        = maxErrorOf(atan, *atan44, 0.0, 5.0);
+        size_t       atanAlternations = 0;
+        double       atanSign         = 0.0;
+        for (int i = 0; i <= 20000; ++i) {
+            const double e = std::atan(5.0 * i / 20000.0) - (*atan44)(5.0 * i / 20000.0);
+            if (std::abs(e) > 0.99 * atanError && (e > 0 ? 1.0 : -1.0) != atanSign) {
+                ++atanAlternations;
+                atanSign = e > 0 ? 1.0 : -1.0;
+            }
+        }
+        REQUIRE(atanError < 2.0E-6);
+        REQUIRE(atanAlternations == 10);
+
+        // ===== [6/6] of erf on [0, 2] is nearly degenerate, and falls back to [6/5].
+        const auto erf = minimaxRational([](double t) { return std::erf(t); }, 6, 6, 0.0, 2.0);
+        REQUIRE(erf.has_value());
+        REQUIRE(maxErrorOf([](double t) { return std::erf(t); }, *erf, 0.0, 2.0) < 2.0E-8);
+
+        // ===== The Runge function is its own [2/2] approximation; its [1/1] one is degenerate, and by symmetry the
+        //       best constant, (1 - 1 / 26) / 2, which the fallback to [1/0] finds.
+        const auto runge   = [](double t) { return 1.0 / (1.0 + 25.0 * t * t); };
+        const auto runge22 = minimaxRational(runge, 2, 2, -1.0, 1.0);
+        const auto runge11 = minimaxRational(runge, 1, 1, -1.0, 1.0);
+        REQUIRE(runge22.has_value());
+        REQUIRE(runge11.has_value());
+        REQUIRE(maxErrorOf(runge, *runge22, -1.0, 1.0) < 1.0E-12);
+        REQUIRE(runge11->denominator().order() == 0);
+        REQUIRE_THAT(maxErrorOf(runge, *runge11, -1.0, 1.0), Catch::Matchers::WithinAbs(12.5 / 26.0, 1.0E-6));
+
+        REQUIRE_THROWS(minimaxRational([](double t) { return t; }, 1, 1, 1.0, 1.0));
+    }
+
+    SECTION("Zeros and Poles")
+    {
+        // ===== (x - 1)(x + 2) / ((x - 3)(x^2 + 1)).
+        const Rational<double> r(Polynomial<double>({ -2.0, 1.0, 1.0 }), Polynomial<double>({ -3.0, 1.0, -3.0, 1.0 }));
+        const auto zeros = polysolve(r);
+        REQUIRE(zeros.has_value());
+        REQUIRE(zeros->size() == 2);
+        REQUIRE_THAT((*zeros)[0], Catch::Matchers::WithinAbs(-2.0, 1.0E-12));
+        REQUIRE_THAT((*zeros)[1], Catch::Matchers::WithinAbs(1.0, 1.0E-12));
+
+        const auto realPoles = poles(r);
+        REQUIRE(realPoles->size() == 1);
+        REQUIRE_THAT(realPoles->front(), Catch::Matchers::WithinAbs(3.0, 1.0E-12));
+
+        const auto complexPoles = poles<std::complex<double>>(r);
+        REQUIRE(complexPoles->size() == 3);
+    }
 }